@@ -32,17 +32,29 @@ ze_result_t zeCommandListCreateImmediate(
 
 ze_result_t zeCommandListDestroy(
     ze_command_list_handle_t hCommandList) {
-    return L0::CommandList::fromHandle(hCommandList)->destroy();
+    auto commandList = L0::CommandList::fromHandle(hCommandList);
+    if (commandList->isSegment()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return commandList->destroy();
 }
 
 ze_result_t zeCommandListClose(
     ze_command_list_handle_t hCommandList) {
-    return L0::CommandList::fromHandle(hCommandList)->close();
+    auto commandList = L0::CommandList::fromHandle(hCommandList);
+    if (commandList->isSegment()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return commandList->close();
 }
 
 ze_result_t zeCommandListReset(
     ze_command_list_handle_t hCommandList) {
-    return L0::CommandList::fromHandle(hCommandList)->reset();
+    auto commandList = L0::CommandList::fromHandle(hCommandList);
+    if (commandList->isSegment()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return commandList->reset();
 }
 
 ze_result_t zeCommandListAppendWriteGlobalTimestamp(
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_latency_histograms.h"
+
 #include "level_zero/core/source/event/event.h"
 #include <level_zero/ze_api.h>
 
@@ -76,6 +78,7 @@ ze_result_t zeEventHostSignal(
 ze_result_t zeEventHostSynchronize(
     ze_event_handle_t hEvent,
     uint64_t timeout) {
+    NEO::ApiLatencyScope latencyScope(NEO::ApiLatencyEntryPoint::zeEventHostSynchronize);
     return L0::Event::fromHandle(hEvent)->hostSynchronize(timeout);
 }
 
@@ -8,6 +8,8 @@
 #include "level_zero/api/driver_experimental/public/zex_cmdlist.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
+#include "level_zero/core/source/cmdlist/cmdlist_imp.h"
+#include "level_zero/core/source/kernel/kernel_imp.h"
 
 namespace L0 {
 ZE_APIEXPORT ze_result_t ZE_APICALL
@@ -70,4 +72,76 @@ zexCommandListAppendWriteToMemory(
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListCreateSegments(
+    zex_command_list_handle_t hCommandList,
+    uint32_t numSegments,
+    ze_command_list_handle_t *phSegments) {
+    try {
+        {
+            hCommandList = toInternalType(hCommandList);
+            if (nullptr == hCommandList)
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return static_cast<L0::CommandListImp *>(L0::CommandList::fromHandle(hCommandList))->createSegments(numSegments, phSegments);
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendLaunchKernelWithArguments(
+    zex_command_list_handle_t hCommandList,
+    ze_kernel_handle_t hKernel,
+    const ze_group_count_t *pGroupCount,
+    const zex_kernel_launch_args_desc_t *pArgsDesc,
+    ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents) {
+    try {
+        {
+            hCommandList = toInternalType(hCommandList);
+            hKernel = toInternalType(hKernel);
+            if (nullptr == hCommandList || nullptr == hKernel || nullptr == pGroupCount || nullptr == pArgsDesc)
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            if (pArgsDesc->numArgs > 0 && (nullptr == pArgsDesc->pArgSizes || nullptr == pArgsDesc->ppArgValues))
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        auto kernel = static_cast<L0::KernelImp *>(L0::Kernel::fromHandle(hKernel));
+        if (pArgsDesc->numArgs != kernel->getImmutableData()->getDescriptor().payloadMappings.explicitArgs.size()) {
+            return ZE_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
+        }
+
+        ze_result_t result = ZE_RESULT_SUCCESS;
+        auto launchState = kernel->acquireLaunchState(result);
+        if (nullptr == launchState) {
+            return result;
+        }
+
+        result = launchState->setGroupSize(pArgsDesc->groupSizeX, pArgsDesc->groupSizeY, pArgsDesc->groupSizeZ);
+        for (uint32_t i = 0; i < pArgsDesc->numArgs && result == ZE_RESULT_SUCCESS; i++) {
+            result = launchState->setArgumentValue(i, pArgsDesc->pArgSizes[i], pArgsDesc->ppArgValues[i]);
+        }
+        if (result == ZE_RESULT_SUCCESS) {
+            auto cmdList = L0::CommandList::fromHandle(hCommandList);
+            L0::CmdListKernelLaunchParams launchParams = {};
+            launchParams.skipInOrderNonWalkerSignaling = cmdList->skipInOrderNonWalkerSignalingAllowed(hSignalEvent);
+            result = cmdList->appendLaunchKernel(launchState->toHandle(), *pGroupCount, hSignalEvent, numWaitEvents, phWaitEvents, launchParams, false);
+        }
+
+        kernel->releaseLaunchState(launchState);
+        return result;
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
 } // namespace L0
@@ -33,4 +33,26 @@ zexCommandListAppendWriteToMemory(
     zex_write_to_mem_desc_t *desc,
     void *ptr,
     uint64_t data);
+
+// Creates regular command lists which may be appended to from separate threads
+// and are executed right after the parent. Segments are owned by the parent,
+// closed together with it and destroyed on its reset or destroy.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListCreateSegments(
+    zex_command_list_handle_t hCommandList,
+    uint32_t numSegments,
+    ze_command_list_handle_t *phSegments);
+
+// Appends kernel launch with group size and arguments given by the caller.
+// Kernel handle state is not modified, so the same handle may be launched
+// from multiple threads without external synchronization.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendLaunchKernelWithArguments(
+    zex_command_list_handle_t hCommandList,
+    ze_kernel_handle_t hKernel,
+    const ze_group_count_t *pGroupCount,
+    const zex_kernel_launch_args_desc_t *pArgsDesc,
+    ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents);
 } // namespace L0
@@ -54,6 +54,27 @@ typedef struct _zex_write_to_mem_desc_t {
     zex_mem_action_scope_flags_t writeScope;
 } zex_write_to_mem_desc_t;
 
+typedef struct _zex_kernel_launch_args_desc_t {
+    uint32_t groupSizeX;            ///< [in] group size in X dimension
+    uint32_t groupSizeY;            ///< [in] group size in Y dimension
+    uint32_t groupSizeZ;            ///< [in] group size in Z dimension
+    uint32_t numArgs;               ///< [in] number of arguments, must match number of kernel arguments
+    const size_t *pArgSizes;        ///< [in] array of numArgs argument sizes
+    const void *const *ppArgValues; ///< [in] array of numArgs argument values, as passed to zeKernelSetArgumentValue
+} zex_kernel_launch_args_desc_t;
+
+#define ZEX_API_LATENCY_HISTOGRAM_BUCKETS_COUNT 64
+
+typedef struct _zex_api_latency_histogram_t {
+    uint32_t samplingRate;                                      ///< [out] every n-th call of an entry point on each thread is recorded
+    uint64_t samplesCount;                                      ///< [out] number of recorded calls
+    uint64_t p50Ns;                                             ///< [out] upper bound of bucket holding 50th percentile, in nanoseconds
+    uint64_t p90Ns;                                             ///< [out] upper bound of bucket holding 90th percentile, in nanoseconds
+    uint64_t p99Ns;                                             ///< [out] upper bound of bucket holding 99th percentile, in nanoseconds
+    uint64_t maxNs;                                             ///< [out] upper bound of bucket holding slowest recorded call, in nanoseconds
+    uint64_t buckets[ZEX_API_LATENCY_HISTOGRAM_BUCKETS_COUNT]; ///< [out] bucket 0 counts zero latencies, bucket i counts latencies in [2^(i-1), 2^i) ns
+} zex_api_latency_histogram_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef ZE_SYNCHRONIZED_DISPATCH_EXP_NAME
 /// @brief Synchronized Dispatch extension name
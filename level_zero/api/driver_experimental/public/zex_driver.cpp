@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/helpers/string.h"
+#include "shared/source/utilities/api_latency_histograms.h"
 
 #include "level_zero/api/driver_experimental/public/zex_api.h"
 #include "level_zero/core/source/driver/driver.h"
@@ -14,6 +15,7 @@
 
 #include "driver_version.h"
 
+#include <algorithm>
 #include <string>
 
 namespace L0 {
@@ -41,6 +43,37 @@ zexDriverGetHostPointerBaseAddress(
     return L0::DriverHandle::fromHandle(toInternalType(hDriver))->getHostPointerBaseAddress(ptr, baseAddress);
 }
 
+ze_result_t ZE_APICALL
+zexDriverGetApiLatencyHistogram(
+    ze_driver_handle_t hDriver,
+    const char *pEntryPointName,
+    zex_api_latency_histogram_t *pHistogram) {
+    if (nullptr == hDriver || nullptr == pEntryPointName || nullptr == pHistogram) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    // Histograms are process wide and also cover OpenCL entry points
+    auto histograms = NEO::ApiLatencyHistograms::getGlobal();
+    if (nullptr == histograms || !histograms->isEnabled()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    NEO::ApiLatencyEntryPoint entryPoint;
+    if (!NEO::ApiLatencyHistograms::getEntryPoint(pEntryPointName, entryPoint)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    static_assert(ZEX_API_LATENCY_HISTOGRAM_BUCKETS_COUNT == NEO::ApiLatencyHistograms::bucketsCount);
+    auto summary = histograms->getSummary(entryPoint);
+    pHistogram->samplingRate = histograms->getSamplingRate();
+    pHistogram->samplesCount = summary.samplesCount;
+    pHistogram->p50Ns = summary.p50Ns;
+    pHistogram->p90Ns = summary.p90Ns;
+    pHistogram->p99Ns = summary.p99Ns;
+    pHistogram->maxNs = summary.maxNs;
+    std::copy(summary.histogram.begin(), summary.histogram.end(), pHistogram->buckets);
+    return ZE_RESULT_SUCCESS;
+}
+
 } // namespace L0
 
 ze_result_t ZE_APICALL
@@ -86,4 +119,12 @@ zexDriverGetHostPointerBaseAddress(
     void **baseAddress) {
     return L0::zexDriverGetHostPointerBaseAddress(hDriver, ptr, baseAddress);
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexDriverGetApiLatencyHistogram(
+    ze_driver_handle_t hDriver,
+    const char *pEntryPointName,
+    zex_api_latency_histogram_t *pHistogram) {
+    return L0::zexDriverGetApiLatencyHistogram(hDriver, pEntryPointName, pHistogram);
+}
 }
@@ -12,6 +12,7 @@
 #endif
 
 #include "level_zero/api/driver_experimental/public/zex_api.h"
+#include "level_zero/api/driver_experimental/public/zex_common.h"
 
 namespace L0 {
 
@@ -35,6 +36,13 @@ zexDriverGetHostPointerBaseAddress(
     void **baseAddress          ///< [out] if not null, returns address of the base pointer of the imported pointer
 );
 
+ze_result_t ZE_APICALL
+zexDriverGetApiLatencyHistogram(
+    ze_driver_handle_t hDriver,             ///< [in] handle of the driver
+    const char *pEntryPointName,            ///< [in] name of L0 or OpenCL entry point, e.g. "zeCommandListAppendLaunchKernel" or "clEnqueueNDRangeKernel"
+    zex_api_latency_histogram_t *pHistogram ///< [out] host latency histogram of entry point merged from all threads of the process
+);
+
 } // namespace L0
 
 #endif // _ZEX_DRIVER_H
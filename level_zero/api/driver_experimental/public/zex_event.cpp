@@ -42,6 +42,24 @@ zexEventGetDeviceAddress(ze_event_handle_t event, uint64_t *completionValue, uin
     return ZE_RESULT_SUCCESS;
 }
 
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventHostSynchronizeMultiple(uint32_t numEvents, ze_event_handle_t *phEvents, ze_bool_t waitAll, uint64_t timeout, uint32_t *pSignaledEventIndex) {
+    if (numEvents == 0 || !phEvents) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    StackVec<Event *, 16> events;
+    for (uint32_t i = 0; i < numEvents; i++) {
+        auto eventObj = Event::fromHandle(toInternalType(phEvents[i]));
+        if (!eventObj) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        events.push_back(eventObj);
+    }
+
+    return Event::hostSynchronizeMultiple(numEvents, events.data(), !!waitAll, timeout, pSignaledEventIndex);
+}
+
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zexCounterBasedEventCreate(ze_context_handle_t hContext, ze_device_handle_t hDevice, uint64_t *deviceAddress, uint64_t *hostAddress, uint64_t completionValue, const ze_event_desc_t *desc, ze_event_handle_t *phEvent) {
     constexpr uint32_t counterBasedFlags = (ZE_EVENT_POOL_COUNTER_BASED_EXP_FLAG_IMMEDIATE | ZE_EVENT_POOL_COUNTER_BASED_EXP_FLAG_NON_IMMEDIATE);
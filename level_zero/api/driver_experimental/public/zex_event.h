@@ -27,6 +27,16 @@ zexCounterBasedEventCreate(
     const ze_event_desc_t *desc,
     ze_event_handle_t *phEvent);
 
+// Waits on host until any (waitAll == false) or all of given events are signaled, polling them in a single loop.
+// On success of wait-any, index of signaled event is returned in pSignaledEventIndex, if provided.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventHostSynchronizeMultiple(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    ze_bool_t waitAll,
+    uint64_t timeout,
+    uint32_t *pSignaledEventIndex);
+
 ZE_APIEXPORT ze_result_t ZE_APICALL zexIntelAllocateNetworkInterrupt(ze_context_handle_t hContext, uint32_t &networkInterruptId);
 
 ZE_APIEXPORT ze_result_t ZE_APICALL zexIntelReleaseNetworkInterrupt(ze_context_handle_t hContext, uint32_t networkInterruptId);
@@ -27,6 +27,9 @@ enum class Builtin : uint32_t {
     copyBufferToBufferMiddle,
     copyBufferToBufferMiddleStateless,
     copyBufferToBufferMiddleStatelessHeapless,
+    copyBufferToBufferMiddleGridStride,
+    copyBufferToBufferMiddleGridStrideStateless,
+    copyBufferToBufferMiddleGridStrideStatelessHeapless,
     copyBufferToBufferSide,
     copyBufferToBufferSideStateless,
     copyBufferToBufferSideStatelessHeapless,
@@ -111,6 +114,22 @@ constexpr Builtin adjustBuiltinType<Builtin::copyBufferToBufferMiddle>(const boo
     return Builtin::copyBufferToBufferMiddle;
 }
 
+template <>
+constexpr Builtin adjustBuiltinType<Builtin::copyBufferToBufferMiddleGridStride>(const bool isStateless, const bool isHeapless) {
+    if (isHeapless) {
+        return Builtin::copyBufferToBufferMiddleGridStrideStatelessHeapless;
+    } else if (isStateless) {
+        return Builtin::copyBufferToBufferMiddleGridStrideStateless;
+    }
+    return Builtin::copyBufferToBufferMiddleGridStride;
+}
+
+constexpr bool isGridStrideBuiltin(Builtin type) {
+    return type == Builtin::copyBufferToBufferMiddleGridStride ||
+           type == Builtin::copyBufferToBufferMiddleGridStrideStateless ||
+           type == Builtin::copyBufferToBufferMiddleGridStrideStatelessHeapless;
+}
+
 template <>
 constexpr Builtin adjustBuiltinType<Builtin::copyBufferToBufferSide>(const bool isStateless, const bool isHeapless) {
     if (isHeapless) {
@@ -14,6 +14,8 @@
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/kernel/kernel.h"
 
+#include <algorithm>
+
 namespace NEO {
 const char *getAdditionalBuiltinAsString(EBuiltInOps::Type builtin) {
     return nullptr;
@@ -31,10 +33,7 @@ std::unique_lock<BuiltinFunctionsLib::MutexType> BuiltinFunctionsLib::obtainUniq
     return std::unique_lock<BuiltinFunctionsLib::MutexType>(this->ownershipMutex);
 }
 
-void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
-    const char *kernelName = nullptr;
-    NEO::EBuiltInOps::Type builtin;
-
+void BuiltinFunctionsLibImpl::getBuiltinKernelDesc(Builtin func, const char *&kernelName, NEO::EBuiltInOps::Type &builtin) {
     switch (func) {
     case Builtin::copyBufferBytes:
         kernelName = "copyBufferToBufferBytesSingle";
@@ -68,6 +67,18 @@ void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
         kernelName = "CopyBufferToBufferMiddleRegion";
         builtin = NEO::EBuiltInOps::copyBufferToBufferStatelessHeapless;
         break;
+    case Builtin::copyBufferToBufferMiddleGridStride:
+        kernelName = "CopyBufferToBufferMiddleRegionGridStride";
+        builtin = NEO::EBuiltInOps::copyBufferToBuffer;
+        break;
+    case Builtin::copyBufferToBufferMiddleGridStrideStateless:
+        kernelName = "CopyBufferToBufferMiddleRegionGridStride";
+        builtin = NEO::EBuiltInOps::copyBufferToBufferStateless;
+        break;
+    case Builtin::copyBufferToBufferMiddleGridStrideStatelessHeapless:
+        kernelName = "CopyBufferToBufferMiddleRegionGridStride";
+        builtin = NEO::EBuiltInOps::copyBufferToBufferStatelessHeapless;
+        break;
     case Builtin::copyBufferToBufferSide:
         kernelName = "CopyBufferToBufferSideRegion";
         builtin = NEO::EBuiltInOps::copyBufferToBuffer;
@@ -151,15 +162,18 @@ void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
     default:
         UNRECOVERABLE_IF(true);
     };
+}
+
+void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
+    const char *kernelName = nullptr;
+    NEO::EBuiltInOps::Type builtin;
+    getBuiltinKernelDesc(func, kernelName, builtin);
 
     auto builtId = static_cast<uint32_t>(func);
     builtins[builtId] = loadBuiltIn(builtin, kernelName);
 }
 
-void BuiltinFunctionsLibImpl::initBuiltinImageKernel(ImageBuiltin func) {
-    const char *builtinName = nullptr;
-    NEO::EBuiltInOps::Type builtin;
-
+void BuiltinFunctionsLibImpl::getImageBuiltinKernelDesc(ImageBuiltin func, const char *&builtinName, NEO::EBuiltInOps::Type &builtin) {
     switch (func) {
     case ImageBuiltin::copyBufferToImage3d16Bytes:
         builtinName = "CopyBufferToImage3d16Bytes";
@@ -208,13 +222,22 @@ void BuiltinFunctionsLibImpl::initBuiltinImageKernel(ImageBuiltin func) {
     default:
         UNRECOVERABLE_IF(true);
     };
+}
+
+void BuiltinFunctionsLibImpl::initBuiltinImageKernel(ImageBuiltin func) {
+    const char *builtinName = nullptr;
+    NEO::EBuiltInOps::Type builtin;
+    getImageBuiltinKernelDesc(func, builtinName, builtin);
 
     auto builtId = static_cast<uint32_t>(func);
     imageBuiltins[builtId] = loadBuiltIn(builtin, builtinName);
 }
 
 BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *builtInsLib) : device(device), builtInsLib(builtInsLib) {
-    if (initBuiltinsAsyncEnabled(device)) {
+    this->creationTime = std::chrono::steady_clock::now();
+    this->modules.resize(maxBuiltinModules);
+
+    if (initBuiltinsAsyncEnabled(device) && !prefetchBuiltinsEnabled()) {
         this->initAsyncComplete = false;
 
         auto initFunc = [this]() {
@@ -227,12 +250,32 @@ BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *
     }
 }
 
+template <typename LoadFuncT>
+bool BuiltinFunctionsLibImpl::loadOnce(std::once_flag &initFlag, LoadFuncT &&loadFunc) {
+    bool loaded = false;
+    std::call_once(initFlag, [&]() {
+        loadFunc();
+        loaded = true;
+    });
+    return loaded;
+}
+
 Kernel *BuiltinFunctionsLibImpl::getFunction(Builtin func) {
     auto builtId = static_cast<uint32_t>(func);
+    const bool trackRequest = isFirstFunctionRequestTracked();
+    std::chrono::steady_clock::time_point requestStart;
+    if (trackRequest) {
+        requestStart = std::chrono::steady_clock::now();
+    }
 
     this->ensureInitCompletion();
-    if (builtins[builtId].get() == nullptr) {
-        initBuiltinKernel(func);
+    loadOnce(builtinInitFlags[builtId], [&]() {
+        if (builtins[builtId].get() == nullptr) {
+            initBuiltinKernel(func);
+        }
+    });
+    if (trackRequest) {
+        recordFunctionRequest(requestStart);
     }
 
     return builtins[builtId]->func.get();
@@ -240,15 +283,151 @@ Kernel *BuiltinFunctionsLibImpl::getFunction(Builtin func) {
 
 Kernel *BuiltinFunctionsLibImpl::getImageFunction(ImageBuiltin func) {
     auto builtId = static_cast<uint32_t>(func);
+    const bool trackRequest = isFirstFunctionRequestTracked();
+    std::chrono::steady_clock::time_point requestStart;
+    if (trackRequest) {
+        requestStart = std::chrono::steady_clock::now();
+    }
 
     this->ensureInitCompletion();
-    if (imageBuiltins[builtId].get() == nullptr) {
-        initBuiltinImageKernel(func);
+    loadOnce(imageBuiltinInitFlags[builtId], [&]() {
+        if (imageBuiltins[builtId].get() == nullptr) {
+            initBuiltinImageKernel(func);
+        }
+    });
+    if (trackRequest) {
+        recordFunctionRequest(requestStart);
     }
 
     return imageBuiltins[builtId]->func.get();
 }
 
+bool BuiltinFunctionsLibImpl::isFirstFunctionRequestTracked() const {
+    // first request latency is only reported for prefetch, so later requests skip the clock reads
+    return this->trackFirstFunctionRequest && !this->firstFunctionRequested.load(std::memory_order_relaxed);
+}
+
+void BuiltinFunctionsLibImpl::recordFunctionRequest(std::chrono::steady_clock::time_point requestStart) {
+    if (this->firstFunctionRequested.exchange(true)) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    this->firstFunctionWaitNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - requestStart).count());
+    this->timeToFirstFunctionNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - this->creationTime).count());
+    PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stdout, "Builtins: first function available %llu ns after init, request waited %llu ns, prefetched %u\n",
+                       static_cast<unsigned long long>(this->timeToFirstFunctionNs.load()), static_cast<unsigned long long>(this->firstFunctionWaitNs.load()), this->prefetchedBuiltins.load());
+}
+
+bool BuiltinFunctionsLibImpl::prefetchBuiltinsEnabled() {
+    return NEO::debugManager.flags.PrefetchBuiltinsInBackground.get() == 1;
+}
+
+bool BuiltinFunctionsLibImpl::isBuiltinOpNeeded(NEO::EBuiltInOps::Type builtin, bool heaplessEnabled) {
+    if (NEO::EBuiltInOps::isHeapless(builtin)) {
+        return heaplessEnabled;
+    }
+    if (heaplessEnabled) {
+        // buffer copies and fills are dispatched with heapless variants only
+        switch (builtin) {
+        case NEO::EBuiltInOps::copyBufferToBuffer:
+        case NEO::EBuiltInOps::copyBufferToBufferStateless:
+        case NEO::EBuiltInOps::copyBufferRect:
+        case NEO::EBuiltInOps::copyBufferRectStateless:
+        case NEO::EBuiltInOps::fillBuffer:
+        case NEO::EBuiltInOps::fillBufferStateless:
+            return false;
+        default:
+            break;
+        }
+    }
+    return true;
+}
+
+void BuiltinFunctionsLibImpl::prefetchBuiltins() {
+    UNRECOVERABLE_IF(!prefetchThreads.empty());
+
+    const bool heaplessEnabled = device->getCompilerProductHelper().isHeaplessModeEnabled();
+    const bool imageSupport = device->getNEODevice()->getDeviceInfo().imageSupport;
+
+    auto getGroup = [this](NEO::EBuiltInOps::Type builtinOp) -> PrefetchGroup & {
+        for (auto &group : prefetchGroups) {
+            if (group.builtinOp == builtinOp) {
+                return group;
+            }
+        }
+        prefetchGroups.emplace_back();
+        prefetchGroups.back().builtinOp = builtinOp;
+        return prefetchGroups.back();
+    };
+
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::count); builtId++) {
+        const char *kernelName = nullptr;
+        NEO::EBuiltInOps::Type builtinOp;
+        getBuiltinKernelDesc(static_cast<Builtin>(builtId), kernelName, builtinOp);
+        if (isBuiltinOpNeeded(builtinOp, heaplessEnabled)) {
+            getGroup(builtinOp).builtinFunctions.push_back(static_cast<Builtin>(builtId));
+        }
+    }
+    if (imageSupport) {
+        for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(ImageBuiltin::count); builtId++) {
+            const char *kernelName = nullptr;
+            NEO::EBuiltInOps::Type builtinOp;
+            getImageBuiltinKernelDesc(static_cast<ImageBuiltin>(builtId), kernelName, builtinOp);
+            if (isBuiltinOpNeeded(builtinOp, heaplessEnabled)) {
+                getGroup(builtinOp).imageFunctions.push_back(static_cast<ImageBuiltin>(builtId));
+            }
+        }
+    }
+
+    auto numThreads = std::min(static_cast<uint32_t>(prefetchGroups.size()), std::max(1u, std::min(std::thread::hardware_concurrency(), maxPrefetchThreads)));
+    this->trackFirstFunctionRequest = true;
+    this->prefetchStartTime = std::chrono::steady_clock::now();
+    this->activePrefetchThreads.store(numThreads);
+    for (uint32_t i = 0; i < numThreads; i++) {
+        prefetchThreads.emplace_back([this]() { this->prefetchWorker(); });
+    }
+}
+
+void BuiltinFunctionsLibImpl::prefetchWorker() {
+    // each worker takes whole modules, so modules are built in parallel and kernels of a module are created by one thread
+    for (auto groupIndex = nextPrefetchGroup++; groupIndex < prefetchGroups.size(); groupIndex = nextPrefetchGroup++) {
+        auto &group = prefetchGroups[groupIndex];
+        for (auto func : group.builtinFunctions) {
+            auto builtId = static_cast<uint32_t>(func);
+            if (loadOnce(builtinInitFlags[builtId], [&]() { initBuiltinKernel(func); })) {
+                prefetchedBuiltins++;
+            }
+        }
+        for (auto func : group.imageFunctions) {
+            auto builtId = static_cast<uint32_t>(func);
+            if (loadOnce(imageBuiltinInitFlags[builtId], [&]() { initBuiltinImageKernel(func); })) {
+                prefetchedBuiltins++;
+            }
+        }
+    }
+
+    if (--activePrefetchThreads == 0) {
+        this->prefetchTimeNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->prefetchStartTime).count());
+    }
+}
+
+void BuiltinFunctionsLibImpl::waitForPrefetchCompletion() {
+    for (auto &thread : prefetchThreads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+BuiltinPrefetchStatistics BuiltinFunctionsLibImpl::getPrefetchStatistics() const {
+    BuiltinPrefetchStatistics statistics;
+    statistics.prefetchedBuiltins = prefetchedBuiltins.load();
+    statistics.prefetchTimeNs = prefetchTimeNs.load();
+    statistics.timeToFirstFunctionNs = timeToFirstFunctionNs.load();
+    statistics.firstFunctionWaitNs = firstFunctionWaitNs.load();
+    return statistics;
+}
+
 std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::loadBuiltIn(NEO::EBuiltInOps::Type builtin, const char *builtInName) {
     using BuiltInCodeType = NEO::BuiltinCode::ECodeType;
 
@@ -277,11 +456,8 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
 
     [[maybe_unused]] ze_result_t res;
 
-    if (this->modules.size() <= builtin) {
-        this->modules.resize(builtin + 1u);
-    }
-
-    if (this->modules[builtin].get() == nullptr) {
+    UNRECOVERABLE_IF(builtin >= maxBuiltinModules);
+    std::call_once(moduleInitFlags[builtin], [&]() {
         std::unique_ptr<Module> module;
         ze_module_handle_t moduleHandle;
         ze_module_desc_t moduleDesc = {};
@@ -293,7 +469,7 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
 
         module.reset(Module::fromHandle(moduleHandle));
         this->modules[builtin] = std::move(module);
-    }
+    });
 
     std::unique_ptr<Kernel> kernel;
     ze_kernel_handle_t kernelHandle;
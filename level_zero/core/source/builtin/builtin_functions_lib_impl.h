@@ -6,16 +6,19 @@
  */
 
 #pragma once
+#include "shared/source/built_ins/built_in_ops_base.h"
+
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
 #include "level_zero/core/source/module/module.h"
 
+#include <atomic>
+#include <chrono>
 #include <future>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace NEO {
-namespace EBuiltInOps {
-using Type = uint32_t;
-}
 class BuiltIns;
 } // namespace NEO
 
@@ -23,11 +26,19 @@ namespace L0 {
 struct Kernel;
 struct Device;
 
+struct BuiltinPrefetchStatistics {
+    uint32_t prefetchedBuiltins = 0u;
+    uint64_t prefetchTimeNs = 0u;
+    uint64_t timeToFirstFunctionNs = 0u;
+    uint64_t firstFunctionWaitNs = 0u;
+};
+
 struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
     struct BuiltinData;
     BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *builtInsLib);
     ~BuiltinFunctionsLibImpl() override {
         this->ensureInitCompletionImpl();
+        this->waitForPrefetchCompletion();
         builtins->reset();
         imageBuiltins->reset();
     }
@@ -41,16 +52,56 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
     MOCKABLE_VIRTUAL std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> loadBuiltIn(NEO::EBuiltInOps::Type builtin, const char *builtInName);
 
     static bool initBuiltinsAsyncEnabled(Device *device);
+    static bool prefetchBuiltinsEnabled();
+
+    void prefetchBuiltins();
+    void waitForPrefetchCompletion();
+    BuiltinPrefetchStatistics getPrefetchStatistics() const;
 
   protected:
+    struct PrefetchGroup {
+        NEO::EBuiltInOps::Type builtinOp = 0u;
+        std::vector<Builtin> builtinFunctions;
+        std::vector<ImageBuiltin> imageFunctions;
+    };
+
+    static constexpr uint32_t maxBuiltinModules = NEO::EBuiltInOps::queryKernelTimestamps + 1u;
+    static constexpr uint32_t maxPrefetchThreads = 4u;
+
+    static void getBuiltinKernelDesc(Builtin func, const char *&kernelName, NEO::EBuiltInOps::Type &builtin);
+    static void getImageBuiltinKernelDesc(ImageBuiltin func, const char *&kernelName, NEO::EBuiltInOps::Type &builtin);
+    static bool isBuiltinOpNeeded(NEO::EBuiltInOps::Type builtin, bool heaplessEnabled);
+
+    template <typename LoadFuncT>
+    bool loadOnce(std::once_flag &initFlag, LoadFuncT &&loadFunc);
+    void prefetchWorker();
+    bool isFirstFunctionRequestTracked() const;
+    void recordFunctionRequest(std::chrono::steady_clock::time_point requestStart);
+
     std::vector<std::unique_ptr<Module>> modules = {};
+    std::once_flag moduleInitFlags[maxBuiltinModules];
     std::unique_ptr<BuiltinData> builtins[static_cast<uint32_t>(Builtin::count)];
     std::unique_ptr<BuiltinData> imageBuiltins[static_cast<uint32_t>(ImageBuiltin::count)];
+    std::once_flag builtinInitFlags[static_cast<uint32_t>(Builtin::count)];
+    std::once_flag imageBuiltinInitFlags[static_cast<uint32_t>(ImageBuiltin::count)];
     Device *device;
     NEO::BuiltIns *builtInsLib;
 
     bool initAsyncComplete = true;
     std::atomic_bool initAsync = false;
+
+    std::vector<PrefetchGroup> prefetchGroups;
+    std::vector<std::thread> prefetchThreads;
+    std::atomic<size_t> nextPrefetchGroup{0u};
+    std::atomic<uint32_t> activePrefetchThreads{0u};
+    std::atomic<uint32_t> prefetchedBuiltins{0u};
+    std::atomic<uint64_t> prefetchTimeNs{0u};
+    bool trackFirstFunctionRequest = false;
+    std::atomic_bool firstFunctionRequested{false};
+    std::atomic<uint64_t> timeToFirstFunctionNs{0u};
+    std::atomic<uint64_t> firstFunctionWaitNs{0u};
+    std::chrono::steady_clock::time_point creationTime;
+    std::chrono::steady_clock::time_point prefetchStartTime;
 };
 struct BuiltinFunctionsLibImpl::BuiltinData {
     MOCKABLE_VIRTUAL ~BuiltinData();
@@ -24,9 +24,14 @@
 #include "level_zero/core/source/kernel/kernel.h"
 #include "level_zero/core/source/kernel/kernel_imp.h"
 
+#include <atomic>
+
 namespace L0 {
 
 CommandList::~CommandList() {
+    if (flushCoalescingController) {
+        flushCoalescingController->unregisterCommandList(this);
+    }
     if (cmdQImmediate) {
         cmdQImmediate->destroy();
     }
@@ -41,6 +46,11 @@ CommandList::~CommandList() {
     printfKernelContainer.clear();
 }
 
+void CommandList::updateExecutionGeneration() {
+    static std::atomic<uint64_t> executionGenerationCounter{0};
+    executionGeneration = ++executionGenerationCounter;
+}
+
 void CommandList::storePrintfKernel(Kernel *kernel) {
     auto it = std::find_if(this->printfKernelContainer.begin(), this->printfKernelContainer.end(), [&kernel](const auto &kernelWeakPtr) { return kernelWeakPtr.lock().get() == kernel; });
 
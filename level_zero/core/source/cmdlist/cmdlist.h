@@ -43,6 +43,7 @@ struct EventPool;
 struct Event;
 struct Kernel;
 struct CommandQueue;
+class FlushCoalescingController;
 
 struct CmdListReturnPoint {
     NEO::StreamProperties configSnapshot;
@@ -171,6 +172,9 @@ struct CommandList : _ze_command_list_handle_t {
     virtual ze_result_t appendWriteToMemory(void *desc, void *ptr,
                                             uint64_t data) = 0;
     virtual ze_result_t hostSynchronize(uint64_t timeout) = 0;
+    virtual ze_result_t flushPendingAppends() { return ZE_RESULT_SUCCESS; }
+    virtual void flushPendingAppendsIfTimeoutReached() {}
+    virtual void flushPendingAppendsAndRecordError() {}
 
     virtual ze_result_t getDeviceHandle(ze_device_handle_t *phDevice) = 0;
     virtual ze_result_t getContextHandle(ze_context_handle_t *phContext) = 0;
@@ -245,6 +249,17 @@ struct CommandList : _ze_command_list_handle_t {
         return this->printfKernelContainer;
     }
 
+    const std::vector<CommandList *> &getSegments() const {
+        return segments;
+    }
+    // segments are closed, reset and destroyed only through their parent
+    bool isSegment() const {
+        return parentCommandList != nullptr;
+    }
+    void setParentCommandList(CommandList *parent) {
+        parentCommandList = parent;
+    }
+
     void storePrintfKernel(Kernel *kernel);
     void removeDeallocationContainerData();
     void removeHostPtrAllocations();
@@ -397,6 +412,11 @@ struct CommandList : _ze_command_list_handle_t {
 
     void registerCsrDcFlushForDcMitigation(NEO::CommandStreamReceiver &csr);
 
+    uint64_t getExecutionGeneration() const {
+        return executionGeneration;
+    }
+    void updateExecutionGeneration();
+
   protected:
     NEO::GraphicsAllocation *getAllocationFromHostPtrMap(const void *buffer, uint64_t bufferSize, bool copyOffload);
     NEO::GraphicsAllocation *getHostPtrAlloc(const void *buffer, uint64_t bufferSize, bool hostCopyAllowed, bool copyOffload);
@@ -411,6 +431,8 @@ struct CommandList : _ze_command_list_handle_t {
     NEO::PrivateAllocsToReuseContainer ownedPrivateAllocations;
     std::vector<NEO::GraphicsAllocation *> patternAllocations;
     std::vector<std::weak_ptr<Kernel>> printfKernelContainer;
+    std::vector<CommandList *> segments;
+    CommandList *parentCommandList = nullptr;
 
     NEO::CommandContainer commandContainer;
 
@@ -429,10 +451,12 @@ struct CommandList : _ze_command_list_handle_t {
     int64_t currentBindingTablePoolBaseAddress = NEO::StreamProperty64::initValue;
 
     uint64_t currentScratchPatchAddress = 0;
+    uint64_t executionGeneration = 0;
 
     ze_context_handle_t hContext = nullptr;
     CommandQueue *cmdQImmediate = nullptr;
     CommandQueue *cmdQImmediateCopyOffload = nullptr;
+    FlushCoalescingController *flushCoalescingController = nullptr;
     Device *device = nullptr;
     NEO::ScratchSpaceController *usedScratchController = nullptr;
 
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/cmdlist/cmdlist_flush_coalescing_controller.h"
+
+#include "level_zero/core/source/cmdlist/cmdlist.h"
+
+#include <algorithm>
+
+namespace L0 {
+
+FlushCoalescingController::FlushCoalescingController(std::chrono::microseconds checkPeriod) : checkPeriod(checkPeriod) {
+    thread = std::thread([this]() { run(); });
+}
+
+FlushCoalescingController::~FlushCoalescingController() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    condition.notify_one();
+    thread.join();
+}
+
+void FlushCoalescingController::registerCommandList(CommandList *cmdList) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (std::find(cmdLists.begin(), cmdLists.end(), cmdList) == cmdLists.end()) {
+        cmdLists.push_back(cmdList);
+    }
+}
+
+void FlushCoalescingController::unregisterCommandList(CommandList *cmdList) {
+    std::lock_guard<std::mutex> lock(mutex);
+    cmdLists.erase(std::remove(cmdLists.begin(), cmdLists.end(), cmdList), cmdLists.end());
+}
+
+void FlushCoalescingController::flushAll() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto cmdList : cmdLists) {
+        cmdList->flushPendingAppendsAndRecordError();
+    }
+}
+
+void FlushCoalescingController::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopRequested) {
+        condition.wait_for(lock, checkPeriod);
+        if (stopRequested) {
+            break;
+        }
+        for (auto cmdList : cmdLists) {
+            cmdList->flushPendingAppendsIfTimeoutReached();
+        }
+    }
+}
+
+} // namespace L0
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace L0 {
+struct CommandList;
+
+// Background trigger submitting appends deferred by immediate command list flush coalescing
+// once they are pending longer than the coalescing timeout, so they are not held back
+// when the application stops appending. Flush failures are kept by the command list and
+// returned from its next kernel append or host synchronization.
+class FlushCoalescingController : NEO::NonCopyableOrMovableClass {
+  public:
+    FlushCoalescingController(std::chrono::microseconds checkPeriod);
+    virtual ~FlushCoalescingController();
+
+    void registerCommandList(CommandList *cmdList);
+    void unregisterCommandList(CommandList *cmdList);
+    void flushAll();
+
+  protected:
+    void run();
+
+    std::vector<CommandList *> cmdLists;
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::thread thread;
+    const std::chrono::microseconds checkPeriod;
+    bool stopRequested = false;
+};
+
+} // namespace L0
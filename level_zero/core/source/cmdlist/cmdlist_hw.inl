@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/built_ins/buffer_builtin_variant.h"
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_container/encode_surface_state.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
@@ -107,6 +108,7 @@ void CommandListCoreFamily<gfxCoreFamily>::postInitComputeSetup() {
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
+    this->destroySegments();
     removeDeallocationContainerData();
     removeHostPtrAllocations();
     removeMemoryPrefetchAllocations();
@@ -156,6 +158,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     lastAppendedKernelBindlessMode = false;
 
     this->inOrderPatchCmds.clear();
+    updateExecutionGeneration();
 
     return ZE_RESULT_SUCCESS;
 }
@@ -360,12 +363,14 @@ inline ze_result_t CommandListCoreFamily<gfxCoreFamily>::executeCommandListImmed
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::close() {
+    this->closeSegments();
     commandContainer.removeDuplicatesFromResidencyContainer();
     if (this->dispatchCmdListBatchBufferAsPrimary) {
         commandContainer.endAlignedPrimaryBuffer();
     } else {
         NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferEnd(commandContainer);
     }
+    updateExecutionGeneration();
 
     return ZE_RESULT_SUCCESS;
 }
@@ -1266,6 +1271,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopyKernelWithGA(v
     builtinKernel->setArgumentValue(4, sizeof(srcOffset), &srcOffset);
 
     uint32_t groups = static_cast<uint32_t>((size + ((static_cast<uint64_t>(groupSizeX) * elementSize) - 1)) / (static_cast<uint64_t>(groupSizeX) * elementSize));
+    if (BuiltinTypeHelper::isGridStrideBuiltin(builtin)) {
+        auto workItems = NEO::BufferBuiltinVariantHelper::getGridStrideWorkItemsCount(static_cast<size_t>(elems), groupSizeX, device->getHwInfo());
+        groups = static_cast<uint32_t>(Math::divideAndRoundUp(workItems, groupSizeX));
+    }
     ze_group_count_t dispatchKernelArgs{groups, 1u, 1u};
 
     auto dstAllocationType = dstPtrAlloc->getAllocationType();
@@ -1581,6 +1590,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(void *dstptr,
         if (ret == ZE_RESULT_SUCCESS && middleSizeBytes) {
 
             Builtin copyKernel = BuiltinTypeHelper::adjustBuiltinType<Builtin::copyBufferToBufferMiddle>(isStateless, isHeapless);
+            if (NEO::BufferBuiltinVariantHelper::selectVariant(middleSizeBytes) == NEO::BufferBuiltinVariant::gridStride) {
+                copyKernel = BuiltinTypeHelper::adjustBuiltinType<Builtin::copyBufferToBufferMiddleGridStride>(isStateless, isHeapless);
+            }
 
             ret = appendMemoryCopyKernelWithGA(reinterpret_cast<void *>(&dstAllocationStruct.alignedAllocationPtr),
                                                dstAllocationStruct.alloc, leftSize + dstAllocationStruct.offset,
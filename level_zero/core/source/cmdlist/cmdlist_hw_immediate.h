@@ -13,7 +13,9 @@
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 
 #include <atomic>
+#include <chrono>
 #include <functional>
+#include <mutex>
 
 namespace NEO {
 struct SvmAllocationData;
@@ -39,6 +41,28 @@ struct CpuMemCopyInfo {
     CpuMemCopyInfo(void *dstPtr, void *srcPtr, size_t size) : dstPtr(dstPtr), srcPtr(srcPtr), size(size) {}
 };
 
+struct FlushCoalescingKernelState {
+    uint32_t numGrfRequired = 0;
+    int32_t threadArbitrationPolicy = 0;
+    bool isCooperative = false;
+    bool fusedEuDisabled = false;
+    bool systolicMode = false;
+    bool uncachedMocs = false;
+    bool bindlessMode = false;
+    bool slmEnabled = false;
+
+    bool operator==(const FlushCoalescingKernelState &other) const {
+        return numGrfRequired == other.numGrfRequired &&
+               threadArbitrationPolicy == other.threadArbitrationPolicy &&
+               isCooperative == other.isCooperative &&
+               fusedEuDisabled == other.fusedEuDisabled &&
+               systolicMode == other.systolicMode &&
+               uncachedMocs == other.uncachedMocs &&
+               bindlessMode == other.bindlessMode &&
+               slmEnabled == other.slmEnabled;
+    }
+};
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFamily> {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
@@ -55,6 +79,9 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
 
     using ComputeFlushMethodType = NEO::CompletionStamp (CommandListCoreFamilyImmediate<gfxCoreFamily>::*)(NEO::LinearStream &, size_t, bool, bool, bool, bool);
 
+    static constexpr uint32_t defaultFlushCoalescingMaxAppends = 16;
+    static constexpr int64_t defaultFlushCoalescingTimeoutUs = 100;
+
     CommandListCoreFamilyImmediate(uint32_t numIddsPerBlock);
 
     ze_result_t appendLaunchKernel(ze_kernel_handle_t kernelHandle,
@@ -174,6 +201,10 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
                                     uint64_t data) override;
 
     ze_result_t hostSynchronize(uint64_t timeout) override;
+    ze_result_t flushPendingAppends() override;
+    void flushPendingAppendsIfTimeoutReached() override;
+    void flushPendingAppendsAndRecordError() override;
+    ze_result_t reset() override;
 
     ze_result_t close() override {
         return ZE_RESULT_SUCCESS;
@@ -193,10 +224,13 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     void handleHeapsAndResidencyForImmediateRegularTask(void *&sshCpuBaseAddress);
     void handleDebugSurfaceStateUpdate(NEO::IndirectHeap *ssh);
 
-    void checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies, size_t commandSize);
+    void checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies, size_t commandSize, bool coalescedFlush = false);
     void updateDispatchFlagsWithRequiredStreamState(NEO::DispatchFlags &dispatchFlags);
 
     MOCKABLE_VIRTUAL ze_result_t flushImmediate(ze_result_t inputRet, bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, bool copyOffloadSubmission, ze_event_handle_t hSignalEvent, bool requireTaskCountUpdate);
+    bool isFlushCoalescingSupported() const;
+    bool isFlushCoalescingAllowed(Kernel *kernel, const ze_group_count_t &threadGroupDimensions, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
+                                  const CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch);
 
     bool preferCopyThroughLockedPtr(CpuMemCopyInfo &cpuMemCopyInfo, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
     bool isSuitableUSMHostAlloc(NEO::SvmAllocationData *alloc);
@@ -221,10 +255,22 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     void setupFlushMethod(const NEO::RootDeviceEnvironment &rootDeviceEnvironment) override;
     void allocateOrReuseKernelPrivateMemoryIfNeeded(Kernel *kernel, uint32_t sizePerHwThread) override;
     void handleInOrderNonWalkerSignaling(Event *event, bool &hasStallingCmds, bool &relaxedOrderingDispatch, ze_result_t &result);
+    bool isFlushCoalescingTimeoutReached() const;
+    void registerForFlushCoalescing();
+    void recordDeferredFlushError(ze_result_t status);
+    ze_result_t takeDeferredFlushError();
 
     MOCKABLE_VIRTUAL void checkAssert();
     ComputeFlushMethodType computeFlushMethod = nullptr;
     std::atomic<bool> dependenciesPresent{false};
+    std::recursive_mutex flushCoalescingMutex; // guards pending appends against the flush coalescing controller thread
+    std::chrono::steady_clock::time_point pendingFlushStartTime;
+    FlushCoalescingKernelState pendingFlushKernelState;
+    int64_t flushCoalescingTimeoutUs = 0;
+    uint32_t flushCoalescingMaxAppends = 0;
+    uint32_t pendingFlushAppends = 0;
+    ze_result_t deferredFlushError = ZE_RESULT_SUCCESS; // first failure of a flush done by the flush coalescing controller
+    bool pendingFlushHasStallingCmds = false;
     bool latestFlushIsHostVisible = false;
     bool latestFlushIsCopyOffload = false;
 };
@@ -48,15 +48,33 @@ namespace L0 {
 template <GFXCORE_FAMILY gfxCoreFamily>
 CommandListCoreFamilyImmediate<gfxCoreFamily>::CommandListCoreFamilyImmediate(uint32_t numIddsPerBlock) : BaseClass(numIddsPerBlock) {
     computeFlushMethod = &CommandListCoreFamilyImmediate<gfxCoreFamily>::flushRegularTask;
+
+    if (NEO::debugManager.flags.EnableImmediateCmdListFlushCoalescing.get() == 1) {
+        flushCoalescingMaxAppends = defaultFlushCoalescingMaxAppends;
+        if (NEO::debugManager.flags.ImmediateCmdListFlushCoalescingMaxAppends.get() != -1) {
+            flushCoalescingMaxAppends = static_cast<uint32_t>(NEO::debugManager.flags.ImmediateCmdListFlushCoalescingMaxAppends.get());
+        }
+        // Deferred appends always have a time limit, otherwise they could be held back until the next synchronization
+        flushCoalescingTimeoutUs = defaultFlushCoalescingTimeoutUs;
+        if (NEO::debugManager.flags.ImmediateCmdListFlushCoalescingTimeoutUs.get() > 0) {
+            flushCoalescingTimeoutUs = NEO::debugManager.flags.ImmediateCmdListFlushCoalescingTimeoutUs.get();
+        }
+    }
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
-void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies, size_t commandSize) {
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies, size_t commandSize, bool coalescedFlush) {
     this->commandContainer.fillReusableAllocationLists();
 
+    // Deferred appends are only submitted together with appends allowed to join them
+    if (!coalescedFlush) {
+        flushPendingAppends();
+    }
+
     /* Command container might has two command buffers. If it has, one is in local memory, because relaxed ordering requires that and one in system for copying it into ring buffer.
        If relaxed ordering is needed in given dispatch and current command stream is in system memory, swap of command streams is required to ensure local memory. Same in the opposite scenario. */
     if (hasRelaxedOrderingDependencies == NEO::MemoryPoolHelper::isSystemMemoryPool(this->commandContainer.getCommandStream()->getGraphicsAllocation()->getMemoryPool())) {
+        flushPendingAppends();
         if (this->commandContainer.swapStreams()) {
             this->cmdListCurrentStartOffset = this->commandContainer.getCommandStream()->getUsed();
         }
@@ -64,6 +82,7 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t
 
     size_t semaphoreSize = NEO::EncodeSemaphore<GfxFamily>::getSizeMiSemaphoreWait() * numEvents;
     if (this->commandContainer.getCommandStream()->getAvailableSpace() < commandSize + semaphoreSize) {
+        flushPendingAppends();
         bool requireSystemMemoryCommandBuffer = !hasRelaxedOrderingDependencies;
 
         auto alloc = this->commandContainer.reuseExistingCmdBuffer(requireSystemMemoryCommandBuffer);
@@ -513,10 +532,23 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
     CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
 
+    std::unique_lock<std::recursive_mutex> flushCoalescingLock;
+    if (this->flushCoalescingMaxAppends > 0) {
+        registerForFlushCoalescing();
+        flushCoalescingLock = std::unique_lock<std::recursive_mutex>(this->flushCoalescingMutex);
+
+        auto status = takeDeferredFlushError();
+        if (status != ZE_RESULT_SUCCESS) {
+            return status;
+        }
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
     bool stallingCmdsForRelaxedOrdering = hasStallingCmdsForRelaxedOrdering(numWaitEvents, relaxedOrderingDispatch);
 
-    checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
+    bool coalescedFlush = isFlushCoalescingAllowed(Kernel::fromHandle(kernelHandle), threadGroupDimensions, hSignalEvent, numWaitEvents, launchParams, relaxedOrderingDispatch);
+
+    checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize, coalescedFlush);
     bool hostWait = waitForEventsFromHost();
     if (hostWait) {
         this->synchronizeEventList(numWaitEvents, phWaitEvents);
@@ -540,9 +572,162 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
         CommandListCoreFamily<gfxCoreFamily>::handleInOrderDependencyCounter(event, true, false);
     }
 
+    if (coalescedFlush && ret == ZE_RESULT_SUCCESS) {
+        this->pendingFlushAppends++;
+        this->pendingFlushHasStallingCmds |= stallingCmdsForRelaxedOrdering;
+
+        if (this->pendingFlushAppends < this->flushCoalescingMaxAppends && !isFlushCoalescingTimeoutReached()) {
+            return ZE_RESULT_SUCCESS;
+        }
+        return flushPendingAppends();
+    }
+
     return flushImmediate(ret, true, stallingCmdsForRelaxedOrdering, relaxedOrderingDispatch, true, false, hSignalEvent, false);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isFlushCoalescingSupported() const {
+    return this->flushCoalescingMaxAppends > 0 && this->isFlushTaskSubmissionEnabled && !this->isSyncModeQueue &&
+           isInOrderExecutionEnabled() && !isCopyOnly() && !isCopyOffloadEnabled();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::registerForFlushCoalescing() {
+    // Must not be called with flushCoalescingMutex held, the controller thread locks in the opposite order
+    if (this->flushCoalescingController != nullptr || !isFlushCoalescingSupported()) {
+        return;
+    }
+    auto deviceImp = static_cast<DeviceImp *>(this->device);
+    this->flushCoalescingController = &deviceImp->getFlushCoalescingController(std::chrono::microseconds(this->flushCoalescingTimeoutUs));
+    this->flushCoalescingController->registerCommandList(this);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isFlushCoalescingAllowed(Kernel *kernel, const ze_group_count_t &threadGroupDimensions, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
+                                                                             const CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
+    if (!isFlushCoalescingSupported()) {
+        return false;
+    }
+
+    // Anything observable by the host or by other command lists is flushed immediately
+    if (kernel == nullptr || hSignalEvent || numWaitEvents > 0 || relaxedOrderingDispatch) {
+        return false;
+    }
+
+    auto kernelImp = static_cast<KernelImp *>(kernel);
+    auto &kernelDescriptor = kernel->getKernelDescriptor();
+    auto &kernelAttributes = kernelDescriptor.kernelAttributes;
+
+    // Deferred walkers must not be invalidated by heap or scratch reallocation before they are flushed
+    if (kernelAttributes.perThreadScratchSize[0] > 0 || kernelAttributes.perThreadScratchSize[1] > 0) {
+        return false;
+    }
+    if (this->cmdListHeapAddressModel != NEO::HeapAddressModel::globalStateless &&
+        (kernel->getSurfaceStateHeapDataSize() > 0 || kernelDescriptor.payloadMappings.samplerTable.numSamplers > 0)) {
+        return false;
+    }
+    if (!this->heaplessModeEnabled) {
+        auto ioh = this->commandContainer.getIndirectHeap(NEO::HeapType::indirectObject);
+        size_t iohRequiredSize = kernel->getCrossThreadDataSize() + kernel->getPerThreadDataSizeForWholeThreadGroup() + MemoryConstants::pageSize;
+        if (ioh == nullptr || ioh->getAvailableSpace() < iohRequiredSize) {
+            return false;
+        }
+    }
+    if (this->dynamicHeapRequired && !this->immediateCmdListHeapSharing && this->cmdListHeapAddressModel == NEO::HeapAddressModel::privateHeaps) {
+        auto dsh = this->commandContainer.getIndirectHeap(NEO::HeapType::dynamicState);
+        if (dsh == nullptr || dsh->getAvailableSpace() < MemoryConstants::pageSize) {
+            return false;
+        }
+    }
+
+    // All deferred appends are flushed with state of the last one, so they have to require the same state
+    FlushCoalescingKernelState kernelState;
+    kernelState.numGrfRequired = kernelAttributes.numGrfRequired;
+    kernelState.threadArbitrationPolicy = static_cast<int32_t>(kernelAttributes.threadArbitrationPolicy);
+    kernelState.isCooperative = launchParams.isCooperative;
+    kernelState.fusedEuDisabled = getFusedEuDisabled<gfxCoreFamily>(*kernel, this->device, threadGroupDimensions, launchParams.isIndirect);
+    kernelState.systolicMode = kernelAttributes.flags.usesSystolicPipelineSelectMode;
+    kernelState.uncachedMocs = kernelImp->getKernelRequiresUncachedMocs();
+    kernelState.bindlessMode = NEO::KernelDescriptor::isBindlessAddressingKernel(kernelDescriptor);
+    kernelState.slmEnabled = kernel->getSlmTotalSize() > 0;
+
+    if (this->pendingFlushAppends > 0 && !(kernelState == this->pendingFlushKernelState)) {
+        flushPendingAppends();
+    }
+
+    if (this->pendingFlushAppends == 0) {
+        this->pendingFlushKernelState = kernelState;
+        this->pendingFlushStartTime = std::chrono::steady_clock::now();
+    }
+
+    return true;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isFlushCoalescingTimeoutReached() const {
+    auto elapsedTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - this->pendingFlushStartTime);
+    return elapsedTime.count() >= this->flushCoalescingTimeoutUs;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushPendingAppends() {
+    if (this->flushCoalescingMaxAppends == 0) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(this->flushCoalescingMutex);
+    if (this->pendingFlushAppends == 0) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    bool hasStallingCmds = this->pendingFlushHasStallingCmds;
+    this->pendingFlushAppends = 0;
+    this->pendingFlushHasStallingCmds = false;
+
+    return flushImmediate(ZE_RESULT_SUCCESS, true, hasStallingCmds, false, true, false, nullptr, false);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::flushPendingAppendsIfTimeoutReached() {
+    // Skip if the owning thread is appending, the deferred appends are handled there
+    std::unique_lock<std::recursive_mutex> lock(this->flushCoalescingMutex, std::try_to_lock);
+    if (lock.owns_lock() && this->pendingFlushAppends > 0 && isFlushCoalescingTimeoutReached()) {
+        recordDeferredFlushError(flushPendingAppends());
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::flushPendingAppendsAndRecordError() {
+    std::lock_guard<std::recursive_mutex> lock(this->flushCoalescingMutex);
+    recordDeferredFlushError(flushPendingAppends());
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::recordDeferredFlushError(ze_result_t status) {
+    // Only the first failure is kept, later flushes usually fail as a consequence of it
+    if (status != ZE_RESULT_SUCCESS && this->deferredFlushError == ZE_RESULT_SUCCESS) {
+        this->deferredFlushError = status;
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::takeDeferredFlushError() {
+    if (this->flushCoalescingMaxAppends == 0) {
+        return ZE_RESULT_SUCCESS;
+    }
+    std::lock_guard<std::recursive_mutex> lock(this->flushCoalescingMutex);
+    return std::exchange(this->deferredFlushError, ZE_RESULT_SUCCESS);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::reset() {
+    auto status = flushPendingAppends();
+    if (status != ZE_RESULT_SUCCESS) {
+        return status;
+    }
+    return BaseClass::reset();
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamilyImmediate<gfxCoreFamily>::handleInOrderNonWalkerSignaling(Event *event, bool &hasStallingCmds, bool &relaxedOrderingDispatch, ze_result_t &result) {
     bool nonWalkerSignalingHasRelaxedOrdering = false;
@@ -960,7 +1145,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteToMemory(v
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint64_t timeout, bool handlePostWaitOperations) {
-    ze_result_t status = ZE_RESULT_SUCCESS;
+    ze_result_t status = flushPendingAppends();
+    if (status == ZE_RESULT_SUCCESS) {
+        status = takeDeferredFlushError();
+    }
+    if (status != ZE_RESULT_SUCCESS) {
+        return status;
+    }
 
     auto waitQueue = this->cmdQImmediate;
 
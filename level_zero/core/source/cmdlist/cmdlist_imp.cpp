@@ -45,6 +45,14 @@ CommandListAllocatorFn commandListFactory[IGFX_MAX_PRODUCT] = {};
 CommandListAllocatorFn commandListFactoryImmediate[IGFX_MAX_PRODUCT] = {};
 
 ze_result_t CommandListImp::destroy() {
+    if (this->flushCoalescingController) {
+        this->flushCoalescingController->unregisterCommandList(this);
+        this->flushCoalescingController = nullptr;
+    }
+    flushPendingAppends();
+
+    destroySegments();
+
     if (this->isBcsSplitNeeded) {
         static_cast<DeviceImp *>(this->device)->bcsSplit.releaseResources();
     }
@@ -127,6 +135,54 @@ CommandList *CommandList::create(uint32_t productFamily, Device *device, NEO::En
     return commandList;
 }
 
+ze_result_t CommandListImp::createSegments(uint32_t numSegments, ze_command_list_handle_t *phSegments) {
+    if (isImmediateType() || isInOrderExecutionEnabled() || isSegment() || numSegments == 0 || phSegments == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto productFamily = device->getHwInfo().platform.eProductFamily;
+
+    std::vector<CommandList *> createdSegments;
+    createdSegments.reserve(numSegments);
+    for (uint32_t i = 0; i < numSegments; i++) {
+        ze_result_t returnValue = ZE_RESULT_SUCCESS;
+        auto segment = CommandList::create(productFamily, device, engineGroupType, flags, returnValue, internalUsage);
+        if (segment == nullptr) {
+            for (auto createdSegment : createdSegments) {
+                createdSegment->destroy();
+            }
+            return returnValue;
+        }
+        if (ordinal.has_value()) {
+            segment->setOrdinal(ordinal.value());
+        }
+        segment->setCmdListContext(getCmdListContext());
+        segment->setParentCommandList(this);
+
+        createdSegments.push_back(segment);
+    }
+
+    for (uint32_t i = 0; i < numSegments; i++) {
+        segments.push_back(createdSegments[i]);
+        phSegments[i] = createdSegments[i]->toHandle();
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+void CommandListImp::closeSegments() {
+    for (auto segment : segments) {
+        segment->close();
+    }
+}
+
+void CommandListImp::destroySegments() {
+    for (auto segment : segments) {
+        segment->destroy();
+    }
+    segments.clear();
+}
+
 ze_result_t CommandListImp::getDeviceHandle(ze_device_handle_t *phDevice) {
     *phDevice = getDevice()->toHandle();
     return ZE_RESULT_SUCCESS;
@@ -49,8 +49,12 @@ struct CommandListImp : public CommandList {
     void enableCopyOperationOffload(uint32_t productFamily, Device *device, const ze_command_queue_desc_t *desc);
     bool isCopyOffloadEnabled() const { return copyOperationOffloadEnabled; }
     void setInterruptEventsCsr(NEO::CommandStreamReceiver &csr);
+    ze_result_t createSegments(uint32_t numSegments, ze_command_list_handle_t *phSegments);
 
   protected:
+    void closeSegments();
+    void destroySegments();
+
     std::shared_ptr<NEO::InOrderExecInfo> inOrderExecInfo;
     NEO::SynchronizedDispatchMode synchronizedDispatchMode = NEO::SynchronizedDispatchMode::disabled;
     uint32_t syncDispatchQueueId = std::numeric_limits<uint32_t>::max();
@@ -23,6 +23,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
 
+#include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/device/device_imp.h"
@@ -33,6 +34,8 @@
 
 #include "igfxfmid.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 CommandQueueAllocatorFn commandQueueFactory[IGFX_MAX_PRODUCT] = {};
@@ -52,6 +55,11 @@ CommandQueueImp::CommandQueueImp(Device *device, NEO::CommandStreamReceiver *csr
     if (overrideUseKmdWaitFunction != -1) {
         useKmdWaitFunction = !!(overrideUseKmdWaitFunction);
     }
+
+    int enableExecutionPlanCache = NEO::debugManager.flags.EnableCommandQueueExecutionPlanCache.get();
+    if (enableExecutionPlanCache != -1) {
+        executionPlanCacheEnabled = !!(enableExecutionPlanCache);
+    }
 }
 
 ze_result_t CommandQueueImp::destroy() {
@@ -106,6 +114,61 @@ ze_result_t CommandQueueImp::initialize(bool copyOnly, bool isInternal, bool imm
     return returnValue;
 }
 
+ze_result_t CommandQueueImp::expandCommandListSegments(uint32_t &numCommandLists, ze_command_list_handle_t *&phCommandLists, CommandListsWithSegments &commandListsWithSegments) const {
+    bool hasSegments = false;
+    for (uint32_t i = 0; i < numCommandLists; i++) {
+        auto commandList = CommandList::fromHandle(phCommandLists[i]);
+        // segments are executed only right after their parent
+        if (commandList->isSegment()) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        hasSegments |= !commandList->getSegments().empty();
+    }
+    if (!hasSegments) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    for (uint32_t i = 0; i < numCommandLists; i++) {
+        appendCommandListWithSegments(CommandList::fromHandle(phCommandLists[i]), commandListsWithSegments);
+    }
+    numCommandLists = static_cast<uint32_t>(commandListsWithSegments.size());
+    phCommandLists = commandListsWithSegments.data();
+    return ZE_RESULT_SUCCESS;
+}
+
+void CommandQueueImp::appendCommandListWithSegments(CommandList *commandList, CommandListsWithSegments &commandListsWithSegments) const {
+    commandListsWithSegments.push_back(commandList->toHandle());
+    for (auto segment : commandList->getSegments()) {
+        appendCommandListWithSegments(segment, commandListsWithSegments);
+    }
+}
+
+const CommandQueueImp::ExecutionPlan *CommandQueueImp::findExecutionPlan(const ExecutionPlan &executionPlanKey) const {
+    for (const auto &executionPlan : executionPlans) {
+        if (executionPlan.commandLists.size() != executionPlanKey.commandLists.size() ||
+            executionPlan.statePreemption != executionPlanKey.statePreemption ||
+            executionPlan.engineInstanced != executionPlanKey.engineInstanced ||
+            executionPlan.frontEndStateDirty != executionPlanKey.frontEndStateDirty ||
+            executionPlan.gpgpuEnabled != executionPlanKey.gpgpuEnabled ||
+            executionPlan.baseAddressStateDirty != executionPlanKey.baseAddressStateDirty ||
+            executionPlan.scmStateDirty != executionPlanKey.scmStateDirty) {
+            continue;
+        }
+        if (!std::equal(executionPlan.commandLists.begin(), executionPlan.commandLists.end(), executionPlanKey.commandLists.begin())) {
+            continue;
+        }
+        if (executionPlan.csrState.isSameState(executionPlanKey.csrState)) {
+            return &executionPlan;
+        }
+    }
+    return nullptr;
+}
+
+void CommandQueueImp::storeExecutionPlan(const ExecutionPlan &executionPlan) {
+    executionPlans[nextExecutionPlanIndex] = executionPlan;
+    nextExecutionPlanIndex = (nextExecutionPlanIndex + 1) % executionPlanCacheSize;
+}
+
 NEO::WaitStatus CommandQueueImp::reserveLinearStreamSize(size_t size) {
     auto waitStatus{NEO::WaitStatus::ready};
 
@@ -67,7 +67,11 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     bool performMigration,
     NEO::LinearStream *parentImmediateCommandlistLinearStream) {
 
-    auto ret = ZE_RESULT_SUCCESS;
+    CommandListsWithSegments commandListsWithSegments;
+    auto ret = expandCommandListSegments(numCommandLists, phCommandLists, commandListsWithSegments);
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
 
     this->device->activateMetricGroups();
 
@@ -928,38 +932,79 @@ size_t CommandQueueHw<gfxCoreFamily>::estimateLinearStreamSizeComplementary(
     ctx.globalInit |= !gpgpuEnabled;
     ctx.globalInit |= scmStateDirty;
 
-    CommandListRequiredStateChange cmdListState;
-
-    for (uint32_t i = 0; i < numCommandLists; i++) {
-        auto cmdList = CommandList::fromHandle(phCommandLists[i]);
-        const NEO::StreamProperties &requiredStreamState = cmdList->getRequiredStreamState();
-        const NEO::StreamProperties &finalStreamState = cmdList->getFinalStreamState();
-
-        linearStreamSizeEstimate += estimateFrontEndCmdSizeForMultipleCommandLists(frontEndStateDirty, ctx.engineInstanced, cmdList,
-                                                                                   streamProperties, requiredStreamState, finalStreamState,
-                                                                                   cmdListState.requiredState,
-                                                                                   cmdListState.flags.propertyFeDirty, cmdListState.flags.frontEndReturnPoint);
-        linearStreamSizeEstimate += estimatePipelineSelectCmdSizeForMultipleCommandLists(streamProperties, requiredStreamState, finalStreamState, gpgpuEnabled,
-                                                                                         cmdListState.requiredState, cmdListState.flags.propertyPsDirty);
-        linearStreamSizeEstimate += estimateScmCmdSizeForMultipleCommandLists(streamProperties, scmStateDirty, requiredStreamState, finalStreamState,
-                                                                              cmdListState.requiredState, cmdListState.flags.propertyScmDirty);
-        linearStreamSizeEstimate += estimateStateBaseAddressCmdSizeForMultipleCommandLists(baseAdresStateDirty, cmdList->getCmdListHeapAddressModel(), streamProperties, requiredStreamState, finalStreamState,
-                                                                                           cmdListState.requiredState, cmdListState.flags.propertySbaDirty);
-        linearStreamSizeEstimate += computePreemptionSizeForCommandList(ctx, cmdList, cmdListState.flags.preemptionDirty);
-
-        linearStreamSizeEstimate += estimateCommandListSecondaryStart(cmdList);
-        ctx.spaceForResidency += estimateCommandListResidencySize(cmdList);
+    ExecutionPlan executionPlan;
+    const ExecutionPlan *cachedExecutionPlan = nullptr;
+    bool executionPlanAllowed = this->executionPlanCacheEnabled;
+    if (executionPlanAllowed) {
+        executionPlan.csrState = streamProperties;
+        executionPlan.statePreemption = ctx.statePreemption;
+        executionPlan.engineInstanced = ctx.engineInstanced;
+        executionPlan.frontEndStateDirty = frontEndStateDirty;
+        executionPlan.gpgpuEnabled = gpgpuEnabled;
+        executionPlan.baseAddressStateDirty = baseAdresStateDirty;
+        executionPlan.scmStateDirty = scmStateDirty;
+        for (uint32_t i = 0; i < numCommandLists; i++) {
+            auto cmdList = CommandList::fromHandle(phCommandLists[i]);
+            if (cmdList->isImmediateType()) {
+                executionPlanAllowed = false;
+                break;
+            }
+            executionPlan.commandLists.push_back({cmdList, cmdList->getExecutionGeneration()});
+        }
+        if (executionPlanAllowed) {
+            cachedExecutionPlan = this->findExecutionPlan(executionPlan);
+        }
+    }
 
-        if (cmdListState.flags.isAnyDirty()) {
-            cmdListState.commandList = cmdList;
-            cmdListState.cmdListIndex = i;
-            cmdListState.newPreemptionMode = ctx.statePreemption;
-            this->stateChanges.push_back(cmdListState);
+    if (cachedExecutionPlan) {
+        linearStreamSizeEstimate += cachedExecutionPlan->commandListsCmdSize;
+        ctx.spaceForResidency += cachedExecutionPlan->commandListsResidencySize;
+    } else {
+        size_t commandListsCmdSize = 0;
+        size_t commandListsResidencySize = 0;
+        CommandListRequiredStateChange cmdListState;
+
+        for (uint32_t i = 0; i < numCommandLists; i++) {
+            auto cmdList = CommandList::fromHandle(phCommandLists[i]);
+            const NEO::StreamProperties &requiredStreamState = cmdList->getRequiredStreamState();
+            const NEO::StreamProperties &finalStreamState = cmdList->getFinalStreamState();
+
+            commandListsCmdSize += estimateFrontEndCmdSizeForMultipleCommandLists(frontEndStateDirty, ctx.engineInstanced, cmdList,
+                                                                                  streamProperties, requiredStreamState, finalStreamState,
+                                                                                  cmdListState.requiredState,
+                                                                                  cmdListState.flags.propertyFeDirty, cmdListState.flags.frontEndReturnPoint);
+            commandListsCmdSize += estimatePipelineSelectCmdSizeForMultipleCommandLists(streamProperties, requiredStreamState, finalStreamState, gpgpuEnabled,
+                                                                                        cmdListState.requiredState, cmdListState.flags.propertyPsDirty);
+            commandListsCmdSize += estimateScmCmdSizeForMultipleCommandLists(streamProperties, scmStateDirty, requiredStreamState, finalStreamState,
+                                                                             cmdListState.requiredState, cmdListState.flags.propertyScmDirty);
+            commandListsCmdSize += estimateStateBaseAddressCmdSizeForMultipleCommandLists(baseAdresStateDirty, cmdList->getCmdListHeapAddressModel(), streamProperties, requiredStreamState, finalStreamState,
+                                                                                          cmdListState.requiredState, cmdListState.flags.propertySbaDirty);
+            commandListsCmdSize += computePreemptionSizeForCommandList(ctx, cmdList, cmdListState.flags.preemptionDirty);
+
+            commandListsCmdSize += estimateCommandListSecondaryStart(cmdList);
+            commandListsResidencySize += estimateCommandListResidencySize(cmdList);
+
+            if (cmdListState.flags.isAnyDirty()) {
+                cmdListState.commandList = cmdList;
+                cmdListState.cmdListIndex = i;
+                cmdListState.newPreemptionMode = ctx.statePreemption;
+                this->stateChanges.push_back(cmdListState);
+
+                commandListsCmdSize += this->estimateCommandListPrimaryStart(true);
+
+                cmdListState.requiredState.resetState();
+                cmdListState.flags.cleanDirty();
+            }
+        }
 
-            linearStreamSizeEstimate += this->estimateCommandListPrimaryStart(true);
+        linearStreamSizeEstimate += commandListsCmdSize;
+        ctx.spaceForResidency += commandListsResidencySize;
 
-            cmdListState.requiredState.resetState();
-            cmdListState.flags.cleanDirty();
+        if (executionPlanAllowed && this->stateChanges.empty() &&
+            streamProperties.isSameState(executionPlan.csrState) && ctx.statePreemption == executionPlan.statePreemption) {
+            executionPlan.commandListsCmdSize = commandListsCmdSize;
+            executionPlan.commandListsResidencySize = commandListsResidencySize;
+            this->storeExecutionPlan(executionPlan);
         }
     }
 
@@ -18,6 +18,7 @@
 
 #include "level_zero/core/source/cmdqueue/cmdqueue.h"
 
+#include <array>
 #include <atomic>
 #include <vector>
 
@@ -146,7 +147,30 @@ struct CommandQueueImp : public CommandQueue {
 
     using CommandListStateChangeList = StackVec<CommandListRequiredStateChange, CommandQueueImp::defaultCommandListStateChangeListSize>;
 
+    static constexpr uint32_t defaultExecutionPlanListSize = 16;
+    static constexpr size_t executionPlanCacheSize = 4;
+    struct ExecutionPlan {
+        StackVec<std::pair<CommandList *, uint64_t>, CommandQueueImp::defaultExecutionPlanListSize> commandLists;
+        NEO::StreamProperties csrState{};
+        NEO::PreemptionMode statePreemption = NEO::PreemptionMode::Initial;
+        size_t commandListsCmdSize = 0;
+        size_t commandListsResidencySize = 0;
+        int32_t engineInstanced = -1;
+        bool frontEndStateDirty = false;
+        bool gpgpuEnabled = false;
+        bool baseAddressStateDirty = false;
+        bool scmStateDirty = false;
+    };
+
+    using CommandListsWithSegments = StackVec<ze_command_list_handle_t, CommandQueueImp::defaultExecutionPlanListSize>;
+    ze_result_t expandCommandListSegments(uint32_t &numCommandLists, ze_command_list_handle_t *&phCommandLists, CommandListsWithSegments &commandListsWithSegments) const;
+    void appendCommandListWithSegments(CommandList *commandList, CommandListsWithSegments &commandListsWithSegments) const;
+
+    const ExecutionPlan *findExecutionPlan(const ExecutionPlan &executionPlanKey) const;
+    void storeExecutionPlan(const ExecutionPlan &executionPlan);
+
     CommandListStateChangeList stateChanges;
+    std::array<ExecutionPlan, CommandQueueImp::executionPlanCacheSize> executionPlans;
     CommandBufferManager buffers;
     NEO::LinearStream commandStream{};
     NEO::LinearStream firstCmdListStream{};
@@ -159,9 +183,11 @@ struct CommandQueueImp : public CommandQueue {
     NEO::LinearStream *startingCmdBuffer = nullptr;
 
     uint32_t currentStateChangeIndex = 0;
+    uint32_t nextExecutionPlanIndex = 0;
 
     std::atomic<bool> cmdListWithAssertExecuted = false;
     bool useKmdWaitFunction = false;
+    bool executionPlanCacheEnabled = false;
 };
 
 } // namespace L0
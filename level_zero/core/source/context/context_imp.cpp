@@ -430,6 +430,8 @@ ze_result_t ContextImp::freeMem(const void *ptr, bool blocking) {
     }
 
     for (auto &pairDevice : this->devices) {
+        // appends deferred by flush coalescing may still use the allocation
+        static_cast<DeviceImp *>(Device::fromHandle(pairDevice.second))->flushCoalescedAppends();
         this->freePeerAllocations(ptr, blocking, Device::fromHandle(pairDevice.second));
     }
 
@@ -1521,6 +1521,8 @@ void DeviceImp::releaseResources() {
         this->pageFaultCommandList = nullptr;
     }
 
+    flushCoalescingController.reset();
+
     for (uint32_t i = 0; i < this->numSubDevices; i++) {
         delete this->subDevices[i];
     }
@@ -1545,6 +1547,21 @@ void DeviceImp::releaseResources() {
     resourcesReleased = true;
 }
 
+FlushCoalescingController &DeviceImp::getFlushCoalescingController(std::chrono::microseconds checkPeriod) {
+    std::lock_guard<std::mutex> lock(flushCoalescingControllerMutex);
+    if (!flushCoalescingController) {
+        flushCoalescingController = std::make_unique<FlushCoalescingController>(checkPeriod);
+    }
+    return *flushCoalescingController;
+}
+
+void DeviceImp::flushCoalescedAppends() {
+    std::lock_guard<std::mutex> lock(flushCoalescingControllerMutex);
+    if (flushCoalescingController) {
+        flushCoalescingController->flushAll();
+    }
+}
+
 DeviceImp::~DeviceImp() {
     releaseResources();
 
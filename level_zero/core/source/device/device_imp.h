@@ -14,6 +14,7 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
+#include "level_zero/core/source/cmdlist/cmdlist_flush_coalescing_controller.h"
 #include "level_zero/core/source/device/bcs_split.h"
 #include "level_zero/core/source/device/device.h"
 
@@ -126,6 +127,8 @@ struct DeviceImp : public Device, NEO::NonCopyableOrMovableClass {
     bool toPhysicalSliceId(const NEO::TopologyMap &topologyMap, uint32_t &slice, uint32_t &subslice, uint32_t &deviceIndex);
     bool toApiSliceId(const NEO::TopologyMap &topologyMap, uint32_t &slice, uint32_t &subslice, uint32_t deviceIndex);
     uint32_t getPhysicalSubDeviceId();
+    FlushCoalescingController &getFlushCoalescingController(std::chrono::microseconds checkPeriod);
+    void flushCoalescedAppends();
 
     bool isSubdevice = false;
     void *execEnvironment = nullptr;
@@ -146,6 +149,9 @@ struct DeviceImp : public Device, NEO::NonCopyableOrMovableClass {
 
     BcsSplit bcsSplit;
 
+    std::unique_ptr<FlushCoalescingController> flushCoalescingController;
+    std::mutex flushCoalescingControllerMutex;
+
     bool resourcesReleased = false;
     bool calculationForDisablingEuFusionWithDpasNeeded = false;
     void releaseResources();
@@ -18,7 +18,11 @@ namespace L0 {
 
 std::unique_ptr<BuiltinFunctionsLib> BuiltinFunctionsLib::create(Device *device,
                                                                  NEO::BuiltIns *builtins) {
-    return std::unique_ptr<BuiltinFunctionsLib>(new BuiltinFunctionsLibImpl(device, builtins));
+    auto builtinFunctionsLib = std::make_unique<BuiltinFunctionsLibImpl>(device, builtins);
+    if (BuiltinFunctionsLibImpl::prefetchBuiltinsEnabled()) {
+        builtinFunctionsLib->prefetchBuiltins();
+    }
+    return builtinFunctionsLib;
 }
 
 bool BuiltinFunctionsLibImpl::initBuiltinsAsyncEnabled(Device *device) {
@@ -189,6 +189,7 @@ DriverHandleImp::~DriverHandleImp() {
             this->svmAllocsManager->trimUSMDeviceAllocCache();
             this->usmHostMemAllocPool.cleanup();
         }
+        this->eventPoolSlabAllocator.reset();
     }
 
     for (auto &device : this->devices) {
@@ -271,6 +272,10 @@ ze_result_t DriverHandleImp::initialize(std::vector<std::unique_ptr<NEO::Device>
     this->svmAllocsManager->initUsmAllocationsCaches(*this->devices[0]->getNEODevice());
     this->initHostUsmAllocPool();
 
+    if (NEO::debugManager.flags.EnableEventPoolSlabAllocator.get() == 1) {
+        this->eventPoolSlabAllocator = std::make_unique<EventPoolSlabAllocator>(memoryManager);
+    }
+
     this->numDevices = static_cast<uint32_t>(this->devices.size());
 
     uuidTimestamp = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
@@ -14,6 +14,7 @@
 
 #include "level_zero/api/extensions/public/ze_exp_ext.h"
 #include "level_zero/core/source/driver/driver_handle.h"
+#include "level_zero/core/source/event/event_pool_slab_allocator.h"
 #include "level_zero/include/ze_intel_gpu.h"
 
 #include <map>
@@ -127,8 +128,10 @@ struct DriverHandleImp : public DriverHandle {
     std::map<uint64_t, IpcHandleTracking *> &getIPCHandleMap() { return this->ipcHandles; };
     [[nodiscard]] std::unique_lock<std::mutex> lockIPCHandleMap() { return std::unique_lock<std::mutex>(this->ipcHandleMapMutex); };
     void initHostUsmAllocPool();
+    EventPoolSlabAllocator *getEventPoolSlabAllocator() const { return eventPoolSlabAllocator.get(); }
 
     std::unique_ptr<HostPointerManager> hostPointerManager;
+    std::unique_ptr<EventPoolSlabAllocator> eventPoolSlabAllocator;
 
     std::mutex sharedMakeResidentAllocationsLock;
     std::map<void *, NEO::GraphicsAllocation *> sharedMakeResidentAllocations;
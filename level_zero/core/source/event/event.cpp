@@ -7,6 +7,7 @@
 
 #include "level_zero/core/source/event/event.h"
 
+#include "shared/source/assert_handler/assert_handler.h"
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
 #include "shared/source/command_stream/csr_definitions.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
@@ -113,6 +114,14 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
     auto neoDevice = devices[0]->getNEODevice();
     if (this->isDeviceEventPoolAllocation) {
         this->isHostVisibleEventPoolAllocation = !(isEventPoolDeviceAllocationFlagSet());
+    } else {
+        this->isHostVisibleEventPoolAllocation = true;
+    }
+
+    if (allocateFromSlab(*driverHandleImp, this->isDeviceEventPoolAllocation, allocationType, rootDeviceIndices)) {
+        eventPoolAllocations.reset();
+        allocatedMemory = true;
+    } else if (this->isDeviceEventPoolAllocation) {
         NEO::AllocationProperties allocationProperties{*rootDeviceIndices.begin(), this->eventPoolSize, allocationType, neoDevice->getDeviceBitfield()};
         allocationProperties.alignment = eventAlignment;
 
@@ -127,7 +136,6 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
             }
         }
     } else {
-        this->isHostVisibleEventPoolAllocation = true;
         NEO::AllocationProperties allocationProperties{*rootDeviceIndices.begin(), this->eventPoolSize, allocationType, systemMemoryBitfield};
         allocationProperties.alignment = eventAlignment;
 
@@ -144,12 +152,31 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
         return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
     }
     if (neoDevice->getDefaultEngine().commandStreamReceiver->isTbxMode()) {
-        eventPoolAllocations->getDefaultGraphicsAllocation()->setWriteMemoryOnly(true);
+        getAllocation().getDefaultGraphicsAllocation()->setWriteMemoryOnly(true);
     }
     return ZE_RESULT_SUCCESS;
 }
 
+bool EventPool::allocateFromSlab(DriverHandleImp &driver, bool deviceAllocation, NEO::AllocationType allocationType, const RootDeviceIndicesContainer &rootDeviceIndices) {
+    auto slabAllocator = driver.getEventPoolSlabAllocator();
+    if (!slabAllocator || isIpcPoolFlagSet() || !EventPoolSlabAllocator::canBeSuballocated(this->eventPoolSize, this->eventAlignment)) {
+        return false;
+    }
+
+    EventPoolSlabAllocator::SlabClass slabClass;
+    slabClass.rootDeviceIndices = rootDeviceIndices;
+    slabClass.deviceBitfield = devices[0]->getNEODevice()->getDeviceBitfield();
+    slabClass.allocationType = allocationType;
+    slabClass.deviceAllocation = deviceAllocation;
+
+    return slabAllocator->allocate(slabClass, this->eventPoolSize, this->eventAlignment, slabChunk);
+}
+
 EventPool::~EventPool() {
+    if (slabChunk.allocations) {
+        auto driverHandleImp = static_cast<DriverHandleImp *>(devices[0]->getDriverHandle());
+        driverHandleImp->getEventPoolSlabAllocator()->free(slabChunk);
+    }
     if (eventPoolAllocations) {
         auto graphicsAllocations = eventPoolAllocations->getGraphicsAllocations();
         auto memoryManager = devices[0]->getDriverHandle()->getMemoryManager();
@@ -501,6 +528,92 @@ void Event::unsetInOrderExecInfo() {
     inOrderExecSignalValue = 0;
 }
 
+ze_result_t Event::hostSynchronizeMultiple(uint32_t numEvents, Event *const *events, bool waitAll, uint64_t timeout, uint32_t *signaledEventIndex) {
+    if (NEO::debugManager.flags.OverrideEventSynchronizeTimeout.get() != -1) {
+        timeout = NEO::debugManager.flags.OverrideEventSynchronizeTimeout.get();
+    }
+
+    StackVec<bool, 16> completed;
+    completed.resize(numEvents, false);
+    const auto waitStartTime = std::chrono::high_resolution_clock::now();
+    auto lastHangCheckTime = waitStartTime;
+    uint64_t timeDiff = 0;
+
+    do {
+        const volatile void *monitorAddress = nullptr;
+        uint32_t pendingEvents = 0;
+        uint32_t lastPendingEventIndex = 0;
+
+        for (uint32_t i = 0; i < numEvents; i++) {
+            if (completed[i]) {
+                continue;
+            }
+            const volatile void *pendingAddress = nullptr;
+            if (events[i]->pollStatus(pendingAddress) == ZE_RESULT_SUCCESS) {
+                completed[i] = true;
+                if (!waitAll) {
+                    if (signaledEventIndex) {
+                        *signaledEventIndex = i;
+                    }
+                    return ZE_RESULT_SUCCESS;
+                }
+                continue;
+            }
+            pendingEvents++;
+            lastPendingEventIndex = i;
+            if (monitorAddress == nullptr) {
+                monitorAddress = pendingAddress;
+            }
+        }
+
+        if (pendingEvents == 0) {
+            return ZE_RESULT_SUCCESS;
+        }
+
+        auto currentTime = std::chrono::high_resolution_clock::now();
+        timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - waitStartTime).count();
+
+        auto lastPendingEvent = events[lastPendingEventIndex];
+        if (pendingEvents == 1 && lastPendingEvent->isKmdWaitModeEnabled() && lastPendingEvent->isCounterBased()) {
+            auto remainingTimeout = (timeout == std::numeric_limits<uint64_t>::max()) ? timeout : timeout - std::min(timeout, timeDiff);
+            auto ret = lastPendingEvent->hostSynchronize(remainingTimeout);
+            if (ret == ZE_RESULT_SUCCESS && signaledEventIndex) {
+                *signaledEventIndex = lastPendingEventIndex;
+            }
+            return ret;
+        }
+
+        if (std::chrono::duration_cast<std::chrono::microseconds>(currentTime - lastHangCheckTime) >= events[0]->gpuHangCheckPeriod) {
+            lastHangCheckTime = currentTime;
+            for (uint32_t i = 0; i < numEvents; i++) {
+                if (!completed[i] && events[i]->csrs[0]->isGpuHangDetected()) {
+                    events[i]->checkAssertAfterHostSynchronization();
+                    return ZE_RESULT_ERROR_DEVICE_LOST;
+                }
+            }
+        }
+
+        if (timeout == 0) {
+            break;
+        }
+
+        NEO::WaitUtils::waitOnAddress(monitorAddress);
+    } while (timeout == std::numeric_limits<uint64_t>::max() || timeDiff < timeout);
+
+    for (uint32_t i = 0; i < numEvents; i++) {
+        if (!completed[i]) {
+            events[i]->checkAssertAfterHostSynchronization();
+        }
+    }
+    return ZE_RESULT_NOT_READY;
+}
+
+void Event::checkAssertAfterHostSynchronization() {
+    if (device->getNEODevice()->getRootDeviceEnvironment().assertHandler.get()) {
+        device->getNEODevice()->getRootDeviceEnvironment().assertHandler->printAssertAndAbort();
+    }
+}
+
 void Event::resetInOrderTimestampNode(NEO::TagNodeBase *newNode) {
     if (inOrderTimestampNode) {
         inOrderExecInfo->pushTempTimestampNode(inOrderTimestampNode, inOrderExecSignalValue);
@@ -12,6 +12,7 @@
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/os_interface/os_time.h"
 
+#include "level_zero/core/source/event/event_pool_slab_allocator.h"
 #include "level_zero/core/source/helpers/api_handle_helper.h"
 #include <level_zero/ze_api.h>
 
@@ -78,6 +79,7 @@ struct EventDescriptor {
     bool kerneMappedTsPoolFlag = false;
     bool importedIpcPool = false;
     bool ipcPool = false;
+    size_t eventPoolOffset = 0;
 };
 
 struct Event : _ze_event_handle_t {
@@ -119,6 +121,14 @@ struct Event : _ze_event_handle_t {
 
     static Event *fromHandle(ze_event_handle_t handle) { return static_cast<Event *>(handle); }
 
+    static ze_result_t hostSynchronizeMultiple(uint32_t numEvents, Event *const *events, bool waitAll, uint64_t timeout, uint32_t *signaledEventIndex);
+
+    // Checks completion without waiting on completion address. When not ready, pendingAddress is set to host address to monitor.
+    virtual ze_result_t pollStatus(const volatile void *&pendingAddress) {
+        pendingAddress = nullptr;
+        return queryStatus();
+    }
+
     inline ze_event_handle_t toHandle() { return this; }
 
     MOCKABLE_VIRTUAL NEO::GraphicsAllocation *getPoolAllocation(Device *device) const;
@@ -301,6 +311,7 @@ struct Event : _ze_event_handle_t {
     Event(int index, Device *device) : device(device), index(index) {}
 
     void unsetCmdQueue();
+    void checkAssertAfterHostSynchronization();
 
     EventPool *eventPool = nullptr;
 
@@ -386,7 +397,11 @@ struct EventPool : _ze_event_pool_handle_t {
 
     inline ze_event_pool_handle_t toHandle() { return this; }
 
-    MOCKABLE_VIRTUAL NEO::MultiGraphicsAllocation &getAllocation() { return *eventPoolAllocations; }
+    MOCKABLE_VIRTUAL NEO::MultiGraphicsAllocation &getAllocation() {
+        return slabChunk.allocations ? *slabChunk.allocations : *eventPoolAllocations;
+    }
+    size_t getEventPoolOffset() const { return slabChunk.offset; }
+    bool isAllocatedFromSlab() const { return slabChunk.allocations != nullptr; }
 
     uint32_t getEventSize() const { return eventSize; }
     void setEventSize(uint32_t size) { eventSize = size; }
@@ -436,11 +451,13 @@ struct EventPool : _ze_event_pool_handle_t {
     EventPool() = default;
     EventPool(size_t numEvents) : numEvents(numEvents) {}
     void setupDescriptorFlags(const ze_event_pool_desc_t *desc);
+    bool allocateFromSlab(DriverHandleImp &driver, bool deviceAllocation, NEO::AllocationType allocationType, const RootDeviceIndicesContainer &rootDeviceIndices);
 
     std::vector<Device *> devices;
 
     std::unique_ptr<NEO::MultiGraphicsAllocation> eventPoolAllocations;
     void *eventPoolPtr = nullptr;
+    EventPoolSlabChunk slabChunk;
     ContextImp *context = nullptr;
 
     size_t numEvents = 1;
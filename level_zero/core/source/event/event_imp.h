@@ -36,6 +36,8 @@ struct EventImp : public Event {
 
     ze_result_t queryStatus() override;
 
+    ze_result_t pollStatus(const volatile void *&pendingAddress) override;
+
     ze_result_t reset() override;
 
     ze_result_t queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) override;
@@ -67,8 +69,11 @@ struct EventImp : public Event {
     TaskCountType getTaskCount(const NEO::CommandStreamReceiver &csr) const;
 
     ze_result_t calculateProfilingData();
-    ze_result_t queryStatusEventPackets();
-    ze_result_t queryCounterBasedEventStatus();
+    ze_result_t queryStatusEventPackets(const volatile void **pendingAddress);
+    ze_result_t queryCounterBasedEventStatus(const volatile void **pendingAddress);
+    template <typename T, typename PredicateT>
+    static bool isCompletionAddressSignaled(const T *address, T value, PredicateT predicate, const volatile void **pendingAddress);
+    void handleKernelOutputAfterHostSynchronization();
     void handleSuccessfulHostSynchronization();
     MOCKABLE_VIRTUAL ze_result_t hostEventSetValue(TagSizeT eventValue);
     MOCKABLE_VIRTUAL ze_result_t hostEventSetValueTimestamps(TagSizeT eventVal);
@@ -50,7 +50,7 @@ Event *Event::create(const EventDescriptor &eventDescriptor, const ze_event_desc
     }
 
     event->totalEventSize = eventDescriptor.totalEventSize;
-    event->eventPoolOffset = desc->index * event->totalEventSize;
+    event->eventPoolOffset = eventDescriptor.eventPoolOffset + desc->index * event->totalEventSize;
     event->hostAddress = ptrOffset(baseHostAddress, event->eventPoolOffset);
     event->signalScope = desc->signal;
     event->waitScope = desc->wait;
@@ -138,6 +138,7 @@ Event *Event::create(EventPool *eventPool, const ze_event_desc_t *desc, Device *
         eventPool->isEventPoolKerneMappedTsFlagSet(), // kerneMappedTsPoolFlag
         eventPool->getImportedIpcPool(),              // importedIpcPool
         eventPool->isIpcPoolFlagSet(),                // ipcPool
+        eventPool->getEventPoolOffset(),              // eventPoolOffset
     };
 
     Event *event = Event::create<TagSizeT>(eventDescriptor, desc, device);
@@ -220,7 +221,7 @@ void EventImp<TagSizeT>::assignKernelEventCompletionData(void *address) {
 }
 
 template <typename TagSizeT>
-ze_result_t EventImp<TagSizeT>::queryCounterBasedEventStatus() {
+ze_result_t EventImp<TagSizeT>::queryCounterBasedEventStatus(const volatile void **pendingAddress) {
     if (!this->inOrderExecInfo.get()) {
         return ZE_RESULT_SUCCESS;
     }
@@ -231,7 +232,7 @@ ze_result_t EventImp<TagSizeT>::queryCounterBasedEventStatus() {
         bool signaled = true;
         const uint64_t *hostAddress = ptrOffset(inOrderExecInfo->getBaseHostAddress(), this->inOrderAllocationOffset);
         for (uint32_t i = 0; i < inOrderExecInfo->getNumHostPartitionsToWait(); i++) {
-            if (!NEO::WaitUtils::waitFunctionWithPredicate<const uint64_t>(hostAddress, waitValue, std::greater_equal<uint64_t>())) {
+            if (!isCompletionAddressSignaled<uint64_t>(hostAddress, waitValue, std::greater_equal<uint64_t>(), pendingAddress)) {
                 signaled = false;
                 break;
             }
@@ -311,7 +312,7 @@ void EventImp<TagSizeT>::handleSuccessfulHostSynchronization() {
 }
 
 template <typename TagSizeT>
-ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
+ze_result_t EventImp<TagSizeT>::queryStatusEventPackets(const volatile void **pendingAddress) {
     assignKernelEventCompletionData(this->hostAddress);
     uint32_t queryVal = Event::STATE_CLEARED;
     uint32_t packets = 0;
@@ -321,10 +322,11 @@ ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
             void const *queryAddress = isUsingContextEndOffset()
                                            ? kernelEventCompletionData[i].getContextEndAddress(packetId)
                                            : kernelEventCompletionData[i].getContextStartAddress(packetId);
-            bool ready = NEO::WaitUtils::waitFunctionWithPredicate<const TagSizeT>(
+            bool ready = isCompletionAddressSignaled<TagSizeT>(
                 static_cast<TagSizeT const *>(queryAddress),
                 queryVal,
-                std::not_equal_to<TagSizeT>());
+                std::not_equal_to<TagSizeT>(),
+                pendingAddress);
             if (!ready) {
                 return ZE_RESULT_NOT_READY;
             }
@@ -337,10 +339,11 @@ ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
             remainingPacketSyncAddress = ptrOffset(remainingPacketSyncAddress, this->getCompletionFieldOffset());
             for (uint32_t i = 0; i < remainingPackets; i++) {
                 void const *queryAddress = remainingPacketSyncAddress;
-                bool ready = NEO::WaitUtils::waitFunctionWithPredicate<const TagSizeT>(
+                bool ready = isCompletionAddressSignaled<TagSizeT>(
                     static_cast<TagSizeT const *>(queryAddress),
                     queryVal,
-                    std::not_equal_to<TagSizeT>());
+                    std::not_equal_to<TagSizeT>(),
+                    pendingAddress);
                 if (!ready) {
                     return ZE_RESULT_NOT_READY;
                 }
@@ -431,12 +434,48 @@ ze_result_t EventImp<TagSizeT>::queryStatus() {
     }
 
     if (isCounterBased() || this->inOrderExecInfo.get()) {
-        return queryCounterBasedEventStatus();
+        return queryCounterBasedEventStatus(nullptr);
     } else {
-        return queryStatusEventPackets();
+        return queryStatusEventPackets(nullptr);
     }
 }
 
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::pollStatus(const volatile void *&pendingAddress) {
+    pendingAddress = nullptr;
+
+    if (this->csrs[0]->getType() == NEO::CommandStreamReceiverType::aub) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ret = ZE_RESULT_SUCCESS;
+    if (!handlePreQueryStatusOperationsAndCheckCompletion()) {
+        if (isCounterBased() || this->inOrderExecInfo.get()) {
+            ret = queryCounterBasedEventStatus(&pendingAddress);
+        } else {
+            ret = queryStatusEventPackets(&pendingAddress);
+        }
+    }
+
+    if (ret == ZE_RESULT_SUCCESS) {
+        handleKernelOutputAfterHostSynchronization();
+    }
+    return ret;
+}
+
+template <typename TagSizeT>
+template <typename T, typename PredicateT>
+bool EventImp<TagSizeT>::isCompletionAddressSignaled(const T *address, T value, PredicateT predicate, const volatile void **pendingAddress) {
+    if (pendingAddress == nullptr) {
+        return NEO::WaitUtils::waitFunctionWithPredicate<const T>(address, value, predicate);
+    }
+    if (predicate(*static_cast<const volatile T *>(address), value)) {
+        return true;
+    }
+    *pendingAddress = address;
+    return false;
+}
+
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::hostEventSetValueTimestamps(TagSizeT eventVal) {
 
@@ -618,6 +657,19 @@ ze_result_t EventImp<TagSizeT>::waitForUserFence(uint64_t timeout) {
     return ZE_RESULT_SUCCESS;
 }
 
+template <typename TagSizeT>
+void EventImp<TagSizeT>::handleKernelOutputAfterHostSynchronization() {
+    if (this->getKernelWithPrintfDeviceMutex() != nullptr) {
+        std::lock_guard<std::mutex> lock(*this->getKernelWithPrintfDeviceMutex());
+        if (!this->getKernelForPrintf().expired()) {
+            this->getKernelForPrintf().lock()->printPrintfOutput(true);
+        }
+        this->resetKernelForPrintf();
+        this->resetKernelWithPrintfDeviceMutex();
+    }
+    checkAssertAfterHostSynchronization();
+}
+
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
     std::chrono::microseconds elapsedTimeSinceGpuHangCheck{0};
@@ -643,17 +695,7 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
             ret = queryStatus();
         }
         if (ret == ZE_RESULT_SUCCESS) {
-            if (this->getKernelWithPrintfDeviceMutex() != nullptr) {
-                std::lock_guard<std::mutex> lock(*this->getKernelWithPrintfDeviceMutex());
-                if (!this->getKernelForPrintf().expired()) {
-                    this->getKernelForPrintf().lock()->printPrintfOutput(true);
-                }
-                this->resetKernelForPrintf();
-                this->resetKernelWithPrintfDeviceMutex();
-            }
-            if (device->getNEODevice()->getRootDeviceEnvironment().assertHandler.get()) {
-                device->getNEODevice()->getRootDeviceEnvironment().assertHandler->printAssertAndAbort();
-            }
+            handleKernelOutputAfterHostSynchronization();
             return ret;
         }
 
@@ -663,9 +705,7 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
         if (elapsedTimeSinceGpuHangCheck.count() >= this->gpuHangCheckPeriod.count()) {
             lastHangCheckTime = currentTime;
             if (this->csrs[0]->isGpuHangDetected()) {
-                if (device->getNEODevice()->getRootDeviceEnvironment().assertHandler.get()) {
-                    device->getNEODevice()->getRootDeviceEnvironment().assertHandler->printAssertAndAbort();
-                }
+                checkAssertAfterHostSynchronization();
                 return ZE_RESULT_ERROR_DEVICE_LOST;
             }
         }
@@ -680,9 +720,7 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
 
     } while (timeDiff < timeout);
 
-    if (device->getNEODevice()->getRootDeviceEnvironment().assertHandler.get()) {
-        device->getNEODevice()->getRootDeviceEnvironment().assertHandler->printAssertAndAbort();
-    }
+    checkAssertAfterHostSynchronization();
     return ret;
 }
 
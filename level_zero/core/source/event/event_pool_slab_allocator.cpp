@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/event/event_pool_slab_allocator.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/multi_graphics_allocation.h"
+#include "shared/source/utilities/heap_allocator.h"
+
+#include <algorithm>
+
+namespace L0 {
+
+bool EventPoolSlabAllocator::SlabClass::operator==(const SlabClass &other) const {
+    if (allocationType != other.allocationType ||
+        deviceAllocation != other.deviceAllocation ||
+        deviceBitfield != other.deviceBitfield ||
+        rootDeviceIndices.size() != other.rootDeviceIndices.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < rootDeviceIndices.size(); i++) {
+        if (rootDeviceIndices[i] != other.rootDeviceIndices[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+EventPoolSlabAllocator::~EventPoolSlabAllocator() {
+    for (auto &slab : slabs) {
+        for (auto allocation : slab->allocations->getGraphicsAllocations()) {
+            memoryManager->freeGraphicsMemory(allocation);
+        }
+    }
+}
+
+bool EventPoolSlabAllocator::allocate(const SlabClass &slabClass, size_t size, size_t alignment, EventPoolSlabChunk &chunk) {
+    if (!canBeSuballocated(size, alignment)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &slab : slabs) {
+        if (slab->slabClass == slabClass && allocateFromSlab(*slab, size, alignment, chunk)) {
+            return true;
+        }
+    }
+
+    auto slab = createSlab(slabClass);
+    return slab && allocateFromSlab(*slab, size, alignment, chunk);
+}
+
+void EventPoolSlabAllocator::free(const EventPoolSlabChunk &chunk) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &slab : slabs) {
+        if (slab->allocations.get() == chunk.allocations) {
+            slab->chunkAllocator->free(chunk.address, chunk.size);
+            return;
+        }
+    }
+    DEBUG_BREAK_IF(true);
+}
+
+bool EventPoolSlabAllocator::allocateFromSlab(Slab &slab, size_t size, size_t alignment, EventPoolSlabChunk &chunk) {
+    auto chunkSize = size;
+    auto address = slab.chunkAllocator->allocateWithCustomAlignment(chunkSize, std::max(alignment, chunkAlignment));
+    if (address == 0u) {
+        return false;
+    }
+    chunk.allocations = slab.allocations.get();
+    chunk.address = address;
+    chunk.offset = static_cast<size_t>(address - startingOffset);
+    chunk.size = chunkSize;
+    return true;
+}
+
+EventPoolSlabAllocator::Slab *EventPoolSlabAllocator::createSlab(const SlabClass &slabClass) {
+    uint32_t maxRootDeviceIndex = 0u;
+    for (auto rootDeviceIndex : slabClass.rootDeviceIndices) {
+        maxRootDeviceIndex = std::max(maxRootDeviceIndex, rootDeviceIndex);
+    }
+
+    auto slab = std::make_unique<Slab>();
+    slab->slabClass = slabClass;
+    slab->allocations = std::make_unique<NEO::MultiGraphicsAllocation>(maxRootDeviceIndex);
+
+    if (slabClass.deviceAllocation) {
+        NEO::AllocationProperties allocationProperties{slabClass.rootDeviceIndices[0], slabSize, slabClass.allocationType, slabClass.deviceBitfield};
+        allocationProperties.alignment = MemoryConstants::pageSize64k;
+        auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(allocationProperties);
+        if (allocation == nullptr) {
+            return nullptr;
+        }
+        slab->allocations->addAllocation(allocation);
+    } else {
+        NEO::AllocationProperties allocationProperties{slabClass.rootDeviceIndices[0], slabSize, slabClass.allocationType, systemMemoryBitfield};
+        allocationProperties.alignment = MemoryConstants::pageSize64k;
+        auto rootDeviceIndices = slabClass.rootDeviceIndices;
+        if (memoryManager->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndices, allocationProperties, *slab->allocations) == nullptr) {
+            return nullptr;
+        }
+    }
+
+    slab->chunkAllocator = std::make_unique<NEO::HeapAllocator>(startingOffset, slabSize, chunkAlignment, maxChunkSize / 2);
+    slabs.push_back(std::move(slab));
+    return slabs.back().get();
+}
+
+} // namespace L0
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/device_bitfield.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/memory_manager/allocation_type.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class HeapAllocator;
+class MemoryManager;
+class MultiGraphicsAllocation;
+} // namespace NEO
+
+namespace L0 {
+
+struct EventPoolSlabChunk {
+    NEO::MultiGraphicsAllocation *allocations = nullptr;
+    uint64_t address = 0u;
+    size_t offset = 0u;
+    size_t size = 0u;
+};
+
+// Driver-wide suballocator for event pool storage.
+// Slabs are allocated per memory class (allocation type, placement and set of devices)
+// and stay alive until the driver is destroyed, so creating a small event pool
+// takes a chunk from an existing slab instead of a new graphics allocation.
+class EventPoolSlabAllocator {
+  public:
+    struct SlabClass {
+        RootDeviceIndicesContainer rootDeviceIndices;
+        NEO::DeviceBitfield deviceBitfield;
+        NEO::AllocationType allocationType = NEO::AllocationType::unknown;
+        bool deviceAllocation = false;
+
+        bool operator==(const SlabClass &other) const;
+    };
+
+    static constexpr size_t slabSize = 2 * MemoryConstants::megaByte;
+    static constexpr size_t maxChunkSize = 256 * MemoryConstants::kiloByte;
+    static constexpr size_t chunkAlignment = MemoryConstants::cacheLineSize;
+
+    EventPoolSlabAllocator(NEO::MemoryManager *memoryManager) : memoryManager(memoryManager) {}
+    ~EventPoolSlabAllocator();
+
+    static bool canBeSuballocated(size_t size, size_t alignment) {
+        return size <= maxChunkSize && alignment <= maxChunkSize;
+    }
+
+    bool allocate(const SlabClass &slabClass, size_t size, size_t alignment, EventPoolSlabChunk &chunk);
+    void free(const EventPoolSlabChunk &chunk);
+
+    size_t getSlabCount() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return slabs.size();
+    }
+
+  protected:
+    struct Slab {
+        SlabClass slabClass;
+        std::unique_ptr<NEO::MultiGraphicsAllocation> allocations;
+        std::unique_ptr<NEO::HeapAllocator> chunkAllocator;
+    };
+
+    static constexpr uint64_t startingOffset = slabSize;
+
+    bool allocateFromSlab(Slab &slab, size_t size, size_t alignment, EventPoolSlabChunk &chunk);
+    Slab *createSlab(const SlabClass &slabClass);
+
+    NEO::MemoryManager *memoryManager = nullptr;
+    std::vector<std::unique_ptr<Slab>> slabs;
+    std::mutex mtx;
+};
+
+} // namespace L0
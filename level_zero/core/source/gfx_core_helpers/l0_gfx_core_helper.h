@@ -18,6 +18,8 @@
 
 #include "igfxfmid.h"
 
+#include <array>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <vector>
@@ -51,6 +53,19 @@ constexpr int stallSamplingReportCategoryMask = 0xff;
 // Offset to access Stall Sampling Report Sub Slice and flags.
 constexpr int stallSamplingReportSubSliceAndFlagsOffset = 48;
 
+// Decodes all stall sampling report categories of a raw report at once.
+// Each category is a byte-wide field shifted by ipStallSamplingReportShift bits,
+// so the category bytes are copied once and extracted in a single loop.
+template <size_t categoryCount>
+inline void decodeStallSamplingReportCounts(const uint8_t *pRawIpData, std::array<uint8_t, categoryCount> &counts) {
+    std::array<uint8_t, categoryCount + 1> rawBytes;
+    std::memcpy(rawBytes.data(), pRawIpData + ipStallSamplingOffset, rawBytes.size());
+    for (size_t i = 0; i < categoryCount; i++) {
+        const uint16_t rawCount = static_cast<uint16_t>(rawBytes[i] | (rawBytes[i + 1] << 8));
+        counts[i] = static_cast<uint8_t>((rawCount >> ipStallSamplingReportShift) & stallSamplingReportCategoryMask);
+    }
+}
+
 struct Event;
 struct Device;
 struct EventPool;
@@ -110,6 +125,7 @@ class L0GfxCoreHelper : public NEO::ApiGfxCoreHelper {
     virtual void stallSumIpDataToTypedValues(uint64_t ip, void *sumIpData, std::vector<zet_typed_value_t> &ipDataValues) = 0;
     virtual bool stallIpDataMapUpdate(std::map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) = 0;
     virtual void stallIpDataMapDelete(std::map<uint64_t, void *> &stallSumIpDataMap) = 0;
+    virtual void stallIpDataMapMerge(std::map<uint64_t, void *> &stallSumIpDataMap, std::map<uint64_t, void *> &stallSumIpDataMapToMerge) = 0;
     virtual uint32_t getIpSamplingMetricCount() = 0;
     virtual bool synchronizedDispatchSupported() const = 0;
     virtual bool implicitSynchronizedDispatchForCooperativeKernelsAllowed() const = 0;
@@ -160,6 +176,7 @@ class L0GfxCoreHelperHw : public L0GfxCoreHelper {
     void stallSumIpDataToTypedValues(uint64_t ip, void *sumIpData, std::vector<zet_typed_value_t> &ipDataValues) override;
     bool stallIpDataMapUpdate(std::map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) override;
     void stallIpDataMapDelete(std::map<uint64_t, void *> &stallSumIpDataMap) override;
+    void stallIpDataMapMerge(std::map<uint64_t, void *> &stallSumIpDataMap, std::map<uint64_t, void *> &stallSumIpDataMapToMerge) override;
     uint32_t getIpSamplingMetricCount() override;
     bool synchronizedDispatchSupported() const override;
     bool implicitSynchronizedDispatchForCooperativeKernelsAllowed() const override;
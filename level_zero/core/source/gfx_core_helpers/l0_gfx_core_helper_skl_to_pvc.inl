@@ -91,47 +91,53 @@ void L0GfxCoreHelperHw<Family>::stallIpDataMapDelete(std::map<uint64_t, void *>
     }
 }
 
+template <typename Family>
+void L0GfxCoreHelperHw<Family>::stallIpDataMapMerge(std::map<uint64_t, void *> &stallSumIpDataMap, std::map<uint64_t, void *> &stallSumIpDataMapToMerge) {
+    for (auto &entry : stallSumIpDataMapToMerge) {
+        StallSumIpData_t *stallSumDataToMerge = reinterpret_cast<StallSumIpData_t *>(entry.second);
+        if (stallSumDataToMerge == nullptr) {
+            continue;
+        }
+        auto result = stallSumIpDataMap.emplace(entry.first, stallSumDataToMerge);
+        if (!result.second) {
+            StallSumIpData_t *stallSumData = reinterpret_cast<StallSumIpData_t *>(result.first->second);
+            stallSumData->activeCount += stallSumDataToMerge->activeCount;
+            stallSumData->otherCount += stallSumDataToMerge->otherCount;
+            stallSumData->controlCount += stallSumDataToMerge->controlCount;
+            stallSumData->pipeStallCount += stallSumDataToMerge->pipeStallCount;
+            stallSumData->sendCount += stallSumDataToMerge->sendCount;
+            stallSumData->distAccCount += stallSumDataToMerge->distAccCount;
+            stallSumData->sbidCount += stallSumDataToMerge->sbidCount;
+            stallSumData->syncCount += stallSumDataToMerge->syncCount;
+            stallSumData->instFetchCount += stallSumDataToMerge->instFetchCount;
+            delete stallSumDataToMerge;
+        }
+        entry.second = nullptr;
+    }
+}
+
 template <typename Family>
 bool L0GfxCoreHelperHw<Family>::stallIpDataMapUpdate(std::map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) {
-    const uint8_t *tempAddr = pRawIpData;
     uint64_t ip = 0ULL;
-    memcpy_s(reinterpret_cast<uint8_t *>(&ip), sizeof(ip), tempAddr, sizeof(ip));
+    memcpy_s(reinterpret_cast<uint8_t *>(&ip), sizeof(ip), pRawIpData, sizeof(ip));
     ip &= 0x1fffffff;
-    StallSumIpData_t *stallSumData = nullptr;
-    if (stallSumIpDataMap.count(ip) == 0) {
-        stallSumData = new StallSumIpData_t{};
-        stallSumData->activeCount = 0;
-        stallSumData->otherCount = 0;
-        stallSumData->controlCount = 0;
-        stallSumData->pipeStallCount = 0;
-        stallSumData->sendCount = 0;
-        stallSumData->distAccCount = 0;
-        stallSumData->sbidCount = 0;
-        stallSumData->syncCount = 0;
-        stallSumData->instFetchCount = 0;
-        stallSumIpDataMap[ip] = stallSumData;
-    } else {
-        stallSumData = reinterpret_cast<StallSumIpData_t *>(stallSumIpDataMap[ip]);
+    auto result = stallSumIpDataMap.emplace(ip, nullptr);
+    if (result.second) {
+        result.first->second = new StallSumIpData_t{};
     }
-    tempAddr += ipStallSamplingOffset;
-
-    auto getCount = [&tempAddr]() {
-        uint16_t tempCount = 0;
-        memcpy_s(reinterpret_cast<uint8_t *>(&tempCount), sizeof(tempCount), tempAddr, sizeof(tempCount));
-        tempCount = (tempCount >> ipStallSamplingReportShift) & stallSamplingReportCategoryMask;
-        tempAddr += 1;
-        return static_cast<uint8_t>(tempCount);
-    };
-
-    stallSumData->activeCount += getCount();
-    stallSumData->otherCount += getCount();
-    stallSumData->controlCount += getCount();
-    stallSumData->pipeStallCount += getCount();
-    stallSumData->sendCount += getCount();
-    stallSumData->distAccCount += getCount();
-    stallSumData->sbidCount += getCount();
-    stallSumData->syncCount += getCount();
-    stallSumData->instFetchCount += getCount();
+    StallSumIpData_t *stallSumData = reinterpret_cast<StallSumIpData_t *>(result.first->second);
+
+    std::array<uint8_t, 9> counts;
+    decodeStallSamplingReportCounts(pRawIpData, counts);
+    stallSumData->activeCount += counts[0];
+    stallSumData->otherCount += counts[1];
+    stallSumData->controlCount += counts[2];
+    stallSumData->pipeStallCount += counts[3];
+    stallSumData->sendCount += counts[4];
+    stallSumData->distAccCount += counts[5];
+    stallSumData->sbidCount += counts[6];
+    stallSumData->syncCount += counts[7];
+    stallSumData->instFetchCount += counts[8];
 
 #pragma pack(1)
     struct StallCntrInfo {
@@ -140,8 +146,7 @@ bool L0GfxCoreHelperHw<Family>::stallIpDataMapUpdate(std::map<uint64_t, void *>
     } stallCntrInfo = {};
 #pragma pack()
 
-    tempAddr = pRawIpData + stallSamplingReportSubSliceAndFlagsOffset;
-    memcpy_s(reinterpret_cast<uint8_t *>(&stallCntrInfo), sizeof(stallCntrInfo), tempAddr, sizeof(stallCntrInfo));
+    memcpy_s(reinterpret_cast<uint8_t *>(&stallCntrInfo), sizeof(stallCntrInfo), pRawIpData + stallSamplingReportSubSliceAndFlagsOffset, sizeof(stallCntrInfo));
 
     constexpr int32_t overflowDropFlag = (1 << 8);
     return stallCntrInfo.flags & overflowDropFlag;
@@ -251,6 +251,12 @@ ze_result_t KernelImp::getBaseAddress(uint64_t *baseAddress) {
 KernelImp::KernelImp(Module *module) : module(module) {}
 
 KernelImp::~KernelImp() {
+    for (auto &launchState : launchStates) {
+        launchState->destroy();
+    }
+    launchStates.clear();
+    freeLaunchStates.clear();
+
     if (nullptr != privateMemoryGraphicsAllocation) {
         module->getDevice()->getNEODevice()->getMemoryManager()->freeGraphicsMemory(privateMemoryGraphicsAllocation);
     }
@@ -428,14 +434,15 @@ ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSiz
     uint32_t dim = (globalSizeY > 1U) ? 2 : 1U;
     dim = (globalSizeZ > 1U) ? 3 : dim;
 
-    auto cachedGroupSize = std::find_if(this->suggestGroupSizeCache.begin(), this->suggestGroupSizeCache.end(), [&](const auto &other) {
-        return other.groupSize == workItems &&
-               other.slmArgsTotalSize == this->getSlmTotalSize();
-    });
-    if (cachedGroupSize != this->suggestGroupSizeCache.end()) {
-        *groupSizeX = static_cast<uint32_t>(cachedGroupSize->suggestedGroupSize.x);
-        *groupSizeY = static_cast<uint32_t>(cachedGroupSize->suggestedGroupSize.y);
-        *groupSizeZ = static_cast<uint32_t>(cachedGroupSize->suggestedGroupSize.z);
+    NEO::LocalWorkSizeCacheKey cacheKey;
+    cacheKey.globalSize = workItems;
+    cacheKey.slmTotalSize = this->getSlmTotalSize();
+    cacheKey.workDim = dim;
+    Vec3<size_t> cachedGroupSize = {0, 0, 0};
+    if (this->suggestGroupSizeCache.find(cacheKey, cachedGroupSize)) {
+        *groupSizeX = static_cast<uint32_t>(cachedGroupSize.x);
+        *groupSizeY = static_cast<uint32_t>(cachedGroupSize.y);
+        *groupSizeZ = static_cast<uint32_t>(cachedGroupSize.z);
         return ZE_RESULT_SUCCESS;
     }
 
@@ -472,7 +479,7 @@ ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSiz
     *groupSizeX = static_cast<uint32_t>(retGroupSize[0]);
     *groupSizeY = static_cast<uint32_t>(retGroupSize[1]);
     *groupSizeZ = static_cast<uint32_t>(retGroupSize[2]);
-    this->suggestGroupSizeCache.emplace_back(workItems, this->getSlmTotalSize(), retGroupSize);
+    this->suggestGroupSizeCache.insert(cacheKey, retGroupSize);
 
     return ZE_RESULT_SUCCESS;
 }
@@ -1460,4 +1467,61 @@ bool KernelImp::checkKernelContainsStatefulAccess() {
     return containsStatefulAccess && isUserKernel && isGeneratedByIgc;
 }
 
+KernelImp *KernelImp::acquireLaunchState(ze_result_t &result) {
+    if (this->printfBuffer != nullptr) {
+        result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        return nullptr;
+    }
+
+    KernelImp *launchState = nullptr;
+    {
+        // Pool is capped, concurrent launches above the cap wait for a launch state to be released
+        std::unique_lock<std::mutex> lock(launchStatesMutex);
+        const auto poolSize = getLaunchStatePoolSize();
+        launchStateReleased.wait(lock, [&] { return !freeLaunchStates.empty() || launchStatesReserved < poolSize; });
+        if (!freeLaunchStates.empty()) {
+            launchState = freeLaunchStates.back();
+            freeLaunchStates.pop_back();
+        } else {
+            launchStatesReserved++;
+        }
+    }
+
+    if (launchState == nullptr) {
+        ze_kernel_desc_t desc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+        desc.pKernelName = kernelImmData->getDescriptor().kernelMetadata.kernelName.c_str();
+        const auto productFamily = module->getDevice()->getNEODevice()->getHardwareInfo().platform.eProductFamily;
+        launchState = static_cast<KernelImp *>(Kernel::create(productFamily, module, &desc, &result));
+        std::lock_guard<std::mutex> lock(launchStatesMutex);
+        if (launchState == nullptr) {
+            launchStatesReserved--;
+            launchStateReleased.notify_one();
+            return nullptr;
+        }
+        launchStates.push_back(launchState);
+    }
+
+    launchState->unifiedMemoryControls = this->unifiedMemoryControls;
+    launchState->cacheConfigFlags = this->cacheConfigFlags;
+    launchState->setGlobalOffsetExp(this->globalOffsets[0], this->globalOffsets[1], this->globalOffsets[2]);
+
+    result = ZE_RESULT_SUCCESS;
+    return launchState;
+}
+
+void KernelImp::releaseLaunchState(KernelImp *launchState) {
+    {
+        std::lock_guard<std::mutex> lock(launchStatesMutex);
+        freeLaunchStates.push_back(launchState);
+    }
+    launchStateReleased.notify_one();
+}
+
+size_t KernelImp::getLaunchStatePoolSize() const {
+    if (NEO::debugManager.flags.KernelLaunchStatePoolSize.get() > 0) {
+        return static_cast<size_t>(NEO::debugManager.flags.KernelLaunchStatePoolSize.get());
+    }
+    return defaultLaunchStatePoolSize;
+}
+
 } // namespace L0
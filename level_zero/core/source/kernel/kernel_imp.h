@@ -10,6 +10,7 @@
 #include "shared/source/command_stream/thread_arbitration_policy.h"
 #include "shared/source/helpers/vec.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
+#include "shared/source/kernel/local_work_size_cache.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/unified_memory/unified_memory.h"
 
@@ -17,6 +18,7 @@
 #include "level_zero/core/source/module/module.h"
 #include "level_zero/core/source/module/module_imp.h"
 
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -195,6 +197,11 @@ struct KernelImp : Kernel {
 
     bool checkKernelContainsStatefulAccess();
 
+    static constexpr size_t defaultLaunchStatePoolSize = 8u;
+    size_t getLaunchStatePoolSize() const;
+    KernelImp *acquireLaunchState(ze_result_t &result);
+    void releaseLaunchState(KernelImp *launchState);
+
   protected:
     KernelImp() = default;
 
@@ -258,16 +265,15 @@ struct KernelImp : Kernel {
 
     std::unique_ptr<NEO::ImplicitArgs> pImplicitArgs;
 
-    std::unique_ptr<KernelExt> pExtension;
+    std::vector<KernelImp *> launchStates;
+    std::vector<KernelImp *> freeLaunchStates;
+    std::mutex launchStatesMutex;
+    std::condition_variable launchStateReleased;
+    size_t launchStatesReserved = 0u;
 
-    struct SuggestGroupSizeCacheEntry {
-        Vec3<size_t> groupSize;
-        uint32_t slmArgsTotalSize = 0u;
+    std::unique_ptr<KernelExt> pExtension;
 
-        Vec3<size_t> suggestedGroupSize;
-        SuggestGroupSizeCacheEntry(size_t groupSize[3], uint32_t slmArgsTotalSize, size_t suggestedGroupSize[3]) : groupSize(groupSize), slmArgsTotalSize(slmArgsTotalSize), suggestedGroupSize(suggestedGroupSize){};
-    };
-    std::vector<SuggestGroupSizeCacheEntry> suggestGroupSizeCache;
+    NEO::LocalWorkSizeCache suggestGroupSizeCache;
 };
 
 } // namespace L0
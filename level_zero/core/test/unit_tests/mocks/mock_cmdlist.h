@@ -202,6 +202,8 @@ struct WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>
     using BaseClass::engineGroupType;
     using BaseClass::eventSignalPipeControl;
     using BaseClass::finalStreamState;
+    using BaseClass::flushCoalescingMaxAppends;
+    using BaseClass::flushCoalescingTimeoutUs;
     using BaseClass::frontEndStateTracking;
     using BaseClass::getDcFlushRequired;
     using BaseClass::getHostPtrAlloc;
@@ -221,6 +223,8 @@ struct WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>
     using BaseClass::latestFlushIsHostVisible;
     using BaseClass::latestOperationRequiredNonWalkerInOrderCmdsChaining;
     using BaseClass::partitionCount;
+    using BaseClass::pendingFlushAppends;
+    using BaseClass::pendingFlushStartTime;
     using BaseClass::pipeControlMultiKernelEventSync;
     using BaseClass::pipelineSelectStateTracking;
     using BaseClass::programRegionGroupBarrier;
@@ -94,7 +94,11 @@ struct MockCommandQueueHw : public L0::CommandQueueHw<gfxCoreFamily> {
     using L0::CommandQueue::stateBaseAddressTracking;
     using L0::CommandQueue::stateComputeModeTracking;
     using L0::CommandQueueImp::csr;
+    using L0::CommandQueueImp::executionPlanCacheEnabled;
+    using L0::CommandQueueImp::executionPlans;
+    using L0::CommandQueueImp::expandCommandListSegments;
     using typename BaseClass::CommandListExecutionContext;
+    using typename BaseClass::CommandListsWithSegments;
 
     MockCommandQueueHw(L0::Device *device, NEO::CommandStreamReceiver *csr, const ze_command_queue_desc_t *desc) : L0::CommandQueueHw<gfxCoreFamily>(device, csr, desc) {
     }
@@ -133,6 +137,18 @@ struct MockCommandQueueHw : public L0::CommandQueueHw<gfxCoreFamily> {
         return BaseClass::executeCommandListsRegular(ctx, numCommandLists, commandListHandles, hFence, parentImmediateCommandlistLinearStream);
     }
 
+    size_t estimateFrontEndCmdSizeForMultipleCommandLists(bool &isFrontEndStateDirty, int32_t engineInstanced, L0::CommandList *commandList,
+                                                          NEO::StreamProperties &csrState,
+                                                          const NEO::StreamProperties &cmdListRequired,
+                                                          const NEO::StreamProperties &cmdListFinal,
+                                                          NEO::StreamProperties &requiredState,
+                                                          bool &propertyDirty,
+                                                          bool &frontEndReturnPoint) override {
+        estimateFrontEndCmdSizeForMultipleCommandListsCalled++;
+        return BaseClass::estimateFrontEndCmdSizeForMultipleCommandLists(isFrontEndStateDirty, engineInstanced, commandList, csrState, cmdListRequired, cmdListFinal,
+                                                                         requiredState, propertyDirty, frontEndReturnPoint);
+    }
+
     ze_result_t initialize(bool copyOnly, bool isInternal, bool immediateCmdListQueue) override {
         auto returnCode = BaseClass::initialize(copyOnly, isInternal, immediateCmdListQueue);
 
@@ -145,6 +161,7 @@ struct MockCommandQueueHw : public L0::CommandQueueHw<gfxCoreFamily> {
     NEO::GraphicsAllocation *recordedGlobalStatelessAllocation = nullptr;
     NEO::ScratchSpaceController *recordedScratchController = nullptr;
     uint32_t synchronizedCalled = 0;
+    uint32_t estimateFrontEndCmdSizeForMultipleCommandListsCalled = 0;
     NEO::ResidencyContainer residencyContainerSnapshot;
     ze_result_t synchronizeReturnValue{ZE_RESULT_SUCCESS};
     std::optional<NEO::WaitStatus> reserveLinearStreamSizeReturnValue{};
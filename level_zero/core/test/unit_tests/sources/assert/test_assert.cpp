@@ -575,5 +575,58 @@ TEST_F(EventAssertTest, GivenEventSignalledWhenHostSynchronizeIsCalledThenAssert
     EXPECT_EQ(1u, assertHandler->printAssertAndAbortCalled);
 }
 
+
+TEST_F(EventAssertTest, GivenGpuHangWhenHostSynchronizeMultipleIsCalledThenAssertIsChecked) {
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr->isGpuHangDetectedReturnValue = true;
+
+    event->setUsingContextEndOffset(false);
+    event->csrs[0] = csr.get();
+    event->gpuHangCheckPeriod = std::chrono::microseconds::zero();
+    auto assertHandler = new MockAssertHandler(device->getNEODevice());
+    neoDevice->getRootDeviceEnvironmentRef().assertHandler.reset(assertHandler);
+
+    Event *events[] = {event.get()};
+    auto result = Event::hostSynchronizeMultiple(1, events, true, std::numeric_limits<std::uint64_t>::max(), nullptr);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, result);
+    EXPECT_EQ(1u, assertHandler->printAssertAndAbortCalled);
+}
+
+TEST_F(EventAssertTest, GivenNoGpuHangAndOneNanosecondTimeoutWhenHostSynchronizeMultipleIsCalledThenAssertIsChecked) {
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr->isGpuHangDetectedReturnValue = false;
+
+    event->setUsingContextEndOffset(false);
+    event->csrs[0] = csr.get();
+    event->gpuHangCheckPeriod = std::chrono::microseconds::zero();
+    auto assertHandler = new MockAssertHandler(device->getNEODevice());
+    neoDevice->getRootDeviceEnvironmentRef().assertHandler.reset(assertHandler);
+
+    Event *events[] = {event.get()};
+    auto result = Event::hostSynchronizeMultiple(1, events, true, 1, nullptr);
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, result);
+    EXPECT_EQ(1u, assertHandler->printAssertAndAbortCalled);
+}
+
+TEST_F(EventAssertTest, GivenEventSignalledWhenHostSynchronizeMultipleIsCalledThenAssertIsChecked) {
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    uint32_t *hostAddr = static_cast<uint32_t *>(event->getHostAddress());
+    *hostAddr = Event::STATE_SIGNALED;
+
+    event->setUsingContextEndOffset(false);
+    event->csrs[0] = csr.get();
+
+    auto assertHandler = new MockAssertHandler(device->getNEODevice());
+    neoDevice->getRootDeviceEnvironmentRef().assertHandler.reset(assertHandler);
+
+    Event *events[] = {event.get()};
+    auto result = Event::hostSynchronizeMultiple(1, events, true, 1, nullptr);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(1u, assertHandler->printAssertAndAbortCalled);
+}
+
 } // namespace ult
 } // namespace L0
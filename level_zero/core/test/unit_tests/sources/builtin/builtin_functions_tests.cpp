@@ -34,9 +34,12 @@ class BuiltinFunctionsLibFixture : public DeviceFixture {
     struct MockBuiltinFunctionsLibImpl : BuiltinFunctionsLibImpl {
         using BuiltinFunctionsLibImpl::builtins;
         using BuiltinFunctionsLibImpl::ensureInitCompletion;
+        using BuiltinFunctionsLibImpl::firstFunctionRequested;
         using BuiltinFunctionsLibImpl::getFunction;
         using BuiltinFunctionsLibImpl::imageBuiltins;
         using BuiltinFunctionsLibImpl::initAsyncComplete;
+        using BuiltinFunctionsLibImpl::isBuiltinOpNeeded;
+        using BuiltinFunctionsLibImpl::prefetchThreads;
         MockBuiltinFunctionsLibImpl(L0::Device *device, NEO::BuiltIns *builtInsLib) : BuiltinFunctionsLibImpl(device, builtInsLib) {
             mockModule = std::unique_ptr<Module>(new Mock<Module>(device, nullptr));
         }
@@ -163,6 +166,10 @@ HWTEST_F(TestBuiltinFunctionsLibImpl, givenHeaplessBuiltinsWhenInitBuiltinKernel
     EXPECT_EQ(NEO::EBuiltInOps::copyBufferToBufferStatelessHeapless, lib.builtinPassed);
     EXPECT_STREQ("CopyBufferToBufferMiddleRegion", lib.kernelNamePassed.c_str());
 
+    lib.initBuiltinKernel(L0::Builtin::copyBufferToBufferMiddleGridStrideStatelessHeapless);
+    EXPECT_EQ(NEO::EBuiltInOps::copyBufferToBufferStatelessHeapless, lib.builtinPassed);
+    EXPECT_STREQ("CopyBufferToBufferMiddleRegionGridStride", lib.kernelNamePassed.c_str());
+
     lib.initBuiltinKernel(L0::Builtin::copyBufferToBufferSideStatelessHeapless);
     EXPECT_EQ(NEO::EBuiltInOps::copyBufferToBufferStatelessHeapless, lib.builtinPassed);
     EXPECT_STREQ("CopyBufferToBufferSideRegion", lib.kernelNamePassed.c_str());
@@ -212,6 +219,92 @@ HWTEST_F(TestBuiltinFunctionsLibImpl, givenCompilerInterfaceWhenCreateDeviceThen
     }
 }
 
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenPrefetchedBuiltinsWhenGettingFunctionsThenPrefetchedKernelsAreReturned) {
+    mockBuiltinFunctionsLibImpl->prefetchBuiltins();
+    EXPECT_FALSE(mockBuiltinFunctionsLibImpl->prefetchThreads.empty());
+    EXPECT_GE(4u, mockBuiltinFunctionsLibImpl->prefetchThreads.size());
+    mockBuiltinFunctionsLibImpl->waitForPrefetchCompletion();
+
+    uint32_t expectedPrefetched = 0u;
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::count); builtId++) {
+        if (mockBuiltinFunctionsLibImpl->builtins[builtId] == nullptr) {
+            continue;
+        }
+        expectedPrefetched++;
+        auto prefetchedKernel = mockBuiltinFunctionsLibImpl->builtins[builtId]->func.get();
+        EXPECT_EQ(prefetchedKernel, mockBuiltinFunctionsLibImpl->getFunction(static_cast<L0::Builtin>(builtId)));
+    }
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(ImageBuiltin::count); builtId++) {
+        if (mockBuiltinFunctionsLibImpl->imageBuiltins[builtId] == nullptr) {
+            continue;
+        }
+        expectedPrefetched++;
+        auto prefetchedKernel = mockBuiltinFunctionsLibImpl->imageBuiltins[builtId]->func.get();
+        EXPECT_EQ(prefetchedKernel, mockBuiltinFunctionsLibImpl->getImageFunction(static_cast<L0::ImageBuiltin>(builtId)));
+    }
+
+    EXPECT_NE(0u, expectedPrefetched);
+    EXPECT_NE(nullptr, mockBuiltinFunctionsLibImpl->builtins[static_cast<uint32_t>(Builtin::queryKernelTimestamps)]);
+
+    auto statistics = mockBuiltinFunctionsLibImpl->getPrefetchStatistics();
+    EXPECT_EQ(expectedPrefetched, statistics.prefetchedBuiltins);
+    EXPECT_NE(0u, statistics.timeToFirstFunctionNs);
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenPrefetchNotStartedWhenGettingFunctionsThenFirstFunctionRequestIsNotTimed) {
+    EXPECT_NE(nullptr, mockBuiltinFunctionsLibImpl->getFunction(Builtin::fillBufferImmediate));
+    EXPECT_NE(nullptr, mockBuiltinFunctionsLibImpl->getImageFunction(ImageBuiltin::copyImageRegion));
+
+    EXPECT_FALSE(mockBuiltinFunctionsLibImpl->firstFunctionRequested);
+    auto statistics = mockBuiltinFunctionsLibImpl->getPrefetchStatistics();
+    EXPECT_EQ(0u, statistics.timeToFirstFunctionNs);
+    EXPECT_EQ(0u, statistics.firstFunctionWaitNs);
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenPrefetchInProgressWhenGettingFunctionThenEachBuiltinIsLoadedOnlyOnce) {
+    mockBuiltinFunctionsLibImpl->prefetchBuiltins();
+
+    L0::Kernel *requestedKernels[static_cast<uint32_t>(Builtin::count)] = {};
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::count); builtId++) {
+        requestedKernels[builtId] = mockBuiltinFunctionsLibImpl->getFunction(static_cast<L0::Builtin>(builtId));
+        EXPECT_NE(nullptr, requestedKernels[builtId]);
+    }
+    mockBuiltinFunctionsLibImpl->waitForPrefetchCompletion();
+
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::count); builtId++) {
+        EXPECT_EQ(requestedKernels[builtId], mockBuiltinFunctionsLibImpl->builtins[builtId]->func.get());
+    }
+    EXPECT_GE(static_cast<uint32_t>(Builtin::count) + static_cast<uint32_t>(ImageBuiltin::count), mockBuiltinFunctionsLibImpl->getPrefetchStatistics().prefetchedBuiltins);
+}
+
+TEST(BuiltinFunctionsLibImplPrefetchTest, givenHeaplessModeWhenCheckingIfBuiltinOpIsNeededThenOnlyMatchingBufferVariantsArePrefetched) {
+    using Lib = BuiltinFunctionsLibFixture::MockBuiltinFunctionsLibImpl;
+
+    EXPECT_TRUE(Lib::isBuiltinOpNeeded(NEO::EBuiltInOps::copyBufferToBuffer, false));
+    EXPECT_TRUE(Lib::isBuiltinOpNeeded(NEO::EBuiltInOps::fillBufferStateless, false));
+    EXPECT_FALSE(Lib::isBuiltinOpNeeded(NEO::EBuiltInOps::copyBufferToBufferStatelessHeapless, false));
+    EXPECT_FALSE(Lib::isBuiltinOpNeeded(NEO::EBuiltInOps::fillBufferStatelessHeapless, false));
+
+    EXPECT_FALSE(Lib::isBuiltinOpNeeded(NEO::EBuiltInOps::copyBufferToBuffer, true));
+    EXPECT_FALSE(Lib::isBuiltinOpNeeded(NEO::EBuiltInOps::copyBufferRectStateless, true));
+    EXPECT_FALSE(Lib::isBuiltinOpNeeded(NEO::EBuiltInOps::fillBuffer, true));
+    EXPECT_TRUE(Lib::isBuiltinOpNeeded(NEO::EBuiltInOps::copyBufferToBufferStatelessHeapless, true));
+    EXPECT_TRUE(Lib::isBuiltinOpNeeded(NEO::EBuiltInOps::fillBufferStatelessHeapless, true));
+    EXPECT_TRUE(Lib::isBuiltinOpNeeded(NEO::EBuiltInOps::copyImageToImage2d, true));
+    EXPECT_TRUE(Lib::isBuiltinOpNeeded(NEO::EBuiltInOps::queryKernelTimestamps, true));
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenPrefetchBuiltinsInBackgroundDebugFlagWhenCheckingIfPrefetchIsEnabledThenFlagValueIsReturned) {
+    DebugManagerStateRestore restore;
+    EXPECT_FALSE(BuiltinFunctionsLibImpl::prefetchBuiltinsEnabled());
+
+    NEO::debugManager.flags.PrefetchBuiltinsInBackground.set(0);
+    EXPECT_FALSE(BuiltinFunctionsLibImpl::prefetchBuiltinsEnabled());
+
+    NEO::debugManager.flags.PrefetchBuiltinsInBackground.set(1);
+    EXPECT_TRUE(BuiltinFunctionsLibImpl::prefetchBuiltinsEnabled());
+}
+
 using BuiltInTestsL0 = Test<NEO::DeviceFixture>;
 
 HWTEST_F(BuiltInTestsL0, givenRebuildPrecompiledKernelsDebugFlagWhenInitFuctionsThenIntermediateCodeForBuiltinsIsRequested) {
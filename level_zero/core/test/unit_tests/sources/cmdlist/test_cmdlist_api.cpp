@@ -22,6 +22,19 @@ TEST(zeCommandListClose, whenCalledThenRedirectedToObject) {
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST(zeCommandListClose, givenCommandListSegmentWhenClosingResettingOrDestroyingThenErrorIsReturned) {
+    MockCommandList parent;
+    MockCommandList segment;
+    segment.setParentCommandList(&parent);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zeCommandListClose(segment.toHandle()));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zeCommandListReset(segment.toHandle()));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zeCommandListDestroy(segment.toHandle()));
+    EXPECT_EQ(0u, segment.closeCalled);
+    EXPECT_EQ(0u, segment.resetCalled);
+    EXPECT_EQ(0u, segment.destroyCalled);
+}
+
 TEST(zeCommandListAppendMemoryPrefetch, whenCalledThenRedirectedToObject) {
     MockCommandList commandList;
 
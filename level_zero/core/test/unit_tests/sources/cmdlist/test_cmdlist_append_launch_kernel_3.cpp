@@ -19,6 +19,7 @@
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/api/driver_experimental/public/zex_cmdlist.h"
 #include "level_zero/core/source/event/event.h"
 #include "level_zero/core/test/unit_tests/fixtures/module_fixture.h"
 #include "level_zero/core/test/unit_tests/fixtures/multi_tile_fixture.h"
@@ -28,6 +29,9 @@
 #include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_module.h"
 
+#include <atomic>
+#include <thread>
+
 namespace L0 {
 namespace ult {
 
@@ -1111,5 +1115,158 @@ HWTEST2_F(MultiTileImmediateCommandListAppendLaunchKernelXeHpCoreTest, givenImpl
     auto cmdBbStart = genCmdCast<MI_BATCH_BUFFER_START *>(*itorBbStart);
     EXPECT_EQ(MI_BATCH_BUFFER_START::SECOND_LEVEL_BATCH_BUFFER::SECOND_LEVEL_BATCH_BUFFER_SECOND_LEVEL_BATCH, cmdBbStart->getSecondLevelBatchBuffer());
 }
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenKernelWhenAppendingLaunchWithArgumentsThenKernelStateIsNotModifiedAndLaunchStateIsReused, IsAtLeastSkl) {
+    auto kernel = createKernelWithName("memcpy_bytes_attr");
+    ASSERT_EQ(2u, kernel->kernelImmData->getDescriptor().payloadMappings.explicitArgs.size());
+    std::vector<uint8_t> crossThreadDataBefore(kernel->crossThreadData.get(), kernel->crossThreadData.get() + kernel->crossThreadDataSize);
+    uint32_t groupSizeBefore[3] = {kernel->groupSize[0], kernel->groupSize[1], kernel->groupSize[2]};
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::compute, 0u, returnValue, false));
+    auto commandStream = commandList->getCmdContainer().getCommandStream();
+
+    size_t argSizes[2] = {sizeof(void *), sizeof(void *)};
+    const void *argValues[2] = {nullptr, nullptr};
+    zex_kernel_launch_args_desc_t argsDesc = {4u, 2u, 1u, 2u, argSizes, argValues};
+    ze_group_count_t groupCount{2, 1, 1};
+
+    auto usedBefore = commandStream->getUsed();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListAppendLaunchKernelWithArguments(commandList->toHandle(), kernel->toHandle(), &groupCount, &argsDesc, nullptr, 0, nullptr));
+    EXPECT_LT(usedBefore, commandStream->getUsed());
+
+    usedBefore = commandStream->getUsed();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListAppendLaunchKernelWithArguments(commandList->toHandle(), kernel->toHandle(), &groupCount, &argsDesc, nullptr, 0, nullptr));
+    EXPECT_LT(usedBefore, commandStream->getUsed());
+
+    ASSERT_EQ(1u, kernel->launchStates.size());
+    EXPECT_EQ(1u, kernel->freeLaunchStates.size());
+    auto launchStateGroupSize = kernel->launchStates[0]->getGroupSize();
+    EXPECT_EQ(4u, launchStateGroupSize[0]);
+    EXPECT_EQ(2u, launchStateGroupSize[1]);
+    EXPECT_EQ(1u, launchStateGroupSize[2]);
+
+    EXPECT_EQ(groupSizeBefore[0], kernel->groupSize[0]);
+    EXPECT_EQ(groupSizeBefore[1], kernel->groupSize[1]);
+    EXPECT_EQ(groupSizeBefore[2], kernel->groupSize[2]);
+    EXPECT_EQ(0, memcmp(crossThreadDataBefore.data(), kernel->crossThreadData.get(), crossThreadDataBefore.size()));
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenArgumentsCountNotMatchingKernelWhenAppendingLaunchWithArgumentsThenErrorIsReturned, IsAtLeastSkl) {
+    auto kernel = createKernelWithName("memcpy_bytes_attr");
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::compute, 0u, returnValue, false));
+
+    size_t argSizes[1] = {sizeof(void *)};
+    const void *argValues[1] = {nullptr};
+    zex_kernel_launch_args_desc_t argsDesc = {1u, 1u, 1u, 1u, argSizes, argValues};
+    ze_group_count_t groupCount{1, 1, 1};
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX, zexCommandListAppendLaunchKernelWithArguments(commandList->toHandle(), kernel->toHandle(), &groupCount, &argsDesc, nullptr, 0, nullptr));
+    EXPECT_EQ(0u, kernel->launchStates.size());
+
+    argsDesc.numArgs = 2u;
+    argsDesc.pArgSizes = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandListAppendLaunchKernelWithArguments(commandList->toHandle(), kernel->toHandle(), &groupCount, &argsDesc, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandListAppendLaunchKernelWithArguments(commandList->toHandle(), kernel->toHandle(), &groupCount, nullptr, nullptr, 0, nullptr));
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenInvalidGroupSizeWhenAppendingLaunchWithArgumentsThenErrorIsReturnedAndLaunchStateIsReleased, IsAtLeastSkl) {
+    auto kernel = createKernelWithName("memcpy_bytes_attr");
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::compute, 0u, returnValue, false));
+    auto commandStream = commandList->getCmdContainer().getCommandStream();
+
+    size_t argSizes[2] = {sizeof(void *), sizeof(void *)};
+    const void *argValues[2] = {nullptr, nullptr};
+    zex_kernel_launch_args_desc_t argsDesc = {0u, 1u, 1u, 2u, argSizes, argValues};
+    ze_group_count_t groupCount{1, 1, 1};
+
+    auto usedBefore = commandStream->getUsed();
+    EXPECT_NE(ZE_RESULT_SUCCESS, zexCommandListAppendLaunchKernelWithArguments(commandList->toHandle(), kernel->toHandle(), &groupCount, &argsDesc, nullptr, 0, nullptr));
+    EXPECT_EQ(usedBefore, commandStream->getUsed());
+    EXPECT_EQ(1u, kernel->launchStates.size());
+    EXPECT_EQ(1u, kernel->freeLaunchStates.size());
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenKernelUsingPrintfWhenAppendingLaunchWithArgumentsThenUnsupportedFeatureIsReturned, IsAtLeastSkl) {
+    createKernel();
+    ASSERT_NE(nullptr, kernel->getPrintfBufferAllocation());
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::compute, 0u, returnValue, false));
+
+    auto numArgs = static_cast<uint32_t>(kernel->kernelImmData->getDescriptor().payloadMappings.explicitArgs.size());
+    std::vector<size_t> argSizes(numArgs, sizeof(void *));
+    std::vector<const void *> argValues(numArgs, nullptr);
+    zex_kernel_launch_args_desc_t argsDesc = {1u, 1u, 1u, numArgs, argSizes.data(), argValues.data()};
+    ze_group_count_t groupCount{1, 1, 1};
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, zexCommandListAppendLaunchKernelWithArguments(commandList->toHandle(), kernel->toHandle(), &groupCount, &argsDesc, nullptr, 0, nullptr));
+    EXPECT_EQ(0u, kernel->launchStates.size());
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenLaunchStatesInUseWhenAcquiringLaunchStateThenNewLaunchStateIsCreatedWithParentKernelSettings, IsAtLeastSkl) {
+    auto kernel = createKernelWithName("memcpy_bytes_attr");
+    kernel->setIndirectAccess(ZE_KERNEL_INDIRECT_ACCESS_FLAG_DEVICE);
+    kernel->setGlobalOffsetExp(1u, 2u, 3u);
+
+    ze_result_t result = ZE_RESULT_ERROR_UNKNOWN;
+    auto firstLaunchState = kernel->acquireLaunchState(result);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, firstLaunchState);
+    auto secondLaunchState = kernel->acquireLaunchState(result);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, secondLaunchState);
+    EXPECT_NE(firstLaunchState, secondLaunchState);
+    EXPECT_EQ(2u, kernel->launchStates.size());
+
+    EXPECT_TRUE(secondLaunchState->getUnifiedMemoryControls().indirectDeviceAllocationsAllowed);
+    EXPECT_EQ(1u, secondLaunchState->getGlobalOffsets()[0]);
+    EXPECT_EQ(2u, secondLaunchState->getGlobalOffsets()[1]);
+    EXPECT_EQ(3u, secondLaunchState->getGlobalOffsets()[2]);
+
+    kernel->releaseLaunchState(firstLaunchState);
+    kernel->releaseLaunchState(secondLaunchState);
+    EXPECT_EQ(2u, kernel->freeLaunchStates.size());
+
+    EXPECT_EQ(secondLaunchState, kernel->acquireLaunchState(result));
+    EXPECT_EQ(2u, kernel->launchStates.size());
+    kernel->releaseLaunchState(secondLaunchState);
+}
+
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenLaunchStatePoolFullWhenAcquiringLaunchStateThenCallerWaitsForReleasedLaunchStateInsteadOfCreatingNewOne, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.KernelLaunchStatePoolSize.set(1);
+    auto kernel = createKernelWithName("memcpy_bytes_attr");
+    EXPECT_EQ(1u, kernel->getLaunchStatePoolSize());
+
+    ze_result_t result = ZE_RESULT_ERROR_UNKNOWN;
+    auto firstLaunchState = kernel->acquireLaunchState(result);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, firstLaunchState);
+
+    std::atomic<L0::KernelImp *> secondLaunchState{nullptr};
+    std::thread waitingThread([&] {
+        ze_result_t waitingResult = ZE_RESULT_ERROR_UNKNOWN;
+        secondLaunchState = kernel->acquireLaunchState(waitingResult);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(nullptr, secondLaunchState.load());
+    kernel->releaseLaunchState(firstLaunchState);
+    waitingThread.join();
+
+    EXPECT_EQ(firstLaunchState, secondLaunchState.load());
+    EXPECT_EQ(1u, kernel->launchStates.size());
+    kernel->releaseLaunchState(secondLaunchState);
+
+    debugManager.flags.KernelLaunchStatePoolSize.set(-1);
+    EXPECT_EQ(L0::KernelImp::defaultLaunchStatePoolSize, kernel->getLaunchStatePoolSize());
+}
+
 } // namespace ult
 } // namespace L0
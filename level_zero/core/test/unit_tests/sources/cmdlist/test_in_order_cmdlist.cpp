@@ -23,6 +23,7 @@
 #include "shared/test/common/test_macros/hw_test.h"
 
 #include "level_zero/api/driver_experimental/public/zex_api.h"
+#include "level_zero/core/source/cmdlist/cmdlist_flush_coalescing_controller.h"
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
 #include "level_zero/core/source/event/event.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
@@ -7898,5 +7899,217 @@ HWTEST2_F(InOrderCmdListTests, givenInOrderModeWhenAppendingKernelInCommandViewM
     ASSERT_EQ(0u, regularCmdList->inOrderPatchCmds.size());
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+class FlushCoalescingMockCmdList : public WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>> {
+  public:
+    using BaseClass = WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>;
+    using BaseClass::BaseClass;
+
+    ze_result_t flushImmediate(ze_result_t inputRet, bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, bool copyOffloadSubmission, ze_event_handle_t hSignalEvent, bool requireTaskCountUpdate) override {
+        flushData.push_back(this->cmdListCurrentStartOffset);
+
+        this->cmdListCurrentStartOffset = this->commandContainer.getCommandStream()->getUsed();
+
+        return flushImmediateResult;
+    }
+
+    std::vector<size_t> flushData; // start_offset
+    ze_result_t flushImmediateResult = ZE_RESULT_SUCCESS;
+};
+
+struct InOrderFlushCoalescingTests : public InOrderCmdListTests {
+    void SetUp() override {
+        debugManager.flags.EnableImmediateCmdListFlushCoalescing.set(1);
+        debugManager.flags.ImmediateCmdListFlushCoalescingMaxAppends.set(3);
+        debugManager.flags.ImmediateCmdListFlushCoalescingTimeoutUs.set(1000000000);
+
+        InOrderCmdListTests::SetUp();
+
+        kernel->surfaceStateHeapDataSize = 0;
+    }
+};
+
+HWTEST2_F(InOrderFlushCoalescingTests, givenFlushCoalescingEnabledWhenAppendingKernelsWithoutSignalEventThenFlushIsDeferredUntilMaxAppendsIsReached, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdListImpl<gfxCoreFamily, FlushCoalescingMockCmdList<gfxCoreFamily>>(false);
+    EXPECT_EQ(3u, immCmdList->flushCoalescingMaxAppends);
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+
+    EXPECT_EQ(0u, immCmdList->flushData.size());
+    EXPECT_EQ(2u, immCmdList->pendingFlushAppends);
+    EXPECT_EQ(2u, immCmdList->inOrderExecInfo->getCounterValue());
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+
+    ASSERT_EQ(1u, immCmdList->flushData.size());
+    EXPECT_EQ(0u, immCmdList->flushData[0]);
+    EXPECT_EQ(0u, immCmdList->pendingFlushAppends);
+    EXPECT_EQ(3u, immCmdList->inOrderExecInfo->getCounterValue());
+}
+
+HWTEST2_F(InOrderFlushCoalescingTests, givenPendingAppendsWhenAppendingKernelWithSignalEventThenPendingAppendsAreFlushedFirst, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdListImpl<gfxCoreFamily, FlushCoalescingMockCmdList<gfxCoreFamily>>(false);
+    auto eventPool = createEvents<FamilyType>(1, false);
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    EXPECT_EQ(1u, immCmdList->pendingFlushAppends);
+
+    auto offsetAfterPendingAppend = immCmdList->getCmdContainer().getCommandStream()->getUsed();
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, events[0]->toHandle(), 0, nullptr, launchParams, false);
+
+    ASSERT_EQ(2u, immCmdList->flushData.size());
+    EXPECT_EQ(0u, immCmdList->flushData[0]);
+    EXPECT_EQ(offsetAfterPendingAppend, immCmdList->flushData[1]);
+    EXPECT_EQ(0u, immCmdList->pendingFlushAppends);
+}
+
+HWTEST2_F(InOrderFlushCoalescingTests, givenPendingAppendsWhenAppendingNonKernelOperationThenPendingAppendsAreFlushedFirst, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdListImpl<gfxCoreFamily, FlushCoalescingMockCmdList<gfxCoreFamily>>(false);
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    EXPECT_EQ(1u, immCmdList->pendingFlushAppends);
+
+    immCmdList->appendBarrier(nullptr, 0, nullptr, false);
+
+    EXPECT_LE(1u, immCmdList->flushData.size());
+    EXPECT_EQ(0u, immCmdList->flushData[0]);
+    EXPECT_EQ(0u, immCmdList->pendingFlushAppends);
+}
+
+HWTEST2_F(InOrderFlushCoalescingTests, givenPendingAppendsWhenHostSynchronizeIsCalledThenPendingAppendsAreFlushed, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdListImpl<gfxCoreFamily, FlushCoalescingMockCmdList<gfxCoreFamily>>(false);
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    EXPECT_EQ(0u, immCmdList->flushData.size());
+
+    immCmdList->hostSynchronize(0, false);
+
+    ASSERT_EQ(1u, immCmdList->flushData.size());
+    EXPECT_EQ(0u, immCmdList->flushData[0]);
+    EXPECT_EQ(0u, immCmdList->pendingFlushAppends);
+}
+
+HWTEST2_F(InOrderFlushCoalescingTests, givenKernelUsingSurfaceStateHeapWhenAppendingThenFlushIsNotDeferred, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdListImpl<gfxCoreFamily, FlushCoalescingMockCmdList<gfxCoreFamily>>(false);
+    if (immCmdList->cmdListHeapAddressModel == NEO::HeapAddressModel::globalStateless) {
+        GTEST_SKIP();
+    }
+
+    kernel->surfaceStateHeapDataSize = 64;
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+
+    EXPECT_EQ(1u, immCmdList->flushData.size());
+    EXPECT_EQ(0u, immCmdList->pendingFlushAppends);
+}
+
+HWTEST2_F(InOrderCmdListTests, givenFlushCoalescingNotEnabledWhenAppendingKernelsThenEachAppendIsFlushed, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdListImpl<gfxCoreFamily, FlushCoalescingMockCmdList<gfxCoreFamily>>(false);
+    EXPECT_EQ(0u, immCmdList->flushCoalescingMaxAppends);
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+
+    EXPECT_EQ(2u, immCmdList->flushData.size());
+    EXPECT_EQ(0u, immCmdList->pendingFlushAppends);
+}
+
+HWTEST2_F(InOrderFlushCoalescingTests, givenPendingAppendsWhenResetIsCalledThenPendingAppendsAreFlushedFirst, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdListImpl<gfxCoreFamily, FlushCoalescingMockCmdList<gfxCoreFamily>>(false);
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    EXPECT_EQ(0u, immCmdList->flushData.size());
+
+    immCmdList->reset();
+
+    ASSERT_EQ(1u, immCmdList->flushData.size());
+    EXPECT_EQ(0u, immCmdList->flushData[0]);
+    EXPECT_EQ(0u, immCmdList->pendingFlushAppends);
+}
+
+HWTEST2_F(InOrderFlushCoalescingTests, givenPendingAppendsWhenCheckingTimeoutThenAppendsAreFlushedOnlyAfterTimeoutIsReached, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdListImpl<gfxCoreFamily, FlushCoalescingMockCmdList<gfxCoreFamily>>(false);
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+
+    immCmdList->flushCoalescingTimeoutUs = 1000;
+    immCmdList->flushPendingAppendsIfTimeoutReached();
+    EXPECT_EQ(0u, immCmdList->flushData.size());
+
+    immCmdList->pendingFlushStartTime -= std::chrono::milliseconds(2);
+    immCmdList->flushPendingAppendsIfTimeoutReached();
+
+    ASSERT_EQ(1u, immCmdList->flushData.size());
+    EXPECT_EQ(0u, immCmdList->pendingFlushAppends);
+}
+
+HWTEST2_F(InOrderFlushCoalescingTests, givenCommandListRegisteredInFlushCoalescingControllerWhenFlushingAllThenPendingAppendsAreFlushed, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdListImpl<gfxCoreFamily, FlushCoalescingMockCmdList<gfxCoreFamily>>(false);
+    FlushCoalescingController controller(std::chrono::hours(1));
+    controller.registerCommandList(immCmdList.get());
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    EXPECT_EQ(0u, immCmdList->flushData.size());
+
+    controller.flushAll();
+    EXPECT_EQ(1u, immCmdList->flushData.size());
+
+    controller.unregisterCommandList(immCmdList.get());
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+
+    controller.flushAll();
+    EXPECT_EQ(1u, immCmdList->flushData.size());
+    EXPECT_EQ(1u, immCmdList->pendingFlushAppends);
+}
+
+
+HWTEST2_F(InOrderFlushCoalescingTests, givenTimeoutNotGreaterThanZeroWhenCreatingCommandListThenDefaultTimeoutIsUsed, IsAtLeastSkl) {
+    for (auto timeout : {0, -2}) {
+        debugManager.flags.ImmediateCmdListFlushCoalescingTimeoutUs.set(timeout);
+        auto immCmdList = createImmCmdListImpl<gfxCoreFamily, FlushCoalescingMockCmdList<gfxCoreFamily>>(false);
+        EXPECT_EQ(FlushCoalescingMockCmdList<gfxCoreFamily>::defaultFlushCoalescingTimeoutUs, immCmdList->flushCoalescingTimeoutUs);
+    }
+}
+
+HWTEST2_F(InOrderFlushCoalescingTests, givenFlushOfPendingAppendsFailingAfterTimeoutWhenHostSynchronizeIsCalledThenErrorIsReturnedOnce, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdListImpl<gfxCoreFamily, FlushCoalescingMockCmdList<gfxCoreFamily>>(false);
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    immCmdList->flushImmediateResult = ZE_RESULT_ERROR_DEVICE_LOST;
+    immCmdList->flushCoalescingTimeoutUs = 1000;
+    immCmdList->pendingFlushStartTime -= std::chrono::milliseconds(2);
+    immCmdList->flushPendingAppendsIfTimeoutReached();
+    ASSERT_EQ(1u, immCmdList->flushData.size());
+    EXPECT_EQ(0u, immCmdList->pendingFlushAppends);
+
+    immCmdList->flushImmediateResult = ZE_RESULT_SUCCESS;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, immCmdList->hostSynchronize(0, false));
+    EXPECT_NE(ZE_RESULT_ERROR_DEVICE_LOST, immCmdList->hostSynchronize(0, false));
+}
+
+HWTEST2_F(InOrderFlushCoalescingTests, givenFlushOfPendingAppendsFailingInBackgroundWhenAppendingKernelThenErrorIsReturnedWithoutAppending, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdListImpl<gfxCoreFamily, FlushCoalescingMockCmdList<gfxCoreFamily>>(false);
+    FlushCoalescingController controller(std::chrono::hours(1));
+    controller.registerCommandList(immCmdList.get());
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    immCmdList->flushImmediateResult = ZE_RESULT_ERROR_DEVICE_LOST;
+    controller.flushAll();
+    ASSERT_EQ(1u, immCmdList->flushData.size());
+
+    immCmdList->flushImmediateResult = ZE_RESULT_SUCCESS;
+    auto usedBefore = immCmdList->getCmdContainer().getCommandStream()->getUsed();
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(usedBefore, immCmdList->getCmdContainer().getCommandStream()->getUsed());
+    EXPECT_EQ(0u, immCmdList->pendingFlushAppends);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, immCmdList->pendingFlushAppends);
+    controller.unregisterCommandList(immCmdList.get());
+}
+
 } // namespace ult
 } // namespace L0
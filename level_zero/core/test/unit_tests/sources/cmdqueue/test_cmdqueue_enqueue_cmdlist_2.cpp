@@ -13,6 +13,7 @@
 #include "shared/test/common/test_macros/hw_test.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
+#include "level_zero/core/source/cmdlist/cmdlist_imp.h"
 #include "level_zero/core/source/fence/fence.h"
 #include "level_zero/core/test/unit_tests/fixtures/cmdlist_fixture.inl"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
@@ -75,6 +76,171 @@ HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, GivenAsynchronousModeWhenEx
     mockCmdQ->destroy();
 }
 
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenExecutionPlanCacheEnabledWhenExecutingSameCommandListsOnUnchangedCsrStateThenCommandListsStateIsNotEstimatedAgain, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableCommandQueueExecutionPlanCache.set(1);
+
+    ze_command_queue_desc_t desc = {};
+    auto mockCmdQ = new MockCommandQueueHw<gfxCoreFamily>(device, neoDevice->getDefaultEngine().commandStreamReceiver, &desc);
+    mockCmdQ->initialize(false, false, false);
+    if (mockCmdQ->heaplessStateInitEnabled) {
+        mockCmdQ->destroy();
+        GTEST_SKIP();
+    }
+    EXPECT_TRUE(mockCmdQ->executionPlanCacheEnabled);
+
+    ze_result_t returnValue;
+    ze_command_list_handle_t commandLists[] = {
+        CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false)->toHandle(),
+        CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false)->toHandle()};
+    CommandList::fromHandle(commandLists[0])->close();
+    CommandList::fromHandle(commandLists[1])->close();
+
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->executeCommandLists(2, commandLists, nullptr, true, nullptr));
+    }
+    auto cachedPlan = std::find_if(mockCmdQ->executionPlans.begin(), mockCmdQ->executionPlans.end(), [](const auto &plan) { return plan.commandLists.size() == 2u; });
+    ASSERT_NE(mockCmdQ->executionPlans.end(), cachedPlan);
+    EXPECT_EQ(CommandList::fromHandle(commandLists[0]), cachedPlan->commandLists[0].first);
+    EXPECT_EQ(CommandList::fromHandle(commandLists[0])->getExecutionGeneration(), cachedPlan->commandLists[0].second);
+    EXPECT_EQ(CommandList::fromHandle(commandLists[1]), cachedPlan->commandLists[1].first);
+    EXPECT_EQ(CommandList::fromHandle(commandLists[1])->getExecutionGeneration(), cachedPlan->commandLists[1].second);
+
+    auto estimateCalls = mockCmdQ->estimateFrontEndCmdSizeForMultipleCommandListsCalled;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->executeCommandLists(2, commandLists, nullptr, true, nullptr));
+    EXPECT_EQ(estimateCalls, mockCmdQ->estimateFrontEndCmdSizeForMultipleCommandListsCalled);
+
+    CommandList::fromHandle(commandLists[1])->reset();
+    CommandList::fromHandle(commandLists[1])->close();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->executeCommandLists(2, commandLists, nullptr, true, nullptr));
+    EXPECT_EQ(estimateCalls + 2, mockCmdQ->estimateFrontEndCmdSizeForMultipleCommandListsCalled);
+
+    CommandList::fromHandle(commandLists[0])->destroy();
+    CommandList::fromHandle(commandLists[1])->destroy();
+    mockCmdQ->destroy();
+}
+
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenExecutionPlanCacheDisabledByDefaultWhenExecutingSameCommandListsThenNoExecutionPlanIsStored, IsAtLeastSkl) {
+    ze_command_queue_desc_t desc = {};
+    auto mockCmdQ = new MockCommandQueueHw<gfxCoreFamily>(device, neoDevice->getDefaultEngine().commandStreamReceiver, &desc);
+    mockCmdQ->initialize(false, false, false);
+    EXPECT_FALSE(mockCmdQ->executionPlanCacheEnabled);
+
+    ze_result_t returnValue;
+    ze_command_list_handle_t commandLists[] = {
+        CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false)->toHandle()};
+    CommandList::fromHandle(commandLists[0])->close();
+
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->executeCommandLists(1, commandLists, nullptr, true, nullptr));
+    }
+    for (const auto &plan : mockCmdQ->executionPlans) {
+        EXPECT_EQ(0u, plan.commandLists.size());
+    }
+
+    CommandList::fromHandle(commandLists[0])->destroy();
+    mockCmdQ->destroy();
+}
+
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenClosedCommandListWhenResetOrClosedAgainThenExecutionGenerationIsUpdated, IsAtLeastSkl) {
+    ze_result_t returnValue;
+    auto commandList = CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false);
+    commandList->close();
+    auto closedGeneration = commandList->getExecutionGeneration();
+    EXPECT_NE(0u, closedGeneration);
+
+    commandList->reset();
+    auto resetGeneration = commandList->getExecutionGeneration();
+    EXPECT_GT(resetGeneration, closedGeneration);
+
+    commandList->close();
+    EXPECT_GT(commandList->getExecutionGeneration(), resetGeneration);
+
+    commandList->destroy();
+}
+
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenRegularCommandListWhenCreatingSegmentsThenSegmentsAreClosedWithParentAndDestroyedOnReset, IsAtLeastSkl) {
+    ze_result_t returnValue;
+    auto commandList = static_cast<CommandListImp *>(CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->createSegments(0, nullptr));
+
+    ze_command_list_handle_t segments[2] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->createSegments(2, segments));
+    ASSERT_EQ(2u, commandList->getSegments().size());
+    EXPECT_EQ(CommandList::fromHandle(segments[0]), commandList->getSegments()[0]);
+    EXPECT_EQ(CommandList::fromHandle(segments[1]), commandList->getSegments()[1]);
+    EXPECT_EQ(commandList->getCmdListContext(), CommandList::fromHandle(segments[0])->getCmdListContext());
+    EXPECT_FALSE(CommandList::fromHandle(segments[0])->isImmediateType());
+
+    auto segmentGeneration = CommandList::fromHandle(segments[1])->getExecutionGeneration();
+    commandList->close();
+    EXPECT_GT(CommandList::fromHandle(segments[1])->getExecutionGeneration(), segmentGeneration);
+
+    EXPECT_TRUE(CommandList::fromHandle(segments[0])->isSegment());
+    ze_command_list_handle_t nestedSegment = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, static_cast<CommandListImp *>(CommandList::fromHandle(segments[0]))->createSegments(1, &nestedSegment));
+    EXPECT_EQ(nullptr, nestedSegment);
+
+    commandList->reset();
+    EXPECT_TRUE(commandList->getSegments().empty());
+
+    commandList->destroy();
+}
+
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenImmediateCommandListWhenCreatingSegmentsThenErrorIsReturned, IsAtLeastSkl) {
+    ze_command_queue_desc_t desc = {};
+    ze_result_t returnValue;
+    auto commandList = static_cast<CommandListImp *>(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::renderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+
+    ze_command_list_handle_t segment = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->createSegments(1, &segment));
+    EXPECT_EQ(nullptr, segment);
+    EXPECT_TRUE(commandList->getSegments().empty());
+
+    commandList->destroy();
+}
+
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenCommandListWithSegmentsWhenExecutingThenSegmentsAreExecutedAfterParent, IsAtLeastSkl) {
+    ze_command_queue_desc_t desc = {};
+    auto mockCmdQ = new MockCommandQueueHw<gfxCoreFamily>(device, neoDevice->getDefaultEngine().commandStreamReceiver, &desc);
+    mockCmdQ->initialize(false, false, false);
+
+    ze_result_t returnValue;
+    ze_command_list_handle_t commandLists[] = {
+        CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false)->toHandle(),
+        CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false)->toHandle()};
+
+    typename MockCommandQueueHw<gfxCoreFamily>::CommandListsWithSegments commandListsWithSegments;
+    uint32_t numCommandLists = 2;
+    ze_command_list_handle_t *phCommandLists = commandLists;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->expandCommandListSegments(numCommandLists, phCommandLists, commandListsWithSegments));
+    EXPECT_EQ(0u, commandListsWithSegments.size());
+    EXPECT_EQ(2u, numCommandLists);
+    EXPECT_EQ(commandLists, phCommandLists);
+
+    ze_command_list_handle_t segments[2] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, static_cast<CommandListImp *>(CommandList::fromHandle(commandLists[0]))->createSegments(2, segments));
+    CommandList::fromHandle(commandLists[0])->close();
+    CommandList::fromHandle(commandLists[1])->close();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->expandCommandListSegments(numCommandLists, phCommandLists, commandListsWithSegments));
+    ASSERT_EQ(4u, numCommandLists);
+    EXPECT_EQ(commandListsWithSegments.data(), phCommandLists);
+    EXPECT_EQ(commandLists[0], commandListsWithSegments[0]);
+    EXPECT_EQ(segments[0], commandListsWithSegments[1]);
+    EXPECT_EQ(segments[1], commandListsWithSegments[2]);
+    EXPECT_EQ(commandLists[1], commandListsWithSegments[3]);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->executeCommandLists(2, commandLists, nullptr, true, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, mockCmdQ->executeCommandLists(1, &segments[0], nullptr, true, nullptr));
+
+    CommandList::fromHandle(commandLists[0])->destroy();
+    CommandList::fromHandle(commandLists[1])->destroy();
+    mockCmdQ->destroy();
+}
+
 HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, whenUsingFenceThenLastPipeControlUpdatesFenceAllocation, IsAtLeastSkl) {
     using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
     using POST_SYNC_OPERATION = typename FamilyType::PIPE_CONTROL::POST_SYNC_OPERATION;
@@ -6203,6 +6203,18 @@ TEST(ExtensionLookupTest, givenLookupMapWhenAskingForZexCommandListAppendWaitOnM
     EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zexCommandListAppendWaitOnMemory64"));
 }
 
+TEST(ExtensionLookupTest, givenLookupMapWhenAskingForZexEventHostSynchronizeMultipleThenReturnCorrectValue) {
+    EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zexEventHostSynchronizeMultiple"));
+}
+
+TEST(ExtensionLookupTest, givenLookupMapWhenAskingForZexCommandListCreateSegmentsThenReturnCorrectValue) {
+    EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zexCommandListCreateSegments"));
+}
+
+TEST(ExtensionLookupTest, givenLookupMapWhenAskingForZexCommandListAppendLaunchKernelWithArgumentsThenReturnCorrectValue) {
+    EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zexCommandListAppendLaunchKernelWithArguments"));
+}
+
 TEST(ExtensionLookupTest, givenLookupMapWhenAskingForBindlessImageExtensionFunctionsThenValidPointersReturned) {
     EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zeMemGetPitchFor2dImage"));
     EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zeImageGetDeviceOffsetExp"));
@@ -16,6 +16,7 @@
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/source/os_interface/os_inc_base.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/api_latency_histograms.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/memory_management.h"
 #include "shared/test/common/helpers/ult_hw_config.h"
@@ -1322,6 +1323,7 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     decltype(&zexDriverImportExternalPointer) expectedImport = L0::zexDriverImportExternalPointer;
     decltype(&zexDriverReleaseImportedPointer) expectedRelease = L0::zexDriverReleaseImportedPointer;
     decltype(&zexDriverGetHostPointerBaseAddress) expectedGet = L0::zexDriverGetHostPointerBaseAddress;
+    decltype(&zexDriverGetApiLatencyHistogram) expectedGetApiLatencyHistogram = L0::zexDriverGetApiLatencyHistogram;
     decltype(&zexKernelGetBaseAddress) expectedKernelGetBaseAddress = L0::zexKernelGetBaseAddress;
     decltype(&zeIntelGetDriverVersionString) expectedIntelGetDriverVersionString = zeIntelGetDriverVersionString;
     decltype(&zeIntelMediaCommunicationCreate) expectedIntelMediaCommunicationCreate = L0::zeIntelMediaCommunicationCreate;
@@ -1340,6 +1342,9 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexDriverGetHostPointerBaseAddress", &funPtr));
     EXPECT_EQ(expectedGet, reinterpret_cast<decltype(&zexDriverGetHostPointerBaseAddress)>(funPtr));
 
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexDriverGetApiLatencyHistogram", &funPtr));
+    EXPECT_EQ(expectedGetApiLatencyHistogram, reinterpret_cast<decltype(&zexDriverGetApiLatencyHistogram)>(funPtr));
+
     EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexKernelGetBaseAddress", &funPtr));
     EXPECT_EQ(expectedKernelGetBaseAddress, reinterpret_cast<decltype(&zexKernelGetBaseAddress)>(funPtr));
 
@@ -1390,6 +1395,21 @@ TEST_F(DriverExperimentalApiTest, givenGetVersionStringAPIExistsThenGetCurrentVe
     free(driverVersionString);
 }
 
+TEST_F(DriverExperimentalApiTest, givenApiLatencyHistogramsDisabledWhenQueryingApiLatencyHistogramThenUnsupportedFeatureIsReturned) {
+    if (NEO::ApiLatencyHistograms::getGlobal()->isEnabled()) {
+        GTEST_SKIP();
+    }
+    zex_api_latency_histogram_t histogram = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, zexDriverGetApiLatencyHistogram(driverHandle, "zeCommandListAppendLaunchKernel", &histogram));
+}
+
+TEST_F(DriverExperimentalApiTest, givenNullArgumentsWhenQueryingApiLatencyHistogramThenInvalidNullPointerIsReturned) {
+    zex_api_latency_histogram_t histogram = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexDriverGetApiLatencyHistogram(nullptr, "clEnqueueNDRangeKernel", &histogram));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexDriverGetApiLatencyHistogram(driverHandle, nullptr, &histogram));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexDriverGetApiLatencyHistogram(driverHandle, "clEnqueueNDRangeKernel", nullptr));
+}
+
 struct GtPinInitTest : public ::testing::Test {
     void SetUp() override {
         gtpinInitTimesCalled = 0u;
@@ -1806,6 +1806,58 @@ TEST_F(EventUsedPacketSignalSynchronizeTest, givenInfiniteTimeoutWhenWaitingForT
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(EventSynchronizeTest, givenOneOfEventsSignaledWhenHostSynchronizeMultipleWithWaitAnyThenSuccessAndSignaledEventIndexAreReturned) {
+    ze_event_desc_t eventDesc2 = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    eventDesc2.index = 1;
+    auto event2 = std::unique_ptr<EventImp<uint32_t>>(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc2, device)));
+    ASSERT_NE(nullptr, event2);
+
+    event->setUsingContextEndOffset(false);
+    event2->setUsingContextEndOffset(false);
+    *static_cast<uint32_t *>(event2->getHostAddress()) = Event::STATE_SIGNALED;
+
+    Event *events[] = {event.get(), event2.get()};
+    uint32_t signaledEventIndex = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, Event::hostSynchronizeMultiple(2, events, false, 0, &signaledEventIndex));
+    EXPECT_EQ(1u, signaledEventIndex);
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, Event::hostSynchronizeMultiple(2, events, true, 10, nullptr));
+
+    *static_cast<uint32_t *>(event->getHostAddress()) = Event::STATE_SIGNALED;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, Event::hostSynchronizeMultiple(2, events, true, std::numeric_limits<uint64_t>::max(), nullptr));
+}
+
+TEST_F(EventSynchronizeTest, givenPendingEventWhenPollingStatusThenCompletionAddressIsReturnedWithoutWaiting) {
+    event->setUsingContextEndOffset(false);
+
+    const volatile void *pendingAddress = nullptr;
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->pollStatus(pendingAddress));
+    EXPECT_EQ(event->getHostAddress(), pendingAddress);
+
+    *static_cast<uint32_t *>(event->getHostAddress()) = Event::STATE_SIGNALED;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->pollStatus(pendingAddress));
+    EXPECT_EQ(nullptr, pendingAddress);
+}
+
+TEST_F(EventSynchronizeTest, GivenGpuHangWhenHostSynchronizeMultipleIsCalledThenDeviceLostIsReturned) {
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr->isGpuHangDetectedReturnValue = true;
+
+    event->csrs[0] = csr.get();
+    event->gpuHangCheckPeriod = 0ms;
+
+    Event *events[] = {event.get()};
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, Event::hostSynchronizeMultiple(1, events, true, std::numeric_limits<uint64_t>::max(), nullptr));
+}
+
+TEST_F(EventSynchronizeTest, givenInvalidArgumentsWhenCallingZexEventHostSynchronizeMultipleThenErrorIsReturned) {
+    ze_event_handle_t events[] = {event->toHandle(), nullptr};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventHostSynchronizeMultiple(0, events, true, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventHostSynchronizeMultiple(1, nullptr, true, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventHostSynchronizeMultiple(2, events, true, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexEventHostSynchronizeMultiple(1, events, true, 0, nullptr));
+}
+
 using EventPoolIPCEventResetTests = Test<DeviceFixture>;
 
 TEST_F(EventPoolIPCEventResetTests, whenOpeningIpcHandleForEventPoolCreateWithIpcFlagThenEventsInNewPoolAreNotReset) {
@@ -4565,5 +4617,120 @@ HWTEST2_F(EventTimestampTest, givenAppendMemoryCopyIsCalledWhenCpuCopyIsUsedAndC
     context->freeMem(devicePtr);
 }
 
+struct EventPoolSlabAllocatorFixture : public DeviceFixture {
+    void setUp() {
+        debugManager.flags.EnableEventPoolSlabAllocator.set(1);
+        DeviceFixture::setUp();
+    }
+    void tearDown() {
+        DeviceFixture::tearDown();
+    }
+    DebugManagerStateRestore restore;
+};
+
+using EventPoolSlabAllocatorTest = Test<EventPoolSlabAllocatorFixture>;
+
+TEST_F(EventPoolSlabAllocatorTest, givenSlabAllocatorEnabledWhenCreatingSmallEventPoolsThenPoolsShareSingleSlabAllocation) {
+    auto slabAllocator = driverHandle->getEventPoolSlabAllocator();
+    ASSERT_NE(nullptr, slabAllocator);
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 4;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool0(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    std::unique_ptr<L0::EventPool> eventPool1(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_TRUE(eventPool0->isAllocatedFromSlab());
+    EXPECT_TRUE(eventPool1->isAllocatedFromSlab());
+    EXPECT_EQ(1u, slabAllocator->getSlabCount());
+    EXPECT_EQ(&eventPool0->getAllocation(), &eventPool1->getAllocation());
+    EXPECT_NE(eventPool0->getEventPoolOffset(), eventPool1->getEventPoolOffset());
+    EXPECT_LE(eventPool0->getEventPoolOffset() + eventPool0->getEventPoolSize(), eventPool1->getEventPoolOffset());
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenEventPoolAllocatedFromSlabWhenCreatingEventThenEventAddressesIncludeChunkOffset) {
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 4;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool0(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    std::unique_ptr<L0::EventPool> eventPool1(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_TRUE(eventPool1->isAllocatedFromSlab());
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 1;
+    ze_event_handle_t hEvent = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, eventPool1->createEvent(&eventDesc, &hEvent));
+    auto event = Event::fromHandle(hEvent);
+
+    auto slabAllocation = eventPool1->getAllocation().getGraphicsAllocation(device->getRootDeviceIndex());
+    auto expectedOffset = eventPool1->getEventPoolOffset() + eventPool1->getEventSize();
+    EXPECT_EQ(slabAllocation->getGpuAddress() + expectedOffset, event->getGpuAddress(device));
+    EXPECT_EQ(ptrOffset(slabAllocation->getUnderlyingBuffer(), expectedOffset), event->getHostAddress());
+
+    event->destroy();
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenSlabAllocatorEnabledWhenEventPoolsAreRepeatedlyCreatedAndDestroyedThenSlabIsReused) {
+    auto slabAllocator = driverHandle->getEventPoolSlabAllocator();
+    ASSERT_NE(nullptr, slabAllocator);
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 16;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    size_t firstOffset = 0;
+    for (uint32_t i = 0; i < 1000; i++) {
+        std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+        ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+        ASSERT_TRUE(eventPool->isAllocatedFromSlab());
+        if (i == 0) {
+            firstOffset = eventPool->getEventPoolOffset();
+        }
+        EXPECT_EQ(firstOffset, eventPool->getEventPoolOffset());
+    }
+    EXPECT_EQ(1u, slabAllocator->getSlabCount());
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenIpcEventPoolWhenCreatingThenEventPoolHasOwnAllocation) {
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE | ZE_EVENT_POOL_FLAG_IPC;
+    eventPoolDesc.count = 4;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_FALSE(eventPool->isAllocatedFromSlab());
+    EXPECT_EQ(0u, eventPool->getEventPoolOffset());
+    EXPECT_EQ(0u, driverHandle->getEventPoolSlabAllocator()->getSlabCount());
+}
+
+TEST_F(EventPoolCreateSingleDevice, givenSlabAllocatorNotEnabledWhenCreatingEventPoolThenEventPoolHasOwnAllocation) {
+    EXPECT_EQ(nullptr, driverHandle->getEventPoolSlabAllocator());
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 4;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_FALSE(eventPool->isAllocatedFromSlab());
+}
+
 } // namespace ult
 } // namespace L0
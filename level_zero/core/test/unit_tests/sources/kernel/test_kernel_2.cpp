@@ -137,84 +137,78 @@ TEST_F(KernelImpTest, WhenSuggestingGroupSizeThenCacheValues) {
     EXPECT_EQ(kernel.suggestGroupSizeCache.size(), 0u);
     EXPECT_EQ(kernel.getSlmTotalSize(), 0u);
 
+    auto createKey = [](size_t globalSizeX, uint32_t slmTotalSize) {
+        NEO::LocalWorkSizeCacheKey key;
+        key.globalSize = {globalSizeX, 1, 1};
+        key.slmTotalSize = slmTotalSize;
+        key.workDim = 1;
+        return key;
+    };
+
     uint32_t groupSize[3];
+    Vec3<size_t> cachedGroupSize = {0, 0, 0};
     kernel.KernelImp::suggestGroupSize(256, 1, 1, groupSize, groupSize + 1, groupSize + 2);
 
     EXPECT_EQ(kernel.suggestGroupSizeCache.size(), 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].slmArgsTotalSize, 0u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[0], 256u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], 8u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], groupSize[0]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], groupSize[1]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], groupSize[2]);
+    EXPECT_TRUE(kernel.suggestGroupSizeCache.find(createKey(256, 0u), cachedGroupSize));
+    EXPECT_EQ(cachedGroupSize.x, 8u);
+    EXPECT_EQ(cachedGroupSize.y, 1u);
+    EXPECT_EQ(cachedGroupSize.z, 1u);
+    EXPECT_EQ(cachedGroupSize.x, groupSize[0]);
+    EXPECT_EQ(cachedGroupSize.y, groupSize[1]);
+    EXPECT_EQ(cachedGroupSize.z, groupSize[2]);
 
     kernel.KernelImp::suggestGroupSize(256, 1, 1, groupSize, groupSize + 1, groupSize + 2);
 
     EXPECT_EQ(kernel.suggestGroupSizeCache.size(), 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].slmArgsTotalSize, 0u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[0], 256u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], 8u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], groupSize[0]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], groupSize[1]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], groupSize[2]);
+    EXPECT_EQ(cachedGroupSize.x, groupSize[0]);
+    EXPECT_EQ(cachedGroupSize.y, groupSize[1]);
+    EXPECT_EQ(cachedGroupSize.z, groupSize[2]);
 
     kernel.KernelImp::suggestGroupSize(2048, 1, 1, groupSize, groupSize + 1, groupSize + 2);
 
     EXPECT_EQ(kernel.suggestGroupSizeCache.size(), 2u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].slmArgsTotalSize, 0u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[0], 256u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], 8u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].slmArgsTotalSize, 0u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].groupSize[0], 2048u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].groupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].groupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].suggestedGroupSize[0], 8u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].suggestedGroupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].suggestedGroupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], groupSize[0]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], groupSize[1]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], groupSize[2]);
+    EXPECT_TRUE(kernel.suggestGroupSizeCache.find(createKey(256, 0u), cachedGroupSize));
+    EXPECT_TRUE(kernel.suggestGroupSizeCache.find(createKey(2048, 0u), cachedGroupSize));
+    EXPECT_EQ(cachedGroupSize.x, 8u);
+    EXPECT_EQ(cachedGroupSize.y, 1u);
+    EXPECT_EQ(cachedGroupSize.z, 1u);
+    EXPECT_FALSE(kernel.suggestGroupSizeCache.find(createKey(2048, 1u), cachedGroupSize));
 
     kernel.slmArgsTotalSize = 1;
     kernel.KernelImp::suggestGroupSize(2048, 1, 1, groupSize, groupSize + 1, groupSize + 2);
 
     EXPECT_EQ(kernel.suggestGroupSizeCache.size(), 3u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].slmArgsTotalSize, 0u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[0], 256u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], 8u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].slmArgsTotalSize, 0u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].groupSize[0], 2048u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].groupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].groupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].suggestedGroupSize[0], 8u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].suggestedGroupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].suggestedGroupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[2].slmArgsTotalSize, 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[2].groupSize[0], 2048u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[2].groupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[2].groupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[2].suggestedGroupSize[0], 8u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[2].suggestedGroupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[2].suggestedGroupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], groupSize[0]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], groupSize[1]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], groupSize[2]);
+    EXPECT_TRUE(kernel.suggestGroupSizeCache.find(createKey(2048, 1u), cachedGroupSize));
+    EXPECT_EQ(cachedGroupSize.x, 8u);
+    EXPECT_EQ(cachedGroupSize.y, 1u);
+    EXPECT_EQ(cachedGroupSize.z, 1u);
+    EXPECT_EQ(cachedGroupSize.x, groupSize[0]);
+    EXPECT_EQ(cachedGroupSize.y, groupSize[1]);
+    EXPECT_EQ(cachedGroupSize.z, groupSize[2]);
+}
+
+TEST_F(KernelImpTest, GivenMoreDistinctGlobalSizesThanCacheSizeWhenSuggestingGroupSizeThenCacheStaysBounded) {
+    DebugManagerStateRestore restorer;
+
+    WhiteBox<KernelImmutableData> kernelInfo = {};
+    NEO::KernelDescriptor descriptor;
+    kernelInfo.kernelDescriptor = &descriptor;
+
+    NEO::debugManager.flags.EnableComputeWorkSizeND.set(false);
+
+    Mock<Module> module(device, nullptr);
+    module.getMaxGroupSizeResult = 8;
+
+    Mock<KernelImp> kernel;
+    kernel.kernelImmData = &kernelInfo;
+    kernel.module = &module;
+
+    uint32_t groupSize[3];
+    for (uint32_t globalSize = 1; globalSize <= 2 * NEO::LocalWorkSizeCache::defaultCacheSize; globalSize++) {
+        kernel.KernelImp::suggestGroupSize(globalSize, 1, 1, groupSize, groupSize + 1, groupSize + 2);
+    }
+    EXPECT_EQ(NEO::LocalWorkSizeCache::defaultCacheSize, kernel.suggestGroupSizeCache.size());
 }
 
 class KernelImpSuggestGroupSize : public DeviceFixture, public ::testing::TestWithParam<uint32_t> {
@@ -86,5 +86,47 @@ XE_HPC_CORETEST_F(L0GfxCoreHelperTestXeHpc, GivenXeHpcWhenCheckingL0HelperForDel
     EXPECT_NE(0u, stallSumIpDataMap.size());
 }
 
+XE_HPC_CORETEST_F(L0GfxCoreHelperTestXeHpc, GivenXeHpcWhenMergingIpSamplingMapsThenCountsAreSummedAndMergedMapEntriesAreReleased) {
+    auto &l0GfxCoreHelper = getHelper<L0GfxCoreHelper>();
+    std::array<uint8_t, 64> rawReport = {};
+    rawReport[0] = 0x10;
+    for (uint32_t i = 3; i < 16; i++) {
+        rawReport[i] = static_cast<uint8_t>(0x25 * i);
+    }
+    std::array<uint8_t, 64> otherRawReport = rawReport;
+    otherRawReport[0] = 0x20;
+
+    std::map<uint64_t, void *> stallSumIpDataMap;
+    std::map<uint64_t, void *> stallSumIpDataMapToMerge;
+    std::map<uint64_t, void *> expectedStallSumIpDataMap;
+    l0GfxCoreHelper.stallIpDataMapUpdate(stallSumIpDataMap, rawReport.data());
+    l0GfxCoreHelper.stallIpDataMapUpdate(stallSumIpDataMapToMerge, rawReport.data());
+    l0GfxCoreHelper.stallIpDataMapUpdate(stallSumIpDataMapToMerge, otherRawReport.data());
+    l0GfxCoreHelper.stallIpDataMapUpdate(expectedStallSumIpDataMap, rawReport.data());
+    l0GfxCoreHelper.stallIpDataMapUpdate(expectedStallSumIpDataMap, rawReport.data());
+    l0GfxCoreHelper.stallIpDataMapUpdate(expectedStallSumIpDataMap, otherRawReport.data());
+
+    l0GfxCoreHelper.stallIpDataMapMerge(stallSumIpDataMap, stallSumIpDataMapToMerge);
+    for (auto &entry : stallSumIpDataMapToMerge) {
+        EXPECT_EQ(nullptr, entry.second);
+    }
+    ASSERT_EQ(expectedStallSumIpDataMap.size(), stallSumIpDataMap.size());
+
+    std::vector<zet_typed_value_t> values;
+    std::vector<zet_typed_value_t> expectedValues;
+    for (auto it = stallSumIpDataMap.begin(), expectedIt = expectedStallSumIpDataMap.begin(); it != stallSumIpDataMap.end(); ++it, ++expectedIt) {
+        EXPECT_EQ(expectedIt->first, it->first);
+        l0GfxCoreHelper.stallSumIpDataToTypedValues(it->first, it->second, values);
+        l0GfxCoreHelper.stallSumIpDataToTypedValues(expectedIt->first, expectedIt->second, expectedValues);
+    }
+    ASSERT_EQ(expectedValues.size(), values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        EXPECT_EQ(expectedValues[i].value.ui64, values[i].value.ui64);
+    }
+
+    l0GfxCoreHelper.stallIpDataMapDelete(stallSumIpDataMap);
+    l0GfxCoreHelper.stallIpDataMapDelete(expectedStallSumIpDataMap);
+}
+
 } // namespace ult
 } // namespace L0
@@ -59,6 +59,43 @@ OsEvents *OsEvents::create(OsSysman *pOsSysman) {
 }
 
 LinuxEventsUtil::LinuxEventsUtil(LinuxSysmanDriverImp *pOsSysmanDriverImp) : pLinuxSysmanDriverImp(pOsSysmanDriverImp) {
+    persistentMonitor = (NEO::debugManager.flags.EnablePersistentSysmanEventMonitor.get() == 1);
+}
+
+LinuxEventsUtil::~LinuxEventsUtil() {
+    closeWakeupPipe();
+}
+
+int LinuxEventsUtil::getUdevFd() {
+    // Registering subsystems re-enables receiving on the udev monitor, so with persistent
+    // monitoring it is done once and the monitor fd is reused by following listen calls.
+    if (persistentMonitor && udevFd >= 0) {
+        return udevFd;
+    }
+    std::vector<std::string> subsystemList{"drm", "auxiliary"};
+    udevFd = pUdevLib->registerEventsFromSubsystemAndGetFd(subsystemList);
+    return udevFd;
+}
+
+bool LinuxEventsUtil::openWakeupPipe() {
+    if (persistentMonitor && pipeFd[0] != -1) {
+        return true;
+    }
+    if (NEO::SysCalls::pipe(pipeFd) < 0) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr,
+                              "%s", "Creation of pipe failed\n");
+        return false;
+    }
+    return true;
+}
+
+void LinuxEventsUtil::closeWakeupPipe() {
+    for (uint8_t i = 0; i < 2; i++) {
+        if (pipeFd[i] != -1) {
+            NEO::SysCalls::close(pipeFd[i]);
+            pipeFd[i] = -1;
+        }
+    }
 }
 
 bool LinuxEventsUtil::checkRasEvent(zes_event_type_flags_t &pEvent, SysmanDeviceImp *pSysmanDeviceImp, zes_event_type_flags_t registeredEvents) {
@@ -339,7 +376,6 @@ bool LinuxEventsUtil::listenSystemEvents(zes_event_type_flags_t *pEvents, uint32
 
     bool retval = false;
     struct pollfd pfd[2];
-    std::vector<std::string> subsystemList;
     std::map<uint32_t, std::string> mapOfDevIndexToDevPath = {};
 
     if (pUdevLib == nullptr) {
@@ -348,17 +384,12 @@ bool LinuxEventsUtil::listenSystemEvents(zes_event_type_flags_t *pEvents, uint32
         return retval;
     }
 
-    subsystemList.push_back("drm");
-    subsystemList.push_back("auxiliary");
-    pfd[0].fd = pUdevLib->registerEventsFromSubsystemAndGetFd(subsystemList);
+    pfd[0].fd = getUdevFd();
     pfd[0].events = POLLIN;
     pfd[0].revents = 0;
 
     eventsMutex.lock();
-    if (NEO::SysCalls::pipe(pipeFd) < 0) {
-        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr,
-                              "%s", "Creation of pipe failed\n");
-    }
+    openWakeupPipe();
 
     pfd[1].fd = pipeFd[0];
     pfd[1].events = POLLIN;
@@ -432,14 +463,11 @@ bool LinuxEventsUtil::listenSystemEvents(zes_event_type_flags_t *pEvents, uint32
         }
     }
 
-    eventsMutex.lock();
-    for (uint8_t i = 0; i < 2; i++) {
-        if (pipeFd[i] != -1) {
-            NEO::SysCalls::close(pipeFd[i]);
-            pipeFd[i] = -1;
-        }
+    if (!persistentMonitor) {
+        eventsMutex.lock();
+        closeWakeupPipe();
+        eventsMutex.unlock();
     }
-    eventsMutex.unlock();
     return retval;
 }
 
@@ -32,7 +32,7 @@ class LinuxEventsUtil {
   public:
     LinuxEventsUtil() = delete;
     LinuxEventsUtil(LinuxSysmanDriverImp *pOsSysmanDriverImp);
-    ~LinuxEventsUtil() = default;
+    ~LinuxEventsUtil();
 
     ze_result_t eventsListen(uint64_t timeout, uint32_t count, zes_device_handle_t *phDevices, uint32_t *pNumDeviceEvents, zes_event_type_flags_t *pEvents);
     void eventRegister(zes_event_type_flags_t events, SysmanDeviceImp *pSysmanDevice);
@@ -41,6 +41,8 @@ class LinuxEventsUtil {
     UdevLib *pUdevLib = nullptr;
     LinuxSysmanDriverImp *pLinuxSysmanDriverImp = nullptr;
     int pipeFd[2] = {-1, -1};
+    int udevFd = -1;
+    bool persistentMonitor = false;
     std::map<SysmanDeviceImp *, zes_event_type_flags_t> deviceEventsMap;
     bool checkRasEvent(zes_event_type_flags_t &pEvent, SysmanDeviceImp *pSysmanDeviceImp, zes_event_type_flags_t registeredEvents);
     bool isResetRequired(void *dev, zes_event_type_flags_t &pEvent);
@@ -48,6 +50,9 @@ class LinuxEventsUtil {
     bool checkDeviceAttachEvent(zes_event_type_flags_t &pEvent);
     bool checkIfMemHealthChanged(void *dev, zes_event_type_flags_t &pEvent);
     bool checkIfFabricPortStatusChanged(void *dev, zes_event_type_flags_t &pEvent);
+    int getUdevFd();
+    bool openWakeupPipe();
+    void closeWakeupPipe();
     bool listenSystemEvents(zes_event_type_flags_t *pEvents, uint32_t count, std::vector<zes_event_type_flags_t> &registeredEvents, zes_device_handle_t *phDevices, uint64_t timeout);
 
   private:
@@ -168,23 +168,16 @@ ze_result_t LinuxFrequencyImp::osFrequencyGetState(zes_freq_state_t *pState) {
 
     pState->throttleReasons = 0u;
     if (getThrottleReasonStatus()) {
-        uint32_t val = 0;
-        ze_result_t result;
-        result = pSysfsAccess->read(throttleReasonPL1File, val);
-        if (val && (result == ZE_RESULT_SUCCESS)) {
-            pState->throttleReasons |= ZES_FREQ_THROTTLE_REASON_FLAG_AVE_PWR_CAP;
-        }
-        result = pSysfsAccess->read(throttleReasonPL2File, val);
-        if (val && (result == ZE_RESULT_SUCCESS)) {
-            pState->throttleReasons |= ZES_FREQ_THROTTLE_REASON_FLAG_BURST_PWR_CAP;
-        }
-        result = pSysfsAccess->read(throttleReasonPL4File, val);
-        if (val && (result == ZE_RESULT_SUCCESS)) {
-            pState->throttleReasons |= ZES_FREQ_THROTTLE_REASON_FLAG_CURRENT_LIMIT;
-        }
-        result = pSysfsAccess->read(throttleReasonThermalFile, val);
-        if (val && (result == ZE_RESULT_SUCCESS)) {
-            pState->throttleReasons |= ZES_FREQ_THROTTLE_REASON_FLAG_THERMAL_LIMIT;
+        const std::vector<std::string> throttleReasonFiles = {throttleReasonPL1File, throttleReasonPL2File, throttleReasonPL4File, throttleReasonThermalFile};
+        const zes_freq_throttle_reason_flags_t throttleReasonFlags[] = {ZES_FREQ_THROTTLE_REASON_FLAG_AVE_PWR_CAP, ZES_FREQ_THROTTLE_REASON_FLAG_BURST_PWR_CAP,
+                                                                        ZES_FREQ_THROTTLE_REASON_FLAG_CURRENT_LIMIT, ZES_FREQ_THROTTLE_REASON_FLAG_THERMAL_LIMIT};
+        std::vector<uint32_t> vals;
+        std::vector<ze_result_t> results;
+        pSysfsAccess->readValues(throttleReasonFiles, vals, results);
+        for (size_t i = 0; i < throttleReasonFiles.size(); i++) {
+            if (vals[i] && (results[i] == ZE_RESULT_SUCCESS)) {
+                pState->throttleReasons |= throttleReasonFlags[i];
+            }
         }
     }
     return ZE_RESULT_SUCCESS;
@@ -100,13 +100,15 @@ ze_result_t LinuxPowerImp::getPmtEnergyCounter(zes_power_energy_counter_t *pEner
 
     const std::string key("PACKAGE_ENERGY");
     uint64_t energy = 0;
+    uint64_t sampleTimestamp = 0;
     constexpr uint64_t fixedPointToJoule = 1048576;
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, energy)) {
+    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, energy, sampleTimestamp)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
     // PMT will return energy counter in Q20 format(fixed point representation) where first 20 bits(from LSB) represent decimal part and remaining integral part which is converted into joule by division with 1048576(2^20) and then converted into microjoules
     pEnergy->energy = (energy / fixedPointToJoule) * convertJouleToMicroJoule;
+    pEnergy->timestamp = sampleTimestamp;
     return ZE_RESULT_SUCCESS;
 }
 
@@ -11,6 +11,9 @@
 #include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
 #include "level_zero/sysman/source/shared/linux/zes_os_sysman_imp.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace L0 {
 namespace Sysman {
 
@@ -75,7 +78,103 @@ bool PlatformMonitoringTech::getTelemOffsetForContainer(SysmanProductHelper *pSy
     return true;
 }
 
+PlatformMonitoringTech::TelemetrySampleCache &PlatformMonitoringTech::getTelemetrySampleCache() {
+    static TelemetrySampleCache sampleCache;
+    return sampleCache;
+}
+
+std::shared_ptr<PlatformMonitoringTech::TelemetrySample> PlatformMonitoringTech::getTelemetrySample(const std::string &telemDir) {
+    auto &sampleCache = getTelemetrySampleCache();
+    std::lock_guard<std::mutex> lock(sampleCache.mutex);
+    auto &sample = sampleCache.samples[telemDir];
+    if (!sample) {
+        sample = std::make_shared<TelemetrySample>();
+    }
+    return sample;
+}
+
+void PlatformMonitoringTech::clearTelemetrySamples(const std::string &telemDir) {
+    auto &sampleCache = getTelemetrySampleCache();
+    std::lock_guard<std::mutex> lock(sampleCache.mutex);
+    sampleCache.samples.erase(telemDir);
+}
+
+void PlatformMonitoringTech::clearTelemetrySamples() {
+    auto &sampleCache = getTelemetrySampleCache();
+    std::lock_guard<std::mutex> lock(sampleCache.mutex);
+    sampleCache.samples.clear();
+}
+
+uint64_t PlatformMonitoringTech::getTimestampUs(std::chrono::steady_clock::time_point timePoint) {
+    // Same time base as SysmanDevice::getSysmanTimestamp()
+    return std::chrono::duration_cast<std::chrono::microseconds>(timePoint.time_since_epoch()).count();
+}
+
+bool PlatformMonitoringTech::readTelem(const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, uint64_t telemOffset, const std::vector<TelemRead> &reads, uint64_t &timestamp) {
+    const auto staleness = NEO::debugManager.flags.PmtTelemetrySampleStaleness.get();
+    if (staleness < 0) {
+        for (const auto &read : reads) {
+            if (NEO::PmtUtil::readTelem(telemDir.data(), read.count, read.offset, read.data) != static_cast<ssize_t>(read.count)) {
+                return false;
+            }
+        }
+        timestamp = getTimestampUs(std::chrono::steady_clock::now());
+        return true;
+    }
+
+    uint64_t regionEnd = telemOffset;
+    for (const auto &read : reads) {
+        if (read.offset < telemOffset) {
+            return false;
+        }
+        regionEnd = std::max(regionEnd, read.offset + read.count);
+    }
+
+    // All reads are served from one sample, so values read together are consistent with each other and with the timestamp
+    auto sample = getTelemetrySample(telemDir);
+    std::lock_guard<std::mutex> lock(sample->mutex);
+    const auto now = std::chrono::steady_clock::now();
+    const bool covered = !sample->data.empty() && sample->offset == telemOffset && regionEnd <= telemOffset + sample->data.size();
+    const bool fresh = now - sample->timestamp <= std::chrono::milliseconds(staleness);
+
+    if (!covered || !fresh) {
+        // Read region spanning all keys of the node at once
+        uint64_t regionSize = regionEnd - telemOffset;
+        for (const auto &keyOffset : keyOffsetMap) {
+            regionSize = std::max(regionSize, keyOffset.second + sizeof(uint64_t));
+        }
+        sample->data.resize(static_cast<size_t>(regionSize));
+        auto bytesRead = NEO::PmtUtil::readTelem(telemDir.data(), sample->data.size(), telemOffset, sample->data.data());
+        if (bytesRead <= 0) {
+            sample->data.clear();
+            return false;
+        }
+        sample->data.resize(static_cast<size_t>(bytesRead));
+        sample->offset = telemOffset;
+        sample->timestamp = std::chrono::steady_clock::now();
+        if (regionEnd > telemOffset + sample->data.size()) {
+            return false;
+        }
+    }
+
+    for (const auto &read : reads) {
+        std::memcpy(read.data, sample->data.data() + (read.offset - telemOffset), read.count);
+    }
+    timestamp = getTimestampUs(sample->timestamp);
+    return true;
+}
+
 bool PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint32_t &value) {
+    uint64_t timestamp = 0;
+    return PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, value, timestamp);
+}
+
+bool PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint64_t &value) {
+    uint64_t timestamp = 0;
+    return PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, key, telemOffset, value, timestamp);
+}
+
+bool PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint32_t &value, uint64_t &timestamp) {
 
     auto containerOffset = keyOffsetMap.find(key);
     if (containerOffset == keyOffsetMap.end()) {
@@ -84,15 +183,14 @@ bool PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> key
     }
 
     uint64_t offset = telemOffset + containerOffset->second;
-    ssize_t bytesRead = NEO::PmtUtil::readTelem(telemDir.data(), sizeof(uint32_t), offset, &value);
-    if (bytesRead != sizeof(uint32_t)) {
+    if (!PlatformMonitoringTech::readTelem(keyOffsetMap, telemDir, telemOffset, {{offset, sizeof(uint32_t), &value}}, timestamp)) {
         NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for %s key \n", __FUNCTION__, key.c_str());
         return false;
     }
     return true;
 }
 
-bool PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint64_t &value) {
+bool PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint64_t &value, uint64_t &timestamp) {
 
     auto containerOffset = keyOffsetMap.find(key);
     if (containerOffset == keyOffsetMap.end()) {
@@ -101,14 +199,34 @@ bool PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> key
     }
 
     uint64_t offset = telemOffset + containerOffset->second;
-    ssize_t bytesRead = NEO::PmtUtil::readTelem(telemDir.data(), sizeof(uint64_t), offset, &value);
-    if (bytesRead != sizeof(uint64_t)) {
+    if (!PlatformMonitoringTech::readTelem(keyOffsetMap, telemDir, telemOffset, {{offset, sizeof(uint64_t), &value}}, timestamp)) {
         NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read value for %s key \n", __FUNCTION__, key.c_str());
         return false;
     }
     return true;
 }
 
+bool PlatformMonitoringTech::readValues(const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::vector<std::string> &keys, const uint64_t &telemOffset, std::vector<uint32_t> &values, uint64_t &timestamp) {
+
+    values.assign(keys.size(), 0u);
+    std::vector<TelemRead> reads;
+    reads.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        auto containerOffset = keyOffsetMap.find(keys[i]);
+        if (containerOffset == keyOffsetMap.end()) {
+            NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to find keyOffset for %s key in keyOffsetMap \n", __FUNCTION__, keys[i].c_str());
+            return false;
+        }
+        reads.push_back({telemOffset + containerOffset->second, sizeof(uint32_t), &values[i]});
+    }
+
+    if (!PlatformMonitoringTech::readTelem(keyOffsetMap, telemDir, telemOffset, reads, timestamp)) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read values of %zu keys \n", __FUNCTION__, keys.size());
+        return false;
+    }
+    return true;
+}
+
 bool PlatformMonitoringTech::getTelemDataForTileAggregator(const std::map<uint32_t, std::string> telemNodesInPciPath, uint32_t subdeviceId, std::string &telemDir, std::string &guid, uint64_t &telemOffset) {
 
     uint32_t rootDeviceTelemIndex = telemNodesInPciPath.begin()->first;
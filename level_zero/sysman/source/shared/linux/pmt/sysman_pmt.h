@@ -11,7 +11,12 @@
 
 #include "level_zero/zes_api.h"
 
+#include <chrono>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 namespace L0 {
 namespace Sysman {
@@ -34,7 +39,39 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
     static bool getTelemOffsetForContainer(SysmanProductHelper *pSysmanProductHelper, const std::string &telemDir, const std::string &key, uint64_t &telemOffset);
     static bool readValue(const std::map<std::string, uint64_t> keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint32_t &value);
     static bool readValue(const std::map<std::string, uint64_t> keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint64_t &value);
+    static bool readValue(const std::map<std::string, uint64_t> keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint32_t &value, uint64_t &timestamp);
+    static bool readValue(const std::map<std::string, uint64_t> keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint64_t &value, uint64_t &timestamp);
+    static bool readValues(const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::vector<std::string> &keys, const uint64_t &telemOffset, std::vector<uint32_t> &values, uint64_t &timestamp);
     static bool isTelemetrySupportAvailable(LinuxSysmanImp *pLinuxSysmanImp, uint32_t subdeviceId);
+    static void clearTelemetrySamples(const std::string &telemDir);
+    static void clearTelemetrySamples();
+
+  protected:
+    // Snapshot of telemetry region of a single telem node. When bulk reads are
+    // enabled, all keys of a node are decoded from one sample until it gets stale.
+    // Each node is guarded separately, so devices do not serialize on each other.
+    struct TelemetrySample {
+        std::mutex mutex;
+        std::vector<uint8_t> data;
+        uint64_t offset = 0;
+        std::chrono::steady_clock::time_point timestamp;
+    };
+    struct TelemetrySampleCache {
+        std::map<std::string, std::shared_ptr<TelemetrySample>> samples;
+        std::mutex mutex;
+    };
+
+    static TelemetrySampleCache &getTelemetrySampleCache();
+    static std::shared_ptr<TelemetrySample> getTelemetrySample(const std::string &telemDir);
+
+    struct TelemRead {
+        uint64_t offset;
+        size_t count;
+        void *data;
+    };
+
+    static uint64_t getTimestampUs(std::chrono::steady_clock::time_point timePoint);
+    static bool readTelem(const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, uint64_t telemOffset, const std::vector<TelemRead> &reads, uint64_t &timestamp);
 };
 
 } // namespace Sysman
@@ -92,7 +92,8 @@ static ze_result_t getPciStatsValues(zes_pci_stats_t *pStats, std::map<std::stri
     }
 
     uint32_t txPacketCounterMsb = 0;
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_tx_pktcount_msb", telemOffset, txPacketCounterMsb)) {
+    uint64_t sampleTimestamp = 0;
+    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_tx_pktcount_msb", telemOffset, txPacketCounterMsb, sampleTimestamp)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
@@ -105,7 +106,7 @@ static ze_result_t getPciStatsValues(zes_pci_stats_t *pStats, std::map<std::stri
     pStats->rxCounter = rxCounter;
     pStats->txCounter = txCounter;
     pStats->packetCounter = rxPacketCounter + txPacketCounter;
-    pStats->timestamp = SysmanDevice::getSysmanTimestamp();
+    pStats->timestamp = sampleTimestamp;
 
     return ZE_RESULT_SUCCESS;
 }
@@ -191,28 +191,28 @@ ze_result_t getHBMBandwidth(std::map<std::string, uint64_t> keyOffsetMap, zes_me
         return result;
     }
 
+    // Read and write counters of all modules come from one telemetry sample, matching its timestamp
+    std::vector<std::string> counterKeys;
     for (auto hbmModuleIndex = 0u; hbmModuleIndex < numHbmModules; hbmModuleIndex++) {
-        uint32_t counterValue = 0;
-        std::string readCounterKey = vfId + "_HBM" + std::to_string(hbmModuleIndex) + "_READ";
-        if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, readCounterKey, telemOffset, counterValue)) {
-            NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for readCounterKey returning error:0x%x \n", __FUNCTION__, ZE_RESULT_ERROR_NOT_AVAILABLE);
-            return ZE_RESULT_ERROR_NOT_AVAILABLE;
-        }
-        pBandwidth->readCounter += counterValue;
+        counterKeys.push_back(vfId + "_HBM" + std::to_string(hbmModuleIndex) + "_READ");
+        counterKeys.push_back(vfId + "_HBM" + std::to_string(hbmModuleIndex) + "_WRITE");
+    }
 
-        counterValue = 0;
-        std::string writeCounterKey = vfId + "_HBM" + std::to_string(hbmModuleIndex) + "_WRITE";
-        if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, writeCounterKey, telemOffset, counterValue)) {
-            NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for writeCounterKey returning error:0x%x \n", __FUNCTION__, ZE_RESULT_ERROR_NOT_AVAILABLE);
-            return ZE_RESULT_ERROR_NOT_AVAILABLE;
-        }
-        pBandwidth->writeCounter += counterValue;
+    std::vector<uint32_t> counterValues;
+    uint64_t sampleTimestamp = 0;
+    if (!PlatformMonitoringTech::readValues(keyOffsetMap, telemDir, counterKeys, telemOffset, counterValues, sampleTimestamp)) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValues for HBM counters returning error:0x%x \n", __FUNCTION__, ZE_RESULT_ERROR_NOT_AVAILABLE);
+        return ZE_RESULT_ERROR_NOT_AVAILABLE;
+    }
+    for (auto hbmModuleIndex = 0u; hbmModuleIndex < numHbmModules; hbmModuleIndex++) {
+        pBandwidth->readCounter += counterValues[2 * hbmModuleIndex];
+        pBandwidth->writeCounter += counterValues[2 * hbmModuleIndex + 1];
     }
 
     constexpr uint64_t transactionSize = 32;
     pBandwidth->readCounter = pBandwidth->readCounter * transactionSize;
     pBandwidth->writeCounter = pBandwidth->writeCounter * transactionSize;
-    pBandwidth->timestamp = SysmanDevice::getSysmanTimestamp();
+    pBandwidth->timestamp = sampleTimestamp;
 
     uint64_t hbmFrequency = 0;
     auto pSysmanKmdInterface = pLinuxSysmanImp->getSysmanKmdInterface();
@@ -261,43 +261,24 @@ ze_result_t getHBMBandwidth(zes_mem_bandwidth_t *pBandwidth, LinuxSysmanImp *pLi
         return result;
     }
 
-    uint32_t readCounterL = 0;
-    std::string readCounterKey = vfId + "_HBM_READ_L";
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, readCounterKey, telemOffset, readCounterL)) {
-        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for readCounterL returning error:0x%x \n", __FUNCTION__, ZE_RESULT_ERROR_NOT_AVAILABLE);
-        return ZE_RESULT_ERROR_NOT_AVAILABLE;
-    }
-
-    uint32_t readCounterH = 0;
-    readCounterKey = vfId + "_HBM_READ_H";
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, readCounterKey, telemOffset, readCounterH)) {
-        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for readCounterH returning error:0x%x \n", __FUNCTION__, ZE_RESULT_ERROR_NOT_AVAILABLE);
+    // Low and high halves of both counters come from one telemetry sample, matching its timestamp
+    const std::vector<std::string> counterKeys = {vfId + "_HBM_READ_L", vfId + "_HBM_READ_H", vfId + "_HBM_WRITE_L", vfId + "_HBM_WRITE_H"};
+    std::vector<uint32_t> counterValues;
+    uint64_t sampleTimestamp = 0;
+    if (!PlatformMonitoringTech::readValues(keyOffsetMap, telemDir, counterKeys, telemOffset, counterValues, sampleTimestamp)) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValues for HBM counters returning error:0x%x \n", __FUNCTION__, ZE_RESULT_ERROR_NOT_AVAILABLE);
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
     constexpr uint64_t transactionSize = 32;
-    pBandwidth->readCounter = readCounterH;
-    pBandwidth->readCounter = (pBandwidth->readCounter << 32) | static_cast<uint64_t>(readCounterL);
+    pBandwidth->readCounter = counterValues[1];
+    pBandwidth->readCounter = (pBandwidth->readCounter << 32) | static_cast<uint64_t>(counterValues[0]);
     pBandwidth->readCounter = (pBandwidth->readCounter * transactionSize);
 
-    uint32_t writeCounterL = 0;
-    std::string writeCounterKey = vfId + "_HBM_WRITE_L";
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, writeCounterKey, telemOffset, writeCounterL)) {
-        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for writeCounterL returning error:0x%x \n", __FUNCTION__, ZE_RESULT_ERROR_NOT_AVAILABLE);
-        return ZE_RESULT_ERROR_NOT_AVAILABLE;
-    }
-
-    uint32_t writeCounterH = 0;
-    writeCounterKey = vfId + "_HBM_WRITE_H";
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemDir, writeCounterKey, telemOffset, writeCounterH)) {
-        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for writeCounterH returning error:0x%x \n", __FUNCTION__, ZE_RESULT_ERROR_NOT_AVAILABLE);
-        return ZE_RESULT_ERROR_NOT_AVAILABLE;
-    }
-
-    pBandwidth->writeCounter = writeCounterH;
-    pBandwidth->writeCounter = (pBandwidth->writeCounter << 32) | static_cast<uint64_t>(writeCounterL);
+    pBandwidth->writeCounter = counterValues[3];
+    pBandwidth->writeCounter = (pBandwidth->writeCounter << 32) | static_cast<uint64_t>(counterValues[2]);
     pBandwidth->writeCounter = (pBandwidth->writeCounter * transactionSize);
-    pBandwidth->timestamp = SysmanDevice::getSysmanTimestamp();
+    pBandwidth->timestamp = sampleTimestamp;
 
     uint64_t hbmFrequency = 0;
     auto pSysmanKmdInterface = pLinuxSysmanImp->getSysmanKmdInterface();
@@ -7,6 +7,8 @@
 
 #include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
 #include "level_zero/sysman/source/shared/linux/zes_os_sysman_imp.h"
 
 #include <csignal>
@@ -34,6 +36,12 @@ void FdCacheInterface::eraseLeastUsedEntryFromCache() {
     fdMap.erase(leastUsedIterator);
 }
 
+FdCacheInterface::FdCacheInterface() {
+    if (NEO::debugManager.flags.SysmanFdCacheSize.get() > 0) {
+        cacheSize = static_cast<size_t>(NEO::debugManager.flags.SysmanFdCacheSize.get());
+    }
+}
+
 int FdCacheInterface::getFd(std::string file) {
     int fd = -1;
     if (fdMap.find(file) == fdMap.end()) {
@@ -41,7 +49,7 @@ int FdCacheInterface::getFd(std::string file) {
         if (fd < 0) {
             return -1;
         }
-        if (fdMap.size() == maxSize) {
+        if (fdMap.size() >= cacheSize) {
             eraseLeastUsedEntryFromCache();
         }
         fdMap[file] = std::make_pair(fd, 1);
@@ -52,17 +60,25 @@ int FdCacheInterface::getFd(std::string file) {
     return fdMap[file].first;
 }
 
-FdCacheInterface::~FdCacheInterface() {
+void FdCacheInterface::clear() {
     for (auto it = fdMap.begin(); it != fdMap.end(); ++it) {
         NEO::SysCalls::close(it->second.first);
     }
     fdMap.clear();
 }
 
+FdCacheInterface::~FdCacheInterface() {
+    clear();
+}
+
 template <typename T>
 ze_result_t FsAccessInterface::readValue(const std::string file, T &val) {
     auto lock = this->obtainMutex();
+    return readValueLocked(file, val);
+}
 
+template <typename T>
+ze_result_t FsAccessInterface::readValueLocked(const std::string &file, T &val) {
     std::string readVal(64, '\0');
     int fd = pFdCacheInterface->getFd(file);
     if (fd < 0) {
@@ -108,6 +124,21 @@ ze_result_t FsAccessInterface::read(const std::string file, uint32_t &val) {
     return readValue<uint32_t>(file, val);
 }
 
+void FsAccessInterface::readValues(const std::vector<std::string> &files, std::vector<uint32_t> &vals, std::vector<ze_result_t> &results) {
+    // Read several values under single lock, reusing cached file descriptors
+    vals.assign(files.size(), 0u);
+    results.assign(files.size(), ZE_RESULT_SUCCESS);
+    auto lock = this->obtainMutex();
+    for (size_t i = 0; i < files.size(); i++) {
+        results[i] = readValueLocked<uint32_t>(files[i], vals[i]);
+    }
+}
+
+void FsAccessInterface::invalidateFdCache() {
+    auto lock = this->obtainMutex();
+    pFdCacheInterface->clear();
+}
+
 ze_result_t FsAccessInterface::read(const std::string file, std::string &val) {
     // Read a single line from text file without trailing newline
     std::ifstream fs;
@@ -448,6 +479,15 @@ ze_result_t SysFsAccessInterface::read(const std::string file, uint32_t &val) {
     return FsAccessInterface::read(fullPath(file), val);
 }
 
+void SysFsAccessInterface::readValues(const std::vector<std::string> &files, std::vector<uint32_t> &vals, std::vector<ze_result_t> &results) {
+    std::vector<std::string> fullPaths;
+    fullPaths.reserve(files.size());
+    for (const auto &file : files) {
+        fullPaths.push_back(fullPath(file));
+    }
+    FsAccessInterface::readValues(fullPaths, vals, results);
+}
+
 ze_result_t SysFsAccessInterface::read(const std::string file, double &val) {
     return FsAccessInterface::read(fullPath(file), val);
 }
@@ -21,15 +21,17 @@ namespace Sysman {
 
 class FdCacheInterface {
   public:
-    FdCacheInterface() = default;
+    FdCacheInterface();
     ~FdCacheInterface();
 
     static const int maxSize = 10;
     int getFd(std::string file);
+    void clear();
 
   protected:
     // Map of File name to pair of file descriptor and reference count to file.
     std::map<std::string, std::pair<int, uint32_t>> fdMap = {};
+    size_t cacheSize = maxSize;
 
   private:
     void eraseLeastUsedEntryFromCache();
@@ -50,6 +52,7 @@ class FsAccessInterface {
     virtual ze_result_t read(const std::string file, double &val);
     virtual ze_result_t read(const std::string file, uint32_t &val);
     virtual ze_result_t read(const std::string file, int32_t &val);
+    virtual void readValues(const std::vector<std::string> &files, std::vector<uint32_t> &vals, std::vector<ze_result_t> &results);
 
     virtual ze_result_t write(const std::string file, const std::string val);
 
@@ -61,6 +64,7 @@ class FsAccessInterface {
     std::string getDirName(const std::string path);
     virtual bool fileExists(const std::string file);
     virtual bool directoryExists(const std::string path);
+    void invalidateFdCache();
 
   protected:
     FsAccessInterface();
@@ -69,6 +73,8 @@ class FsAccessInterface {
   private:
     template <typename T>
     ze_result_t readValue(const std::string file, T &val);
+    template <typename T>
+    ze_result_t readValueLocked(const std::string &file, T &val);
     std::unique_ptr<FdCacheInterface> pFdCacheInterface = nullptr;
     std::mutex fsMutex{};
 };
@@ -111,6 +117,7 @@ class SysFsAccessInterface : protected FsAccessInterface {
     ze_result_t read(const std::string file, uint64_t &val) override;
     ze_result_t read(const std::string file, double &val) override;
     ze_result_t read(const std::string file, std::vector<std::string> &val) override;
+    void readValues(const std::vector<std::string> &files, std::vector<uint32_t> &vals, std::vector<ze_result_t> &results) override;
 
     ze_result_t write(const std::string file, const std::string val) override;
     MOCKABLE_VIRTUAL ze_result_t write(const std::string file, const int val);
@@ -127,6 +134,7 @@ class SysFsAccessInterface : protected FsAccessInterface {
     MOCKABLE_VIRTUAL bool isMyDeviceFile(const std::string dev);
     bool directoryExists(const std::string path) override;
     bool isRootUser() override;
+    using FsAccessInterface::invalidateFdCache;
 
   protected:
     SysFsAccessInterface();
@@ -22,6 +22,7 @@
 #include "level_zero/sysman/source/api/pci/sysman_pci_utils.h"
 #include "level_zero/sysman/source/shared/firmware_util/sysman_firmware_util.h"
 #include "level_zero/sysman/source/shared/linux/kmd_interface/sysman_kmd_interface.h"
+#include "level_zero/sysman/source/shared/linux/pmt/sysman_pmt.h"
 #include "level_zero/sysman/source/shared/linux/pmu/sysman_pmu.h"
 #include "level_zero/sysman/source/shared/linux/product_helper/sysman_product_helper.h"
 #include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
@@ -265,6 +266,15 @@ ze_result_t LinuxSysmanImp::gpuProcessCleanup(ze_bool_t force) {
 }
 
 void LinuxSysmanImp::releaseSysmanDeviceResources() {
+    // Cached sysfs descriptors must not outlive the device being reset
+    pSysfsAccess->invalidateFdCache();
+    pFsAccess->invalidateFdCache();
+    for (const auto &telemData : mapOfSubDeviceIdToTelemData) {
+        PlatformMonitoringTech::clearTelemetrySamples(telemData.second->telemDir);
+    }
+    for (const auto &telemNode : telemNodesInPciPath) {
+        PlatformMonitoringTech::clearTelemetrySamples(telemNode.second);
+    }
     getSysmanDeviceImp()->pEngineHandleContext->releaseEngines();
     getSysmanDeviceImp()->pRasHandleContext->releaseRasHandles();
     getSysmanDeviceImp()->pMemoryHandleContext->releaseMemoryHandles();
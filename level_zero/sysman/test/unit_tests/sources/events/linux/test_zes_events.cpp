@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
 
 #include "level_zero/sysman/test/unit_tests/sources/events/linux/mock_events.h"
@@ -2137,6 +2138,103 @@ TEST_F(SysmanEventsFixture, GivenValidDeviceHandleWhenListeningForUnsupportedEve
     delete[] pDeviceEvents;
 }
 
+TEST_F(SysmanEventsFixture, GivenPersistentEventMonitorEnabledWhenListeningForEventsMultipleTimesThenUdevMonitorAndPipeAreCreatedOnce) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnablePersistentSysmanEventMonitor.set(1);
+
+    static uint32_t pipeCreatedCount = 0;
+    pipeCreatedCount = 0;
+    VariableBackup<decltype(SysCalls::sysCallsPipe)> mockPipe(&SysCalls::sysCallsPipe, [](int pipeFd[2]) -> int {
+        pipeCreatedCount++;
+        pipeFd[0] = mockReadPipeFd;
+        pipeFd[1] = mockWritePipeFd;
+        return 1;
+    });
+    VariableBackup<decltype(SysCalls::sysCallsPoll)> mockPoll(&SysCalls::sysCallsPoll, [](struct pollfd *pollFd, unsigned long int numberOfFds, int timeout) -> int {
+        return 0;
+    });
+
+    auto pPublicLinuxSysmanDriverImp = new PublicLinuxSysmanDriverImp();
+    auto pOsSysmanDriverOriginal = driverHandle->pOsSysmanDriver;
+    driverHandle->pOsSysmanDriver = static_cast<L0::Sysman::OsSysmanDriver *>(pPublicLinuxSysmanDriverImp);
+
+    auto pUdevLibLocal = new EventsUdevLibMock();
+    auto pUdevLibOriginal = pPublicLinuxSysmanDriverImp->pUdevLib;
+    pPublicLinuxSysmanDriverImp->pUdevLib = pUdevLibLocal;
+
+    auto pLinuxEventsImp = new PublicLinuxEventsUtil(pPublicLinuxSysmanDriverImp);
+    auto pLinuxEventsUtilOld = pPublicLinuxSysmanDriverImp->pLinuxEventsUtil;
+    pPublicLinuxSysmanDriverImp->pLinuxEventsUtil = pLinuxEventsImp;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEventRegister(device->toHandle(), ZES_EVENT_TYPE_FLAG_DEVICE_DETACH));
+
+    zes_event_type_flags_t pEvents = 0;
+    std::vector<zes_event_type_flags_t> registeredEvents(1);
+    zes_device_handle_t *phDevices = new zes_device_handle_t[1];
+    phDevices[0] = device->toHandle();
+    EXPECT_FALSE(pLinuxEventsImp->listenSystemEvents(&pEvents, 1u, registeredEvents, phDevices, 1u));
+    EXPECT_FALSE(pLinuxEventsImp->listenSystemEvents(&pEvents, 1u, registeredEvents, phDevices, 1u));
+    EXPECT_EQ(1u, pUdevLibLocal->registerEventsFromSubsystemAndGetFdCalled);
+    EXPECT_EQ(1u, pipeCreatedCount);
+    EXPECT_EQ(mockReadPipeFd, pLinuxEventsImp->pipeFd[0]);
+    EXPECT_EQ(mockWritePipeFd, pLinuxEventsImp->pipeFd[1]);
+
+    delete[] phDevices;
+    pPublicLinuxSysmanDriverImp->pLinuxEventsUtil = pLinuxEventsUtilOld;
+    pPublicLinuxSysmanDriverImp->pUdevLib = pUdevLibOriginal;
+    driverHandle->pOsSysmanDriver = pOsSysmanDriverOriginal;
+    delete pPublicLinuxSysmanDriverImp;
+    delete pUdevLibLocal;
+    delete pLinuxEventsImp;
+}
+
+TEST_F(SysmanEventsFixture, GivenPersistentEventMonitorDisabledWhenListeningForEventsMultipleTimesThenUdevMonitorAndPipeAreSetUpForEachListen) {
+    static uint32_t pipeCreatedCount = 0;
+    pipeCreatedCount = 0;
+    VariableBackup<decltype(SysCalls::sysCallsPipe)> mockPipe(&SysCalls::sysCallsPipe, [](int pipeFd[2]) -> int {
+        pipeCreatedCount++;
+        pipeFd[0] = mockReadPipeFd;
+        pipeFd[1] = mockWritePipeFd;
+        return 1;
+    });
+    VariableBackup<decltype(SysCalls::sysCallsPoll)> mockPoll(&SysCalls::sysCallsPoll, [](struct pollfd *pollFd, unsigned long int numberOfFds, int timeout) -> int {
+        return 0;
+    });
+
+    auto pPublicLinuxSysmanDriverImp = new PublicLinuxSysmanDriverImp();
+    auto pOsSysmanDriverOriginal = driverHandle->pOsSysmanDriver;
+    driverHandle->pOsSysmanDriver = static_cast<L0::Sysman::OsSysmanDriver *>(pPublicLinuxSysmanDriverImp);
+
+    auto pUdevLibLocal = new EventsUdevLibMock();
+    auto pUdevLibOriginal = pPublicLinuxSysmanDriverImp->pUdevLib;
+    pPublicLinuxSysmanDriverImp->pUdevLib = pUdevLibLocal;
+
+    auto pLinuxEventsImp = new PublicLinuxEventsUtil(pPublicLinuxSysmanDriverImp);
+    auto pLinuxEventsUtilOld = pPublicLinuxSysmanDriverImp->pLinuxEventsUtil;
+    pPublicLinuxSysmanDriverImp->pLinuxEventsUtil = pLinuxEventsImp;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEventRegister(device->toHandle(), ZES_EVENT_TYPE_FLAG_DEVICE_DETACH));
+
+    zes_event_type_flags_t pEvents = 0;
+    std::vector<zes_event_type_flags_t> registeredEvents(1);
+    zes_device_handle_t *phDevices = new zes_device_handle_t[1];
+    phDevices[0] = device->toHandle();
+    EXPECT_FALSE(pLinuxEventsImp->listenSystemEvents(&pEvents, 1u, registeredEvents, phDevices, 1u));
+    EXPECT_FALSE(pLinuxEventsImp->listenSystemEvents(&pEvents, 1u, registeredEvents, phDevices, 1u));
+    EXPECT_EQ(2u, pUdevLibLocal->registerEventsFromSubsystemAndGetFdCalled);
+    EXPECT_EQ(2u, pipeCreatedCount);
+    EXPECT_EQ(-1, pLinuxEventsImp->pipeFd[0]);
+    EXPECT_EQ(-1, pLinuxEventsImp->pipeFd[1]);
+
+    delete[] phDevices;
+    pPublicLinuxSysmanDriverImp->pLinuxEventsUtil = pLinuxEventsUtilOld;
+    pPublicLinuxSysmanDriverImp->pUdevLib = pUdevLibOriginal;
+    driverHandle->pOsSysmanDriver = pOsSysmanDriverOriginal;
+    delete pPublicLinuxSysmanDriverImp;
+    delete pUdevLibLocal;
+    delete pLinuxEventsImp;
+}
+
 } // namespace ult
 } // namespace Sysman
 } // namespace L0
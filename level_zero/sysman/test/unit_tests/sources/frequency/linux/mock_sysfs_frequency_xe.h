@@ -195,6 +195,14 @@ struct MockXeFrequencySysfsAccess : public L0::Sysman::SysFsAccessInterface {
         return getValU32(file, val);
     }
 
+    void readValues(const std::vector<std::string> &files, std::vector<uint32_t> &vals, std::vector<ze_result_t> &results) override {
+        vals.assign(files.size(), 0u);
+        results.assign(files.size(), ZE_RESULT_SUCCESS);
+        for (size_t i = 0; i < files.size(); i++) {
+            results[i] = read(files[i], vals[i]);
+        }
+    }
+
     ze_result_t write(const std::string file, double val) override {
         return setVal(file, val);
     }
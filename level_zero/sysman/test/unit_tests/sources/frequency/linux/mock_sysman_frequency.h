@@ -185,6 +185,14 @@ struct MockFrequencySysfsAccess : public L0::Sysman::SysFsAccessInterface {
         return ZE_RESULT_SUCCESS;
     }
 
+    void readValues(const std::vector<std::string> &files, std::vector<uint32_t> &vals, std::vector<ze_result_t> &results) override {
+        vals.assign(files.size(), 0u);
+        results.assign(files.size(), ZE_RESULT_SUCCESS);
+        for (size_t i = 0; i < files.size(); i++) {
+            results[i] = read(files[i], vals[i]);
+        }
+    }
+
     ze_result_t getValLegacy(const std::string file, double &val) {
         if (file.compare(minFreqFileLegacy) == 0) {
             val = mockMin;
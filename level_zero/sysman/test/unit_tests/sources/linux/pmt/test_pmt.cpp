@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
 #include "level_zero/sysman/source/shared/linux/product_helper/sysman_product_helper_hw.h"
 #include "level_zero/sysman/test/unit_tests/sources/linux/mock_sysman_fixture.h"
 #include "level_zero/sysman/test/unit_tests/sources/linux/mocks/mock_sysman_product_helper.h"
@@ -201,6 +203,155 @@ TEST_F(ZesPmtFixture, GivenKeyDoesNotExistinKeyOffsetMapWhenCallingReadValueForU
     EXPECT_FALSE(PlatformMonitoringTech::readValue(keyOffsetMap, mockTelemDir, mockKey, mockOffset, value));
 }
 
+static uint32_t telemPreadCount = 0;
+
+static ssize_t mockReadTelemPattern(int fd, void *buf, size_t count, off_t offset) {
+    telemPreadCount++;
+    auto bytes = static_cast<uint8_t *>(buf);
+    for (size_t i = 0; i < count; i++) {
+        bytes[i] = static_cast<uint8_t>(offset + i);
+    }
+    return count;
+}
+
+TEST_F(ZesPmtFixture, GivenTelemetrySampleStalenessSetWhenReadingMultipleKeysThenTelemetryRegionIsReadOnceAndValuesAreDecodedFromSample) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.PmtTelemetrySampleStaleness.set(60000);
+    PlatformMonitoringTech::clearTelemetrySamples();
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, &mockOpenSuccess);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, &mockReadTelemPattern);
+    telemPreadCount = 0;
+
+    std::map<std::string, uint64_t> keyOffsetMap = {{"PACKAGE_ENERGY", 104}, {"SOC_TEMPERATURES", 56}};
+    uint64_t telemOffset = 8;
+    uint64_t energy = 0;
+    uint32_t temperature = 0;
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(keyOffsetMap, sysfsPathTelem1, "PACKAGE_ENERGY", telemOffset, energy));
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(keyOffsetMap, sysfsPathTelem1, "SOC_TEMPERATURES", telemOffset, temperature));
+    EXPECT_EQ(1u, telemPreadCount);
+
+    uint64_t expectedEnergy = 0;
+    uint32_t expectedTemperature = 0;
+    mockReadTelemPattern(0, &expectedEnergy, sizeof(expectedEnergy), static_cast<off_t>(telemOffset + 104));
+    mockReadTelemPattern(0, &expectedTemperature, sizeof(expectedTemperature), static_cast<off_t>(telemOffset + 56));
+    EXPECT_EQ(expectedEnergy, energy);
+    EXPECT_EQ(expectedTemperature, temperature);
+
+    PlatformMonitoringTech::clearTelemetrySamples();
+    telemPreadCount = 0;
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(keyOffsetMap, sysfsPathTelem1, "SOC_TEMPERATURES", telemOffset, temperature));
+    EXPECT_EQ(1u, telemPreadCount);
+    PlatformMonitoringTech::clearTelemetrySamples();
+}
+
+TEST_F(ZesPmtFixture, GivenTelemetrySampleStalenessSetWhenReadingKeysFromCachedSampleThenTimestampOfSampleIsReturned) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.PmtTelemetrySampleStaleness.set(60000);
+    PlatformMonitoringTech::clearTelemetrySamples();
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, &mockOpenSuccess);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, &mockReadTelemPattern);
+
+    std::map<std::string, uint64_t> keyOffsetMap = {{"PACKAGE_ENERGY", 104}, {"SOC_TEMPERATURES", 56}};
+    uint64_t energy = 0;
+    uint32_t temperature = 0;
+    uint64_t energyTimestamp = 0;
+    uint64_t temperatureTimestamp = 0;
+    auto timestampBeforeRead = SysmanDevice::getSysmanTimestamp();
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(keyOffsetMap, sysfsPathTelem1, "PACKAGE_ENERGY", 0, energy, energyTimestamp));
+    auto timestampAfterRead = SysmanDevice::getSysmanTimestamp();
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(keyOffsetMap, sysfsPathTelem1, "SOC_TEMPERATURES", 0, temperature, temperatureTimestamp));
+
+    EXPECT_LE(timestampBeforeRead, energyTimestamp);
+    EXPECT_GE(timestampAfterRead, energyTimestamp);
+    EXPECT_EQ(energyTimestamp, temperatureTimestamp);
+    PlatformMonitoringTech::clearTelemetrySamples();
+}
+
+TEST_F(ZesPmtFixture, GivenTelemetrySampleStalenessSetWhenReadingValuesOfMultipleKeysThenAllValuesComeFromOneSampleWithItsTimestamp) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.PmtTelemetrySampleStaleness.set(60000);
+    PlatformMonitoringTech::clearTelemetrySamples();
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, &mockOpenSuccess);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, &mockReadTelemPattern);
+    telemPreadCount = 0;
+
+    std::map<std::string, uint64_t> keyOffsetMap = {{"VF0_HBM0_READ", 92}, {"VF0_HBM0_WRITE", 96}, {"VF0_HBM3_WRITE", 332}};
+    uint64_t telemOffset = 8;
+    std::vector<uint32_t> values;
+    uint64_t timestamp = 0;
+    auto timestampBeforeRead = SysmanDevice::getSysmanTimestamp();
+    EXPECT_TRUE(PlatformMonitoringTech::readValues(keyOffsetMap, sysfsPathTelem1, {"VF0_HBM0_READ", "VF0_HBM3_WRITE", "VF0_HBM0_WRITE"}, telemOffset, values, timestamp));
+    auto timestampAfterRead = SysmanDevice::getSysmanTimestamp();
+    EXPECT_EQ(1u, telemPreadCount);
+    EXPECT_LE(timestampBeforeRead, timestamp);
+    EXPECT_GE(timestampAfterRead, timestamp);
+
+    uint32_t value = 0;
+    uint64_t valueTimestamp = 0;
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(keyOffsetMap, sysfsPathTelem1, "VF0_HBM0_WRITE", telemOffset, value, valueTimestamp));
+    EXPECT_EQ(1u, telemPreadCount);
+    EXPECT_EQ(timestamp, valueTimestamp);
+
+    ASSERT_EQ(3u, values.size());
+    const uint64_t keyOffsets[] = {92, 332, 96};
+    for (auto i = 0u; i < values.size(); i++) {
+        uint32_t expectedValue = 0;
+        mockReadTelemPattern(0, &expectedValue, sizeof(expectedValue), static_cast<off_t>(telemOffset + keyOffsets[i]));
+        EXPECT_EQ(expectedValue, values[i]);
+    }
+    PlatformMonitoringTech::clearTelemetrySamples();
+}
+
+TEST_F(ZesPmtFixture, GivenKeyMissingInKeyOffsetMapWhenReadingValuesThenFalseIsReturnedAndTelemetryIsNotRead) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, &mockOpenSuccess);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, &mockReadTelemPattern);
+    telemPreadCount = 0;
+
+    std::map<std::string, uint64_t> keyOffsetMap = {{"VF0_HBM0_READ", 92}};
+    std::vector<uint32_t> values;
+    uint64_t timestamp = 0;
+    EXPECT_FALSE(PlatformMonitoringTech::readValues(keyOffsetMap, sysfsPathTelem1, {"VF0_HBM0_READ", "VF0_HBM0_WRITE"}, 0, values, timestamp));
+    EXPECT_EQ(0u, telemPreadCount);
+}
+
+TEST_F(ZesPmtFixture, GivenSamplesOfMultipleTelemNodesCachedWhenClearingSamplesOfOneNodeThenSampleOfOtherNodeIsKept) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.PmtTelemetrySampleStaleness.set(60000);
+    PlatformMonitoringTech::clearTelemetrySamples();
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, &mockOpenSuccess);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, &mockReadTelemPattern);
+
+    std::map<std::string, uint64_t> keyOffsetMap = {{"PACKAGE_ENERGY", 104}};
+    uint64_t energy = 0;
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(keyOffsetMap, sysfsPathTelem1, "PACKAGE_ENERGY", 0, energy));
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(keyOffsetMap, sysfsPathTelem2, "PACKAGE_ENERGY", 0, energy));
+
+    PlatformMonitoringTech::clearTelemetrySamples(sysfsPathTelem1);
+    telemPreadCount = 0;
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(keyOffsetMap, sysfsPathTelem2, "PACKAGE_ENERGY", 0, energy));
+    EXPECT_EQ(0u, telemPreadCount);
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(keyOffsetMap, sysfsPathTelem1, "PACKAGE_ENERGY", 0, energy));
+    EXPECT_EQ(1u, telemPreadCount);
+    PlatformMonitoringTech::clearTelemetrySamples();
+}
+
+TEST_F(ZesPmtFixture, GivenTelemetrySampleStalenessNotSetWhenReadingMultipleKeysThenEachKeyIsReadSeparately) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, &mockOpenSuccess);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, &mockReadTelemPattern);
+    telemPreadCount = 0;
+
+    std::map<std::string, uint64_t> keyOffsetMap = {{"PACKAGE_ENERGY", 104}, {"SOC_TEMPERATURES", 56}};
+    uint64_t energy = 0;
+    uint32_t temperature = 0;
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(keyOffsetMap, sysfsPathTelem1, "PACKAGE_ENERGY", 0, energy));
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(keyOffsetMap, sysfsPathTelem1, "SOC_TEMPERATURES", 0, temperature));
+    EXPECT_EQ(2u, telemPreadCount);
+}
+
 } // namespace ult
 } // namespace Sysman
 } // namespace L0
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_driver_info.h"
 #include "shared/test/common/mocks/mock_driver_model.h"
 #include "shared/test/common/test_macros/test.h"
@@ -296,6 +297,98 @@ TEST(FdCacheTest, GivenValidFdCacheWhenClearingCacheThenVerifyProperFdsAreClosed
     delete pFdCache;
 }
 
+TEST(FdCacheTest, GivenSysmanFdCacheSizeSetWhenCallingGetFdOnMoreFilesThanDefaultThenAllFdsAreKeptOpen) {
+    class MockFdCache : public FdCacheInterface {
+      public:
+        using FdCacheInterface::fdMap;
+    };
+
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SysmanFdCacheSize.set(2 * L0::Sysman::FdCacheInterface::maxSize);
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return 1;
+    });
+
+    auto pFdCache = std::make_unique<MockFdCache>();
+    for (auto i = 0; i < 2 * L0::Sysman::FdCacheInterface::maxSize; i++) {
+        EXPECT_LE(0, pFdCache->getFd("mockfile" + std::to_string(i) + ".txt"));
+    }
+    EXPECT_EQ(static_cast<size_t>(2 * L0::Sysman::FdCacheInterface::maxSize), pFdCache->fdMap.size());
+}
+
+TEST_F(SysmanDeviceFixture, GivenCachedFdsWhenInvalidatingFdCacheThenFdsAreClosedAndFilesAreReopenedOnNextRead) {
+    static uint32_t openCount = 0;
+    static uint32_t closeCount = 0;
+    openCount = 0;
+    closeCount = 0;
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        openCount++;
+        return 1;
+    });
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsClose)> mockClose(&NEO::SysCalls::sysCallsClose, [](int fileDescriptor) -> int {
+        closeCount++;
+        return 0;
+    });
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        std::string value = "123";
+        memcpy(buf, value.data(), value.size());
+        return value.size();
+    });
+
+    auto tempFsAccess = std::make_unique<PublicFsAccess>();
+    uint32_t val = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, tempFsAccess->read("mockfile.txt", val));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, tempFsAccess->read("mockfile.txt", val));
+    EXPECT_EQ(1u, openCount);
+
+    tempFsAccess->invalidateFdCache();
+    EXPECT_EQ(1u, closeCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, tempFsAccess->read("mockfile.txt", val));
+    EXPECT_EQ(2u, openCount);
+}
+
+TEST_F(SysmanDeviceFixture, GivenMultipleFilesWhenCallingReadValuesThenValuesAndResultsAreReturnedPerFileUnderSingleLock) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return std::string(pathname).find("missing") != std::string::npos ? -1 : 1;
+    });
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        std::string value = "123";
+        memcpy(buf, value.data(), value.size());
+        return value.size();
+    });
+
+    class MockMutexFsAccess : public L0::Sysman::FsAccessInterface {
+      public:
+        uint32_t mutexLockCounter = 0;
+        std::unique_lock<std::mutex> obtainMutex() override {
+            mutexLockCounter++;
+            return L0::Sysman::FsAccessInterface::obtainMutex();
+        }
+    };
+
+    auto tempFsAccess = std::make_unique<MockMutexFsAccess>();
+    std::vector<std::string> files = {"mockfile0.txt", "missingfile.txt", "mockfile1.txt"};
+    std::vector<uint32_t> vals;
+    std::vector<ze_result_t> results;
+
+    errno = ENOENT;
+    tempFsAccess->readValues(files, vals, results);
+    EXPECT_EQ(1u, tempFsAccess->mutexLockCounter);
+    ASSERT_EQ(files.size(), vals.size());
+    ASSERT_EQ(files.size(), results.size());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, results[0]);
+    EXPECT_EQ(123u, vals[0]);
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, results[1]);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, results[2]);
+    EXPECT_EQ(123u, vals[2]);
+}
+
 TEST_F(SysmanDeviceFixture, GivenSysfsAccessClassAndOpenSysCallFailsWhenCallingReadThenFailureIsReturned) {
 
     VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
@@ -22,6 +22,7 @@
 #include <level_zero/zet_api.h>
 
 #include <cstring>
+#include <thread>
 
 namespace L0 {
 constexpr uint32_t ipSamplinDomainId = 100u;
@@ -446,12 +447,40 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
     DeviceImp *deviceImp = static_cast<DeviceImp *>(&this->getMetricSource().getMetricDeviceContext().getDevice());
     auto &l0GfxCoreHelper = deviceImp->getNEODevice()->getRootDeviceEnvironment().getHelper<L0GfxCoreHelper>();
 
-    for (const uint8_t *pRawIpData = pRawData; pRawIpData < pRawData + (rawReportCount * rawReportSize); pRawIpData += rawReportSize) {
-        dataOverflow |= l0GfxCoreHelper.stallIpDataMapUpdate(stallReportDataMap, pRawIpData);
+    uint32_t decodeThreadCount = 1u;
+    if (NEO::debugManager.flags.IpSamplingDecodeThreadCount.get() > 1) {
+        decodeThreadCount = std::min(static_cast<uint32_t>(NEO::debugManager.flags.IpSamplingDecodeThreadCount.get()), rawReportCount);
+    }
+
+    if (decodeThreadCount > 1) {
+        // Each thread aggregates a contiguous range of reports into its own map,
+        // partial results are merged afterwards.
+        std::vector<std::map<uint64_t, void *>> threadReportDataMaps(decodeThreadCount);
+        std::vector<uint8_t> threadDataOverflow(decodeThreadCount, 0u);
+        std::vector<std::thread> decodeThreads;
+        for (uint32_t threadIndex = 0; threadIndex < decodeThreadCount; threadIndex++) {
+            const uint32_t firstReport = static_cast<uint32_t>(static_cast<uint64_t>(rawReportCount) * threadIndex / decodeThreadCount);
+            const uint32_t lastReport = static_cast<uint32_t>(static_cast<uint64_t>(rawReportCount) * (threadIndex + 1) / decodeThreadCount);
+            decodeThreads.emplace_back([&, threadIndex, firstReport, lastReport]() {
+                for (uint32_t report = firstReport; report < lastReport; report++) {
+                    threadDataOverflow[threadIndex] |= l0GfxCoreHelper.stallIpDataMapUpdate(threadReportDataMaps[threadIndex], pRawData + static_cast<size_t>(report) * rawReportSize);
+                }
+            });
+        }
+        for (uint32_t threadIndex = 0; threadIndex < decodeThreadCount; threadIndex++) {
+            decodeThreads[threadIndex].join();
+            l0GfxCoreHelper.stallIpDataMapMerge(stallReportDataMap, threadReportDataMaps[threadIndex]);
+            dataOverflow |= (threadDataOverflow[threadIndex] != 0u);
+        }
+    } else {
+        for (const uint8_t *pRawIpData = pRawData; pRawIpData < pRawData + (rawReportCount * rawReportSize); pRawIpData += rawReportSize) {
+            dataOverflow |= l0GfxCoreHelper.stallIpDataMapUpdate(stallReportDataMap, pRawIpData);
+        }
     }
 
     metricValueCount = std::min<uint32_t>(metricValueCount, static_cast<uint32_t>(stallReportDataMap.size()) * properties.metricCount);
     std::vector<zet_typed_value_t> ipDataValues;
+    ipDataValues.reserve(properties.metricCount);
     uint32_t i = 0;
     for (auto it = stallReportDataMap.begin(); it != stallReportDataMap.end(); ++it) {
         l0GfxCoreHelper.stallSumIpDataToTypedValues(it->first, it->second, ipDataValues);
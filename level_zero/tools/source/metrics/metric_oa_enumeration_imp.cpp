@@ -1048,6 +1048,8 @@ void OaMetricGroupImp::setCachedExportDataHeapSize(size_t size) {
         oaMetricGroupImp->setCachedExportDataHeapSize(size);
     }
     cachedExportDataHeapSize = size;
+    std::lock_guard<std::mutex> lock(cachedExportMetadataMutex);
+    cachedExportMetadata.clear();
 }
 
 ze_result_t OaMetricImp::getProperties(zet_metric_properties_t *pProperties) {
@@ -12,6 +12,7 @@
 #include "level_zero/tools/source/metrics/metric.h"
 #include "level_zero/tools/source/metrics/metric_oa_source.h"
 
+#include <mutex>
 #include <vector>
 
 namespace L0 {
@@ -220,6 +221,8 @@ struct OaMetricGroupImp : public MetricGroupImp {
 
     std::vector<MetricGroupImp *> metricGroups;
     size_t cachedExportDataHeapSize = 0;
+    std::vector<uint8_t> cachedExportMetadata;
+    std::mutex cachedExportMetadataMutex;
 
   private:
     ze_result_t openForDevice(Device *pDevice, zet_metric_streamer_desc_t &desc,
@@ -757,37 +757,63 @@ ze_result_t OaMetricGroupImp::getExportData(const uint8_t *pRawData,
         return ZE_RESULT_ERROR_INVALID_SIZE;
     }
 
-    uintptr_t startHeapAddress = reinterpret_cast<uintptr_t>(pExportData + sizeof(zet_intel_metric_df_gpu_export_data_format_t));
-    uintptr_t endHeapAddress = startHeapAddress + requiredHeapSize;
-
-    HeapUsageTracker memoryTracker(startHeapAddress, endHeapAddress);
+    // Exported metadata uses offsets relative to the start of export data, so once generated
+    // it can be reused for following exports of the same metric group. Adapter params are not
+    // part of the cached state and are regenerated on every export.
+    const size_t exportMetadataSize = sizeof(zet_intel_metric_df_gpu_export_data_format_t) + requiredHeapSize;
+    const bool useExportMetadataCache = NEO::debugManager.flags.EnableMetricExportMetadataCache.get() == 1;
+    zet_intel_metric_df_gpu_export_data_format_t *exportData = reinterpret_cast<zet_intel_metric_df_gpu_export_data_format_t *>(pExportData);
 
     OaMetricSourceImp *metricSource = getMetricSource();
     MetricsDiscovery::IMetricsDevice_1_5 *mdDevice = metricSource->getMetricEnumeration().getMdapiDevice();
     MetricsDiscovery::IAdapter_1_9 *mdAdapter = metricSource->getMetricEnumeration().getMdapiAdapter();
-    MetricOaExporter01 exporter01(*mdDevice, *mdAdapter, *pReferenceMetricSet, *pReferenceConcurrentGroup, memoryTracker);
-    zet_intel_metric_df_gpu_export_data_format_t *exportData = reinterpret_cast<zet_intel_metric_df_gpu_export_data_format_t *>(pExportData);
 
-    // read and update the export data
-    status = exporter01.getExportData(&exportData->format01.oaData);
-    if (status != ZE_RESULT_SUCCESS) {
-        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr,
-                              "Error: ExportData_0_1 Failed at %s():%d returning 0x%x\n",
-                              __FUNCTION__, __LINE__, status);
-        return status;
-    }
+    std::unique_lock<std::mutex> cacheLock(cachedExportMetadataMutex);
+    if (useExportMetadataCache && cachedExportMetadata.size() == exportMetadataSize) {
+        memcpy_s(pExportData, exportMetadataSize, cachedExportMetadata.data(), exportMetadataSize);
 
-    DEBUG_BREAK_IF(memoryTracker.getUsedBytes() != requiredHeapSize);
+        HeapUsageTracker memoryTracker(0, 0, HeapUsageTracker::OperationModeTrackOnly);
+        MetricOaExporter01 exporter01(*mdDevice, *mdAdapter, *pReferenceMetricSet, *pReferenceConcurrentGroup, memoryTracker);
+        status = exporter01.updateAdapterParams(&exportData->format01.oaData.adapterParams);
+        if (status != ZE_RESULT_SUCCESS) {
+            NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr,
+                                  "Error: ExportData_0_1 Failed at %s():%d returning 0x%x\n",
+                                  __FUNCTION__, __LINE__, status);
+            return status;
+        }
+    } else {
+        uintptr_t startHeapAddress = reinterpret_cast<uintptr_t>(pExportData + sizeof(zet_intel_metric_df_gpu_export_data_format_t));
+        uintptr_t endHeapAddress = startHeapAddress + requiredHeapSize;
+
+        HeapUsageTracker memoryTracker(startHeapAddress, endHeapAddress);
+        MetricOaExporter01 exporter01(*mdDevice, *mdAdapter, *pReferenceMetricSet, *pReferenceConcurrentGroup, memoryTracker);
+
+        // read and update the export data
+        status = exporter01.getExportData(&exportData->format01.oaData);
+        if (status != ZE_RESULT_SUCCESS) {
+            NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr,
+                                  "Error: ExportData_0_1 Failed at %s():%d returning 0x%x\n",
+                                  __FUNCTION__, __LINE__, status);
+            return status;
+        }
+
+        DEBUG_BREAK_IF(memoryTracker.getUsedBytes() != requiredHeapSize);
+
+        if (useExportMetadataCache) {
+            cachedExportMetadata.assign(pExportData, pExportData + exportMetadataSize);
+        }
+    }
+    cacheLock.unlock();
 
     // Update header after updating the export data
     exportData->header.type = ZET_INTEL_METRIC_DF_SOURCE_TYPE_OA;
     exportData->header.version.major = ZET_INTEL_GPU_METRIC_VERSION_MAJOR;
     exportData->header.version.minor = ZET_INTEL_GPU_METRIC_VERSION_MINOR;
-    exportData->header.rawDataOffset = sizeof(zet_intel_metric_df_gpu_export_data_format_t) + memoryTracker.getUsedBytes();
+    exportData->header.rawDataOffset = exportMetadataSize;
     exportData->header.rawDataSize = rawDataSize;
 
     // Append the rawData
-    memcpy_s(reinterpret_cast<void *>(endHeapAddress), expectedExportDataSize - exportData->header.rawDataOffset, pRawData, rawDataSize);
+    memcpy_s(pExportData + exportMetadataSize, expectedExportDataSize - exportMetadataSize, pRawData, rawDataSize);
 
     return ZE_RESULT_SUCCESS;
 }
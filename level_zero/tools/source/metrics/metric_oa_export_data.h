@@ -49,6 +49,7 @@ class MetricOaExporter01 {
                        MetricsDiscovery::IConcurrentGroup_1_5 &mdConcurrentGroup,
                        HeapUsageTracker &heapUsageTracker);
     ze_result_t getExportData(zet_intel_metric_df_gpu_metric_oa_calc_0_1_t *oaCalcData);
+    ze_result_t updateAdapterParams(zet_intel_metric_df_gpu_adapter_params_0_1_t *adapterParams);
 
   protected:
     enum OperationMode : uint32_t {
@@ -76,7 +77,6 @@ class MetricOaExporter01 {
     ze_result_t updateConcurrentGroup(zet_intel_metric_df_gpu_concurrent_group_0_1_t *concGroup);
     void updateMetricSetParams(zet_intel_metric_df_gpu_metric_set_params_0_1_t *params);
     ze_result_t updateMetricSet(zet_intel_metric_df_gpu_metric_set_0_1_t *metricSet);
-    ze_result_t updateAdapterParams(zet_intel_metric_df_gpu_adapter_params_0_1_t *adapterParams);
     ze_result_t updateGlobalSymbolOffsetAndValues(zet_intel_metric_df_gpu_global_symbol_0_1_offset_t *globalSymbolsOffset);
     ze_result_t getMetricResultType(zet_intel_metric_df_gpu_metric_result_type_t &resltType, const MetricsDiscovery::TMetricResultType mdResultType);
     void updateMetricsDeviceParams(zet_intel_metric_df_gpu_metrics_device_params_0_1_t *deviceParams);
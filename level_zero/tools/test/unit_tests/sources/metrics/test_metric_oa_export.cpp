@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include "level_zero/core/source/device/device_imp.h"
@@ -1041,5 +1042,82 @@ TEST_F(MetricExportDataOaTest, givenErrorDuringExportingPhaseWhenMetricGroupGetE
               ZE_RESULT_ERROR_UNSUPPORTED_VERSION);
 }
 
+TEST_F(MetricExportDataOaTest, givenExportMetadataCacheEnabledWhenMetricGroupGetExportDataIsCalledAgainThenCachedMetadataIsReusedWithCurrentAdapterParams) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableMetricExportMetadataCache.set(1);
+
+    setupMdapiParameters();
+    openMetricsAdapter();
+    setupDefaultMocksForMetricDevice(metricsDevice);
+    setupMocks();
+
+    auto metricGroupHandle = getMetricGroupHandle();
+
+    std::array<uint8_t, 4> rawData = {1, 2, 3, 4};
+    size_t exportDataSize = 0;
+    EXPECT_EQ(zetMetricGroupGetExportDataExp(metricGroupHandle,
+                                             rawData.data(), rawData.size(), &exportDataSize, nullptr),
+              ZE_RESULT_SUCCESS);
+    EXPECT_GT(exportDataSize, 0u);
+
+    adapterParams.SystemId.Type = MetricsDiscovery::ADAPTER_ID_TYPE_LUID;
+    adapterParams.SystemId.Luid.LowPart = 21;
+    std::vector<uint8_t> exportData(exportDataSize);
+    EXPECT_EQ(zetMetricGroupGetExportDataExp(metricGroupHandle,
+                                             rawData.data(), rawData.size(), &exportDataSize, exportData.data()),
+              ZE_RESULT_SUCCESS);
+
+    adapterParams.SystemId.Luid.LowPart = 22;
+    rawData = {5, 6, 7, 8};
+    std::vector<uint8_t> cachedExportData(exportDataSize);
+    EXPECT_EQ(zetMetricGroupGetExportDataExp(metricGroupHandle,
+                                             rawData.data(), rawData.size(), &exportDataSize, cachedExportData.data()),
+              ZE_RESULT_SUCCESS);
+    auto exportedData = reinterpret_cast<zet_intel_metric_df_gpu_export_data_format_t *>(cachedExportData.data());
+    auto rawDataOffset = readUnaligned(&exportedData->header.rawDataOffset);
+    EXPECT_EQ(readUnaligned(&exportedData->format01.oaData.adapterParams.systemId.luid.lowPart), 22u);
+    EXPECT_EQ(0, memcmp(exportData.data() + sizeof(zet_intel_metric_df_gpu_export_data_format_t), cachedExportData.data() + sizeof(zet_intel_metric_df_gpu_export_data_format_t),
+                        rawDataOffset - sizeof(zet_intel_metric_df_gpu_export_data_format_t)));
+    EXPECT_EQ(readUnaligned(&exportedData->header.rawDataSize), rawData.size());
+    EXPECT_EQ(0, memcmp(cachedExportData.data() + rawDataOffset, rawData.data(), rawData.size()));
+
+    auto oaMetricGroupImp = static_cast<OaMetricGroupImp *>(L0::MetricGroup::fromHandle(metricGroupHandle));
+    oaMetricGroupImp->setCachedExportDataHeapSize(0);
+    adapterParams.SystemId.Luid.LowPart = 23;
+    EXPECT_EQ(zetMetricGroupGetExportDataExp(metricGroupHandle,
+                                             rawData.data(), rawData.size(), &exportDataSize, cachedExportData.data()),
+              ZE_RESULT_SUCCESS);
+    EXPECT_EQ(readUnaligned(&exportedData->format01.oaData.adapterParams.systemId.luid.lowPart), 23u);
+}
+
+TEST_F(MetricExportDataOaTest, givenExportMetadataCacheEnabledAndUnsupportedAdapterIdWhenMetricGroupGetExportDataUsesCachedMetadataThenErrorIsReturned) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableMetricExportMetadataCache.set(1);
+
+    setupMdapiParameters();
+    openMetricsAdapter();
+    setupDefaultMocksForMetricDevice(metricsDevice);
+    setupMocks();
+
+    auto metricGroupHandle = getMetricGroupHandle();
+
+    std::array<uint8_t, 4> rawData = {1, 2, 3, 4};
+    size_t exportDataSize = 0;
+    EXPECT_EQ(zetMetricGroupGetExportDataExp(metricGroupHandle,
+                                             rawData.data(), rawData.size(), &exportDataSize, nullptr),
+              ZE_RESULT_SUCCESS);
+
+    adapterParams.SystemId.Type = MetricsDiscovery::ADAPTER_ID_TYPE_LUID;
+    std::vector<uint8_t> exportData(exportDataSize);
+    EXPECT_EQ(zetMetricGroupGetExportDataExp(metricGroupHandle,
+                                             rawData.data(), rawData.size(), &exportDataSize, exportData.data()),
+              ZE_RESULT_SUCCESS);
+
+    adapterParams.SystemId.Type = MetricsDiscovery::ADAPTER_ID_TYPE_UNDEFINED;
+    EXPECT_EQ(zetMetricGroupGetExportDataExp(metricGroupHandle,
+                                             rawData.data(), rawData.size(), &exportDataSize, exportData.data()),
+              ZE_RESULT_ERROR_UNSUPPORTED_VERSION);
+}
+
 } // namespace ult
 } // namespace L0
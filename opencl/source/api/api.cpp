@@ -18,6 +18,7 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/debug_env_reader.h"
 #include "shared/source/os_interface/device_factory.h"
+#include "shared/source/utilities/api_latency_histograms.h"
 #include "shared/source/utilities/buffer_pool_allocator.inl"
 #include "shared/source/utilities/heap_allocator.h"
 #include "shared/source/utilities/staging_buffer_manager.h"
@@ -2049,6 +2050,7 @@ cl_int CL_API_CALL clGetKernelWorkGroupInfo(cl_kernel kernel,
 
 cl_int CL_API_CALL clWaitForEvents(cl_uint numEvents,
                                    const cl_event *eventList) {
+    NEO::ApiLatencyScope latencyScope(NEO::ApiLatencyEntryPoint::clWaitForEvents);
     TRACING_ENTER(ClWaitForEvents, &numEvents, &eventList);
 
     auto retVal = CL_SUCCESS;
@@ -2330,6 +2332,7 @@ cl_int CL_API_CALL clFlush(cl_command_queue commandQueue) {
 }
 
 cl_int CL_API_CALL clFinish(cl_command_queue commandQueue) {
+    NEO::ApiLatencyScope latencyScope(NEO::ApiLatencyEntryPoint::clFinish);
     TRACING_ENTER(ClFinish, &commandQueue);
     cl_int retVal = CL_SUCCESS;
     API_ENTER(&retVal);
@@ -2352,6 +2355,7 @@ cl_int CL_API_CALL clEnqueueReadBuffer(cl_command_queue commandQueue,
                                        cl_uint numEventsInWaitList,
                                        const cl_event *eventWaitList,
                                        cl_event *event) {
+    NEO::ApiLatencyScope latencyScope(NEO::ApiLatencyEntryPoint::clEnqueueReadBuffer);
     TRACING_ENTER(ClEnqueueReadBuffer, &commandQueue, &buffer, &blockingRead, &offset, &cb, &ptr, &numEventsInWaitList, &eventWaitList, &event);
     CommandQueue *pCommandQueue = nullptr;
     Buffer *pBuffer = nullptr;
@@ -2502,6 +2506,7 @@ cl_int CL_API_CALL clEnqueueWriteBuffer(cl_command_queue commandQueue,
                                         cl_uint numEventsInWaitList,
                                         const cl_event *eventWaitList,
                                         cl_event *event) {
+    NEO::ApiLatencyScope latencyScope(NEO::ApiLatencyEntryPoint::clEnqueueWriteBuffer);
     TRACING_ENTER(ClEnqueueWriteBuffer, &commandQueue, &buffer, &blockingWrite, &offset, &cb, &ptr, &numEventsInWaitList, &eventWaitList, &event);
     cl_int retVal = CL_SUCCESS;
     API_ENTER(&retVal);
@@ -3524,6 +3529,7 @@ cl_int CL_API_CALL clEnqueueNDRangeKernel(cl_command_queue commandQueue,
                                           cl_uint numEventsInWaitList,
                                           const cl_event *eventWaitList,
                                           cl_event *event) {
+    NEO::ApiLatencyScope latencyScope(NEO::ApiLatencyEntryPoint::clEnqueueNDRangeKernel);
     TRACING_ENTER(ClEnqueueNdRangeKernel, &commandQueue, &kernel, &workDim, &globalWorkOffset, &globalWorkSize, &localWorkSize, &numEventsInWaitList, &eventWaitList, &event);
     cl_int retVal = CL_SUCCESS;
     API_ENTER(&retVal);
@@ -7,6 +7,7 @@
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 
+#include "shared/source/built_ins/buffer_builtin_variant.h"
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/basic_math.h"
@@ -59,9 +60,20 @@ class BuiltInOp<EBuiltInOps::copyBufferToBuffer> : public BuiltinDispatchInfoBui
 
         uint32_t rootDeviceIndex = clDevice.getRootDeviceIndex();
 
+        // large aligned middle region is copied by a grid-stride kernel moving a cache line per iteration
+        const bool useGridStride = kernMiddleGridStride != nullptr && !isSrcMisaligned && middleSizeBytes > 0 &&
+                                   BufferBuiltinVariantHelper::selectVariant(middleSizeBytes) == BufferBuiltinVariant::gridStride;
+        const auto gridStrideEls = middleSizeBytes / MemoryConstants::cacheLineSize;
+        if (useGridStride) {
+            auto simdSize = kernMiddleGridStride->getKernel(rootDeviceIndex)->getKernelInfo().getMaxSimdSize();
+            middleSizeEls = BufferBuiltinVariantHelper::getGridStrideWorkItemsCount(gridStrideEls, simdSize, clDevice.getHardwareInfo());
+        }
+
         // Set-up ISA
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::left, kernLeftLeftover->getKernel(rootDeviceIndex));
-        if (isSrcMisaligned) {
+        if (useGridStride) {
+            kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::middle, kernMiddleGridStride->getKernel(rootDeviceIndex));
+        } else if (isSrcMisaligned) {
             kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::middle, kernMiddleMisaligned->getKernel(rootDeviceIndex));
         } else {
             kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::middle, kernMiddle->getKernel(rootDeviceIndex));
@@ -102,7 +114,9 @@ class BuiltInOp<EBuiltInOps::copyBufferToBuffer> : public BuiltinDispatchInfoBui
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::middle, 3, static_cast<OffsetType>(operationParams.dstOffset.x + leftSize));
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::right, 3, static_cast<OffsetType>(operationParams.dstOffset.x + leftSize + middleSizeBytes));
 
-        if (isSrcMisaligned) {
+        if (useGridStride) {
+            kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::middle, 4, static_cast<OffsetType>(gridStrideEls));
+        } else if (isSrcMisaligned) {
             kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::middle, 4, static_cast<uint32_t>(srcMisalignment * 8));
         }
 
@@ -124,6 +138,7 @@ class BuiltInOp<EBuiltInOps::copyBufferToBuffer> : public BuiltinDispatchInfoBui
     MultiDeviceKernel *kernLeftLeftover = nullptr;
     MultiDeviceKernel *kernMiddle = nullptr;
     MultiDeviceKernel *kernMiddleMisaligned = nullptr;
+    MultiDeviceKernel *kernMiddleGridStride = nullptr;
     MultiDeviceKernel *kernRightLeftover = nullptr;
     BuiltInOp(BuiltIns &kernelsLib, ClDevice &device, bool populateKernels)
         : BuiltinDispatchInfoBuilder(kernelsLib, device) {
@@ -133,6 +148,7 @@ class BuiltInOp<EBuiltInOps::copyBufferToBuffer> : public BuiltinDispatchInfoBui
                      "CopyBufferToBufferLeftLeftover", kernLeftLeftover,
                      "CopyBufferToBufferMiddle", kernMiddle,
                      "CopyBufferToBufferMiddleMisaligned", kernMiddleMisaligned,
+                     "CopyBufferToBufferMiddleGridStride", kernMiddleGridStride,
                      "CopyBufferToBufferRightLeftover", kernRightLeftover);
         }
     }
@@ -148,6 +164,7 @@ class BuiltInOp<EBuiltInOps::copyBufferToBufferStateless> : public BuiltInOp<EBu
                  "CopyBufferToBufferLeftLeftover", kernLeftLeftover,
                  "CopyBufferToBufferMiddle", kernMiddle,
                  "CopyBufferToBufferMiddleMisaligned", kernMiddleMisaligned,
+                 "CopyBufferToBufferMiddleGridStride", kernMiddleGridStride,
                  "CopyBufferToBufferRightLeftover", kernRightLeftover);
     }
 
@@ -166,6 +183,7 @@ class BuiltInOp<EBuiltInOps::copyBufferToBufferStatelessHeapless> : public Built
                  "CopyBufferToBufferLeftLeftover", kernLeftLeftover,
                  "CopyBufferToBufferMiddle", kernMiddle,
                  "CopyBufferToBufferMiddleMisaligned", kernMiddleMisaligned,
+                 "CopyBufferToBufferMiddleGridStride", kernMiddleGridStride,
                  "CopyBufferToBufferRightLeftover", kernRightLeftover);
     }
 
@@ -478,9 +496,21 @@ class BuiltInOp<EBuiltInOps::fillBuffer> : public BuiltinDispatchInfoBuilder {
 
         uint32_t rootDeviceIndex = clDevice.getRootDeviceIndex();
 
+        const bool useGridStride = kernMiddleGridStride != nullptr && middleSizeBytes > 0 &&
+                                   BufferBuiltinVariantHelper::selectVariant(middleSizeBytes) == BufferBuiltinVariant::gridStride;
+        const auto gridStrideEls = middleSizeEls;
+        if (useGridStride) {
+            auto simdSize = kernMiddleGridStride->getKernel(rootDeviceIndex)->getKernelInfo().getMaxSimdSize();
+            middleSizeEls = BufferBuiltinVariantHelper::getGridStrideWorkItemsCount(gridStrideEls, simdSize, clDevice.getHardwareInfo());
+        }
+
         // Set-up ISA
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::left, kernLeftLeftover->getKernel(rootDeviceIndex));
-        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::middle, kernMiddle->getKernel(rootDeviceIndex));
+        if (useGridStride) {
+            kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::middle, kernMiddleGridStride->getKernel(rootDeviceIndex));
+        } else {
+            kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::middle, kernMiddle->getKernel(rootDeviceIndex));
+        }
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::right, kernRightLeftover->getKernel(rootDeviceIndex));
 
         DEBUG_BREAK_IF((operationParams.srcMemObj == nullptr) || (operationParams.srcOffset != 0));
@@ -511,6 +541,10 @@ class BuiltInOp<EBuiltInOps::fillBuffer> : public BuiltinDispatchInfoBuilder {
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::middle, 3, static_cast<OffsetType>(operationParams.srcMemObj->getSize() / middleElSize));
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::right, 3, static_cast<OffsetType>(operationParams.srcMemObj->getSize()));
 
+        if (useGridStride) {
+            kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::middle, 4, static_cast<OffsetType>(gridStrideEls));
+        }
+
         // Set-up work sizes
         // Note for split walker, it would be just builder.SetDipatchGeomtry(GWS, ELWS, OFFSET)
         kernelSplit1DBuilder.setDispatchGeometry(SplitDispatch::RegionCoordX::left, Vec3<size_t>{leftSize, 0, 0}, Vec3<size_t>{0, 0, 0}, Vec3<size_t>{0, 0, 0});
@@ -528,6 +562,7 @@ class BuiltInOp<EBuiltInOps::fillBuffer> : public BuiltinDispatchInfoBuilder {
   protected:
     MultiDeviceKernel *kernLeftLeftover = nullptr;
     MultiDeviceKernel *kernMiddle = nullptr;
+    MultiDeviceKernel *kernMiddleGridStride = nullptr;
     MultiDeviceKernel *kernRightLeftover = nullptr;
 
     BuiltInOp(BuiltIns &kernelsLib, ClDevice &device, bool populateKernels)
@@ -537,6 +572,7 @@ class BuiltInOp<EBuiltInOps::fillBuffer> : public BuiltinDispatchInfoBuilder {
                      "",
                      "FillBufferLeftLeftover", kernLeftLeftover,
                      "FillBufferMiddle", kernMiddle,
+                     "FillBufferMiddleGridStride", kernMiddleGridStride,
                      "FillBufferRightLeftover", kernRightLeftover);
         }
     }
@@ -550,6 +586,7 @@ class BuiltInOp<EBuiltInOps::fillBufferStateless> : public BuiltInOp<EBuiltInOps
                  CompilerOptions::greaterThan4gbBuffersRequired,
                  "FillBufferLeftLeftover", kernLeftLeftover,
                  "FillBufferMiddle", kernMiddle,
+                 "FillBufferMiddleGridStride", kernMiddleGridStride,
                  "FillBufferRightLeftover", kernRightLeftover);
     }
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfos) const override {
@@ -565,6 +602,7 @@ class BuiltInOp<EBuiltInOps::fillBufferStatelessHeapless> : public BuiltInOp<EBu
                  CompilerOptions::greaterThan4gbBuffersRequired,
                  "FillBufferLeftLeftover", kernLeftLeftover,
                  "FillBufferMiddle", kernMiddle,
+                 "FillBufferMiddleGridStride", kernMiddleGridStride,
                  "FillBufferRightLeftover", kernRightLeftover);
     }
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfos) const override {
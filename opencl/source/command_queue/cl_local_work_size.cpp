@@ -11,6 +11,7 @@
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/local_work_size.h"
+#include "shared/source/kernel/local_work_size_cache.h"
 #include "shared/source/utilities/logger.h"
 
 #include "opencl/source/context/context.h"
@@ -24,6 +25,18 @@ Vec3<size_t> computeWorkgroupSize(const DispatchInfo &dispatchInfo) {
     size_t workGroupSize[3] = {};
     auto kernel = dispatchInfo.getKernel();
 
+    LocalWorkSizeCacheKey cacheKey;
+    bool useCache = kernel != nullptr && debugManager.flags.EnableLocalWorkSizeCache.get() == 1;
+    if (useCache) {
+        cacheKey.globalSize = dispatchInfo.getGWS();
+        cacheKey.slmTotalSize = kernel->getSlmTotalSize();
+        cacheKey.workDim = dispatchInfo.getDim();
+        Vec3<size_t> cachedWorkGroupSize = {0, 0, 0};
+        if (kernel->getLocalWorkSizeCache().find(cacheKey, cachedWorkGroupSize)) {
+            return cachedWorkGroupSize;
+        }
+    }
+
     if (kernel != nullptr) {
         if (debugManager.flags.EnableComputeWorkSizeND.get()) {
             WorkSizeInfo wsInfo = createWorkSizeInfoFromDispatchInfo(dispatchInfo);
@@ -44,6 +57,9 @@ Vec3<size_t> computeWorkgroupSize(const DispatchInfo &dispatchInfo) {
     }
     DBG_LOG(PrintLWSSizes, "Input GWS enqueueBlocked", dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z,
             " Driver deduced LWS", workGroupSize[0], workGroupSize[1], workGroupSize[2]);
+    if (useCache) {
+        kernel->getLocalWorkSizeCache().insert(cacheKey, workGroupSize);
+    }
     return {workGroupSize[0], workGroupSize[1], workGroupSize[2]};
 }
 
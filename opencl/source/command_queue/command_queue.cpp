@@ -133,6 +133,7 @@ CommandQueue::CommandQueue(Context *context, ClDevice *device, const cl_queue_pr
 
         this->heaplessModeEnabled = compilerProductHelper.isHeaplessModeEnabled();
         this->heaplessStateInitEnabled = compilerProductHelper.isHeaplessStateInitEnabled(this->heaplessModeEnabled);
+        this->sharedBlockedHeapsEnabled = debugManager.flags.EnableSharedBlockedEnqueueHeaps.get() == 1;
     }
 }
 
@@ -149,6 +150,10 @@ CommandQueue::~CommandQueue() {
         }
         delete commandStream;
 
+        for (auto &sharedBlockedHeap : sharedBlockedHeaps) {
+            sharedBlockedHeap.reset();
+        }
+
         if (this->perfCountersEnabled) {
             device->getPerformanceCounters()->shutdown();
         }
@@ -241,12 +246,16 @@ void CommandQueue::initializeGpgpuInternals() const {
     gpgpuEngine->commandStreamReceiver->requestPreallocation();
     gpgpuEngine->commandStreamReceiver->initDirectSubmission();
 
-    if (getCmdQueueProperties<cl_queue_properties>(propertiesVector.data(), CL_QUEUE_PROPERTIES) & static_cast<cl_queue_properties>(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) && !this->gpgpuEngine->commandStreamReceiver->isUpdateTagFromWaitEnabled()) {
+    const bool outOfOrderQueue = getCmdQueueProperties<cl_queue_properties>(propertiesVector.data(), CL_QUEUE_PROPERTIES) & static_cast<cl_queue_properties>(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+    const bool inOrderQueueBatching = !outOfOrderQueue && debugManager.flags.EnableInOrderQueueBatching.get() == 1;
+    if ((outOfOrderQueue || inOrderQueueBatching) && !this->gpgpuEngine->commandStreamReceiver->isUpdateTagFromWaitEnabled()) {
         this->gpgpuEngine->commandStreamReceiver->overrideDispatchPolicy(DispatchMode::batchedDispatch);
         if (debugManager.flags.CsrDispatchMode.get() != 0) {
             this->gpgpuEngine->commandStreamReceiver->overrideDispatchPolicy(static_cast<DispatchMode>(debugManager.flags.CsrDispatchMode.get()));
         }
-        this->gpgpuEngine->commandStreamReceiver->enableNTo1SubmissionModel();
+        if (outOfOrderQueue) {
+            this->gpgpuEngine->commandStreamReceiver->enableNTo1SubmissionModel();
+        }
     }
 }
 
@@ -997,6 +1006,19 @@ void CommandQueue::allocateHeapMemory(IndirectHeapType heapType, size_t minRequi
     getGpgpuCommandStreamReceiver().allocateHeapMemory(heapType, minRequiredSize, indirectHeap);
 }
 
+std::shared_ptr<IndirectHeap> CommandQueue::obtainSharedBlockedHeap(IndirectHeapType heapType, size_t minRequiredSize) {
+    // leave room for aligning the data of the next command
+    minRequiredSize += MemoryConstants::pageSize;
+
+    auto &sharedBlockedHeap = sharedBlockedHeaps[heapType];
+    if (sharedBlockedHeap == nullptr || sharedBlockedHeap->getAvailableSpace() < minRequiredSize) {
+        IndirectHeap *indirectHeap = nullptr;
+        allocateHeapMemory(heapType, minRequiredSize, indirectHeap);
+        sharedBlockedHeap = KernelOperation::createSharedHeap(indirectHeap, *getGpgpuCommandStreamReceiver().getInternalAllocationStorage());
+    }
+    return sharedBlockedHeap;
+}
+
 void CommandQueue::releaseIndirectHeap(IndirectHeapType heapType) {
     getGpgpuCommandStreamReceiver().releaseIndirectHeap(heapType);
 }
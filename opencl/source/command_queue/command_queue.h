@@ -24,6 +24,7 @@
 #include "opencl/source/helpers/properties_helper.h"
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 
 namespace NEO {
@@ -259,6 +260,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     void allocateHeapMemory(IndirectHeapType heapType,
                             size_t minRequiredSize, IndirectHeap *&indirectHeap);
+    std::shared_ptr<IndirectHeap> obtainSharedBlockedHeap(IndirectHeapType heapType, size_t minRequiredSize);
+    bool isSharedBlockedHeapsEnabled() const { return sharedBlockedHeapsEnabled; }
 
     static bool isAssignEngineRoundRobinEnabled();
     static bool isTimestampWaitEnabled();
@@ -486,6 +489,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     bool gpgpuCsrClientRegistered = false;
     bool heaplessModeEnabled = false;
     bool heaplessStateInitEnabled = false;
+    bool sharedBlockedHeapsEnabled = false;
+    std::array<std::shared_ptr<IndirectHeap>, IndirectHeapType::numTypes> sharedBlockedHeaps;
 };
 
 template <typename PtrType>
@@ -119,6 +119,9 @@ class HardwareInterface {
     static void obtainIndirectHeaps(CommandQueue &commandQueue, const MultiDispatchInfo &multiDispatchInfo,
                                     bool blockedQueue, IndirectHeap *&dsh, IndirectHeap *&ioh, IndirectHeap *&ssh);
 
+    static void obtainSharedBlockedHeaps(CommandQueue &commandQueue, const MultiDispatchInfo &multiDispatchInfo,
+                                         KernelOperation &blockedCommandsData, IndirectHeap *&dsh, IndirectHeap *&ioh, IndirectHeap *&ssh);
+
     template <typename WalkerType>
     static void dispatchKernelCommands(CommandQueue &commandQueue, const DispatchInfo &dispatchInfo, LinearStream &commandStream,
                                        IndirectHeap &dsh, IndirectHeap &ioh, IndirectHeap &ssh,
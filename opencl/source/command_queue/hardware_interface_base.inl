@@ -96,11 +96,15 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
 
     // Allocate command stream and indirect heaps
     bool blockedQueue = (walkerArgs.blockedCommandsData != nullptr);
-    obtainIndirectHeaps(commandQueue, multiDispatchInfo, blockedQueue, dsh, ioh, ssh);
-    if (blockedQueue) {
+    if (blockedQueue && commandQueue.isSharedBlockedHeapsEnabled()) {
+        obtainSharedBlockedHeaps(commandQueue, multiDispatchInfo, *walkerArgs.blockedCommandsData, dsh, ioh, ssh);
+        commandStream = walkerArgs.blockedCommandsData->commandStream.get();
+    } else if (blockedQueue) {
+        obtainIndirectHeaps(commandQueue, multiDispatchInfo, blockedQueue, dsh, ioh, ssh);
         walkerArgs.blockedCommandsData->setHeaps(dsh, ioh, ssh);
         commandStream = walkerArgs.blockedCommandsData->commandStream.get();
     } else {
+        obtainIndirectHeaps(commandQueue, multiDispatchInfo, blockedQueue, dsh, ioh, ssh);
         commandStream = &commandQueue.getCS(0);
     }
 
@@ -266,6 +270,17 @@ void HardwareInterface<GfxFamily>::obtainIndirectHeaps(CommandQueue &commandQueu
     }
 }
 
+template <typename GfxFamily>
+void HardwareInterface<GfxFamily>::obtainSharedBlockedHeaps(CommandQueue &commandQueue, const MultiDispatchInfo &multiDispatchInfo,
+                                                            KernelOperation &blockedCommandsData, IndirectHeap *&dsh, IndirectHeap *&ioh, IndirectHeap *&ssh) {
+    blockedCommandsData.setSharedHeaps(commandQueue.obtainSharedBlockedHeap(IndirectHeap::Type::dynamicState, HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredDSH(multiDispatchInfo)),
+                                       commandQueue.obtainSharedBlockedHeap(IndirectHeap::Type::indirectObject, HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredIOH(multiDispatchInfo)),
+                                       commandQueue.obtainSharedBlockedHeap(IndirectHeap::Type::surfaceState, HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredSSH(multiDispatchInfo)));
+    dsh = blockedCommandsData.dsh.get();
+    ioh = blockedCommandsData.ioh.get();
+    ssh = blockedCommandsData.ssh.get();
+}
+
 template <typename GfxFamily>
 inline void HardwareInterface<GfxFamily>::dispatchDebugPauseCommands(
     LinearStream *commandStream,
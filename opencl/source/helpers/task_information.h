@@ -48,31 +48,38 @@ struct KernelOperation {
     } resourceCleaner{nullptr};
 
     using LinearStreamUniquePtrT = std::unique_ptr<LinearStream, ResourceCleaner>;
-    using IndirectHeapUniquePtrT = std::unique_ptr<IndirectHeap, ResourceCleaner>;
 
   public:
+    // Heaps are shared so that consecutive blocked enqueues can be programmed in place into the same heaps,
+    // their allocation is returned to the internal storage when the last command using it is destroyed.
+    using IndirectHeapSharedPtrT = std::shared_ptr<IndirectHeap>;
+
     KernelOperation() = delete;
     KernelOperation(LinearStream *commandStream, InternalAllocationStorage &storageForAllocations) {
         resourceCleaner.storageForAllocations = &storageForAllocations;
         this->commandStream = LinearStreamUniquePtrT(commandStream, resourceCleaner);
     }
 
+    static IndirectHeapSharedPtrT createSharedHeap(IndirectHeap *heap, InternalAllocationStorage &storageForAllocations) {
+        return IndirectHeapSharedPtrT(heap, ResourceCleaner(&storageForAllocations));
+    }
+
     void setHeaps(IndirectHeap *dsh, IndirectHeap *ioh, IndirectHeap *ssh) {
-        this->dsh = IndirectHeapUniquePtrT(dsh, resourceCleaner);
-        this->ioh = IndirectHeapUniquePtrT(ioh, resourceCleaner);
-        this->ssh = IndirectHeapUniquePtrT(ssh, resourceCleaner);
+        this->dsh = IndirectHeapSharedPtrT(dsh, resourceCleaner);
+        this->ioh = (ioh == dsh) ? this->dsh : IndirectHeapSharedPtrT(ioh, resourceCleaner);
+        this->ssh = IndirectHeapSharedPtrT(ssh, resourceCleaner);
     }
 
-    ~KernelOperation() {
-        if (ioh.get() == dsh.get()) {
-            ioh.release();
-        }
+    void setSharedHeaps(const IndirectHeapSharedPtrT &dsh, const IndirectHeapSharedPtrT &ioh, const IndirectHeapSharedPtrT &ssh) {
+        this->dsh = dsh;
+        this->ioh = ioh;
+        this->ssh = ssh;
     }
 
     LinearStreamUniquePtrT commandStream{nullptr, resourceCleaner};
-    IndirectHeapUniquePtrT dsh{nullptr, resourceCleaner};
-    IndirectHeapUniquePtrT ioh{nullptr, resourceCleaner};
-    IndirectHeapUniquePtrT ssh{nullptr, resourceCleaner};
+    IndirectHeapSharedPtrT dsh;
+    IndirectHeapSharedPtrT ioh;
+    IndirectHeapSharedPtrT ssh;
 
     CommandStreamReceiver *bcsCsr = nullptr;
     BlitPropertiesContainer blitPropertiesContainer;
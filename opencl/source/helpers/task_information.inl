@@ -8,6 +8,9 @@
 namespace NEO {
 template <typename ObjectT>
 void KernelOperation::ResourceCleaner::operator()(ObjectT *object) {
+    if (object == nullptr) {
+        return;
+    }
     storageForAllocations->storeAllocation(std::unique_ptr<GraphicsAllocation>(object->getGraphicsAllocation()),
                                            REUSABLE_ALLOCATION);
     delete object;
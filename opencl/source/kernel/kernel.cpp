@@ -2386,28 +2386,33 @@ bool Kernel::graphicsAllocationTypeUseSystemMemory(AllocationType type) {
 
 void Kernel::initializeLocalIdsCache() {
     auto workgroupDimensionsOrder = getDescriptor().kernelAttributes.workgroupDimensionsOrder;
-    std::array<uint8_t, 3> wgDimOrder = {workgroupDimensionsOrder[0],
-                                         workgroupDimensionsOrder[1],
-                                         workgroupDimensionsOrder[2]};
-    auto simdSize = getDescriptor().kernelAttributes.simdSize;
-    auto grfCount = getDescriptor().kernelAttributes.numGrfRequired;
-    auto grfSize = static_cast<uint8_t>(getDevice().getHardwareInfo().capabilityTable.grfSize);
-    localIdsCache = std::make_unique<LocalIdsCache>(4, wgDimOrder, grfCount, simdSize, grfSize, usingImagesOnly);
+    localIdsCacheKey.wgDimOrder = {workgroupDimensionsOrder[0],
+                                   workgroupDimensionsOrder[1],
+                                   workgroupDimensionsOrder[2]};
+    localIdsCacheKey.simdSize = getDescriptor().kernelAttributes.simdSize;
+    localIdsCacheKey.grfCount = getDescriptor().kernelAttributes.numGrfRequired;
+    localIdsCacheKey.grfSize = static_cast<uint8_t>(getDevice().getHardwareInfo().capabilityTable.grfSize);
+    localIdsCacheKey.usesOnlyImages = usingImagesOnly;
+    localIdsCache = &getDevice().getDevice().getLocalIdsCache();
 }
 
 void Kernel::setLocalIdsForGroup(const Vec3<uint16_t> &groupSize, void *destination) const {
-    UNRECOVERABLE_IF(localIdsCache.get() == nullptr);
-    localIdsCache->setLocalIdsForGroup(groupSize, destination, clDevice.getRootDeviceEnvironment());
+    UNRECOVERABLE_IF(localIdsCache == nullptr);
+    auto key = localIdsCacheKey;
+    key.groupSize = groupSize;
+    localIdsCache->setLocalIdsForGroup(key, destination, clDevice.getRootDeviceEnvironment());
 }
 
 size_t Kernel::getLocalIdsSizeForGroup(const Vec3<uint16_t> &groupSize) const {
-    UNRECOVERABLE_IF(localIdsCache.get() == nullptr);
-    return localIdsCache->getLocalIdsSizeForGroup(groupSize, clDevice.getRootDeviceEnvironment());
+    UNRECOVERABLE_IF(localIdsCache == nullptr);
+    auto key = localIdsCacheKey;
+    key.groupSize = groupSize;
+    return LocalIdsCache::getLocalIdsSizeForGroup(key, clDevice.getRootDeviceEnvironment());
 }
 
 size_t Kernel::getLocalIdsSizePerThread() const {
-    UNRECOVERABLE_IF(localIdsCache.get() == nullptr);
-    return localIdsCache->getLocalIdsSizePerThread();
+    UNRECOVERABLE_IF(localIdsCache == nullptr);
+    return LocalIdsCache::getLocalIdsSizePerThread(localIdsCacheKey);
 }
 
 } // namespace NEO
@@ -13,6 +13,8 @@
 #include "shared/source/helpers/vec.h"
 #include "shared/source/kernel/implicit_args_helper.h"
 #include "shared/source/kernel/kernel_execution_type.h"
+#include "shared/source/kernel/local_ids_cache.h"
+#include "shared/source/kernel/local_work_size_cache.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/unified_memory/unified_memory.h"
 #include "shared/source/utilities/logger.h"
@@ -41,7 +43,6 @@ class ImageTransformer;
 class Surface;
 class PrintfHandler;
 class MultiDeviceKernel;
-class LocalIdsCache;
 
 class Kernel : public ReferenceTrackedObject<Kernel> {
   public:
@@ -374,6 +375,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
     uint32_t getMaxKernelWorkGroupSize() const;
     uint32_t getSlmTotalSize() const;
+    LocalWorkSizeCache &getLocalWorkSizeCache() { return localWorkSizeCache; }
     bool getHasIndirectAccess() const {
         return this->kernelHasIndirectAccess;
     }
@@ -469,7 +471,9 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     bool hasRunFinished(TimestampPacketContainer *timestampContainer);
 
     void initializeLocalIdsCache();
-    std::unique_ptr<LocalIdsCache> localIdsCache;
+    LocalIdsCache *localIdsCache = nullptr;
+    LocalIdsCacheKey localIdsCacheKey;
+    LocalWorkSizeCache localWorkSizeCache;
 
     UnifiedMemoryControls unifiedMemoryControls{};
 
@@ -84,6 +84,51 @@ HWTEST_F(ClCreateCommandQueueTest, givenOoqParametersWhenQueueIsCreatedThenComma
     retVal = clReleaseCommandQueue(cmdq);
 }
 
+HWTEST_F(ClCreateCommandQueueTest, givenInOrderQueueBatchingEnabledWhenInOrderQueueIsCreatedThenCommandStreamReceiverSwitchesToBatchingModeWithoutNTo1Submission) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableInOrderQueueBatching.set(1);
+
+    using BaseType = typename CommandQueue::BaseType;
+    cl_int retVal = CL_SUCCESS;
+    auto clDevice = castToObject<ClDevice>(testedClDevice);
+    auto mockDevice = reinterpret_cast<MockDevice *>(&clDevice->getDevice());
+    auto &csr = mockDevice->getUltCommandStreamReceiver<FamilyType>();
+    EXPECT_EQ(DispatchMode::immediateDispatch, csr.dispatchMode);
+
+    auto cmdq = clCreateCommandQueue(pContext, testedClDevice, 0, &retVal);
+    auto queue = castToObject<CommandQueue>(static_cast<BaseType *>(cmdq));
+    EXPECT_EQ(DispatchMode::batchedDispatch, queue->getGpgpuCommandStreamReceiver().getDispatchMode());
+    EXPECT_FALSE(queue->getGpgpuCommandStreamReceiver().isNTo1SubmissionModelEnabled());
+    retVal = clReleaseCommandQueue(cmdq);
+}
+
+HWTEST_F(ClCreateCommandQueueTest, givenInOrderQueueBatchingNotEnabledWhenInOrderQueueIsCreatedThenCommandStreamReceiverStaysInImmediateMode) {
+    using BaseType = typename CommandQueue::BaseType;
+    cl_int retVal = CL_SUCCESS;
+    auto clDevice = castToObject<ClDevice>(testedClDevice);
+    auto mockDevice = reinterpret_cast<MockDevice *>(&clDevice->getDevice());
+    auto &csr = mockDevice->getUltCommandStreamReceiver<FamilyType>();
+    EXPECT_EQ(DispatchMode::immediateDispatch, csr.dispatchMode);
+
+    auto cmdq = clCreateCommandQueue(pContext, testedClDevice, 0, &retVal);
+    auto queue = castToObject<CommandQueue>(static_cast<BaseType *>(cmdq));
+    EXPECT_EQ(DispatchMode::immediateDispatch, queue->getGpgpuCommandStreamReceiver().getDispatchMode());
+    retVal = clReleaseCommandQueue(cmdq);
+}
+
+HWTEST_F(ClCreateCommandQueueTest, givenInOrderQueueBatchingEnabledAndForcedDispatchModeWhenInOrderQueueIsCreatedThenForcedDispatchModeIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableInOrderQueueBatching.set(1);
+    debugManager.flags.CsrDispatchMode.set(static_cast<int32_t>(DispatchMode::immediateDispatch));
+
+    using BaseType = typename CommandQueue::BaseType;
+    cl_int retVal = CL_SUCCESS;
+    auto cmdq = clCreateCommandQueue(pContext, testedClDevice, 0, &retVal);
+    auto queue = castToObject<CommandQueue>(static_cast<BaseType *>(cmdq));
+    EXPECT_EQ(DispatchMode::immediateDispatch, queue->getGpgpuCommandStreamReceiver().getDispatchMode());
+    retVal = clReleaseCommandQueue(cmdq);
+}
+
 HWTEST_F(ClCreateCommandQueueTest, givenOoqParametersWhenQueueIsCreatedAndUpdateTaskCountFromWaitEnabledThenCommandStreamReceiverDoesntSwitchToBatchingMode) {
     DebugManagerStateRestore restorer;
     debugManager.flags.UpdateTaskCountFromWait.set(3);
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/built_ins/buffer_builtin_variant.h"
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/gmm_helper/gmm.h"
@@ -1195,6 +1196,110 @@ TEST_F(BuiltInTests, GivenUnalignedCopyBufferToBufferWhenDispatchInfoIsCreatedTh
     EXPECT_TRUE(compareBuiltinOpParams(multiDispatchInfo.peekBuiltinOpParams(), builtinOpsParams));
 }
 
+TEST_F(BuiltInTests, givenGridStrideBuffersBuiltinsEnabledWhenCopyBufferToBufferDispatchInfoIsCreatedThenGridStrideKernelWithLimitedWorkItemsIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableGridStrideBufferBuiltins.set(1);
+    debugManager.flags.BufferBuiltinGridStrideThreshold.set(0);
+
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::copyBufferToBuffer, *pClDevice);
+
+    AlignedBuffer src;
+    AlignedBuffer dst;
+
+    BuiltinOpParams builtinOpsParams;
+    builtinOpsParams.srcMemObj = &src;
+    builtinOpsParams.dstMemObj = &dst;
+    builtinOpsParams.size = {src.getSize(), 0, 0};
+
+    MultiDispatchInfo multiDispatchInfo(builtinOpsParams);
+    ASSERT_TRUE(builder.buildDispatchInfos(multiDispatchInfo));
+    EXPECT_EQ(1u, multiDispatchInfo.size());
+
+    const DispatchInfo *dispatchInfo = multiDispatchInfo.begin();
+    const Kernel *kernel = dispatchInfo->getKernel();
+    EXPECT_EQ(kernel->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName, "CopyBufferToBufferMiddleGridStride");
+
+    size_t elements = dst.getSize() / MemoryConstants::cacheLineSize;
+    size_t expectedWorkItems = BufferBuiltinVariantHelper::getGridStrideWorkItemsCount(elements, kernel->getKernelInfo().getMaxSimdSize(), pClDevice->getHardwareInfo());
+    EXPECT_EQ(Vec3<size_t>(expectedWorkItems, 1, 1), dispatchInfo->getGWS());
+
+    const auto crossThreadData = kernel->getCrossThreadData();
+    const auto crossThreadOffset = kernel->getKernelInfo().getArgDescriptorAt(4).as<ArgDescValue>().elements[0].offset;
+    EXPECT_EQ(elements, *reinterpret_cast<uint32_t *>(ptrOffset(crossThreadData, crossThreadOffset)));
+}
+
+TEST_F(BuiltInTests, givenGridStrideBuffersBuiltinsEnabledWhenCopyIsSmallerThanThresholdThenSplitKernelIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableGridStrideBufferBuiltins.set(1);
+
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::copyBufferToBuffer, *pClDevice);
+
+    AlignedBuffer src;
+    AlignedBuffer dst;
+    ASSERT_LT(src.getSize(), BufferBuiltinVariantHelper::defaultGridStrideThreshold);
+
+    BuiltinOpParams builtinOpsParams;
+    builtinOpsParams.srcMemObj = &src;
+    builtinOpsParams.dstMemObj = &dst;
+    builtinOpsParams.size = {src.getSize(), 0, 0};
+
+    MultiDispatchInfo multiDispatchInfo(builtinOpsParams);
+    ASSERT_TRUE(builder.buildDispatchInfos(multiDispatchInfo));
+    EXPECT_EQ(1u, multiDispatchInfo.size());
+    EXPECT_EQ(multiDispatchInfo.begin()->getKernel()->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName, "CopyBufferToBufferMiddle");
+}
+
+TEST_F(BuiltInTests, givenGridStrideBuffersBuiltinsEnabledWhenMisalignedCopyBufferToBufferDispatchInfoIsCreatedThenMisalignedKernelIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableGridStrideBufferBuiltins.set(1);
+    debugManager.flags.BufferBuiltinGridStrideThreshold.set(0);
+
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::copyBufferToBuffer, *pClDevice);
+
+    AlignedBuffer src;
+    AlignedBuffer dst;
+
+    BuiltinOpParams builtinOpsParams;
+    builtinOpsParams.srcMemObj = &src;
+    builtinOpsParams.srcOffset.x = 5;
+    builtinOpsParams.dstMemObj = &dst;
+    builtinOpsParams.size = {src.getSize(), 0, 0};
+
+    MultiDispatchInfo multiDispatchInfo(builtinOpsParams);
+    ASSERT_TRUE(builder.buildDispatchInfos(multiDispatchInfo));
+    EXPECT_EQ(1u, multiDispatchInfo.size());
+    EXPECT_EQ(multiDispatchInfo.begin()->getKernel()->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName, "CopyBufferToBufferMiddleMisaligned");
+}
+
+TEST_F(BuiltInTests, givenGridStrideBuffersBuiltinsEnabledWhenFillBufferDispatchInfoIsCreatedThenGridStrideKernelIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableGridStrideBufferBuiltins.set(1);
+    debugManager.flags.BufferBuiltinGridStrideThreshold.set(0);
+
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::fillBuffer, *pClDevice);
+
+    MockBuffer patternBuffer;
+    patternBuffer.size = sizeof(uint32_t);
+    AlignedBuffer dst;
+
+    BuiltinOpParams builtinOpsParams;
+    builtinOpsParams.srcMemObj = &patternBuffer;
+    builtinOpsParams.dstMemObj = &dst;
+    builtinOpsParams.size = {dst.getSize(), 0, 0};
+
+    MultiDispatchInfo multiDispatchInfo(builtinOpsParams);
+    ASSERT_TRUE(builder.buildDispatchInfos(multiDispatchInfo));
+    EXPECT_EQ(1u, multiDispatchInfo.size());
+
+    const Kernel *kernel = multiDispatchInfo.begin()->getKernel();
+    EXPECT_EQ(kernel->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName, "FillBufferMiddleGridStride");
+
+    size_t elements = dst.getSize() / sizeof(uint32_t);
+    const auto crossThreadData = kernel->getCrossThreadData();
+    const auto crossThreadOffset = kernel->getKernelInfo().getArgDescriptorAt(4).as<ArgDescValue>().elements[0].offset;
+    EXPECT_EQ(elements, *reinterpret_cast<uint32_t *>(ptrOffset(crossThreadData, crossThreadOffset)));
+}
+
 TEST_F(BuiltInTests, GivenReadBufferAlignedWhenDispatchInfoIsCreatedThenParamsAreCorrect) {
     BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::copyBufferToBuffer, *pClDevice);
 
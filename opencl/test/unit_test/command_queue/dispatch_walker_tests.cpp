@@ -37,6 +37,8 @@
 #include "opencl/test/unit_test/mocks/mock_mdi.h"
 #include "opencl/test/unit_test/mocks/mock_program.h"
 
+#include <set>
+
 using namespace NEO;
 
 struct DispatchWalkerTest : public CommandQueueFixture, public ClDeviceFixture, public ::testing::Test {
@@ -796,6 +798,88 @@ HWTEST_F(DispatchWalkerTest, GivenBlockedQueueWhenDispatchingWalkerThenRequiredH
     EXPECT_LE(expectedSizeSSH, blockedCommandsData->ssh->getMaxAvailableSpace());
 }
 
+HWTEST_F(DispatchWalkerTest, givenSharedBlockedHeapsEnabledWhenDispatchingWalkersForBlockedQueueThenCommandsAreProgrammedIntoSameHeaps) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableSharedBlockedEnqueueHeaps.set(1);
+    MockCommandQueueHw<FamilyType> mockCmdQ(nullptr, pClDevice, nullptr);
+    EXPECT_TRUE(mockCmdQ.isSharedBlockedHeapsEnabled());
+
+    MockKernel kernel(program.get(), kernelInfo, *pClDevice);
+    ASSERT_EQ(CL_SUCCESS, kernel.initialize());
+    MockMultiDispatchInfo multiDispatchInfo(pClDevice, &kernel);
+
+    auto firstCommandData = createBlockedCommandsData(mockCmdQ);
+    HardwareInterfaceWalkerArgs walkerArgs = createHardwareInterfaceWalkerArgs(CL_COMMAND_NDRANGE_KERNEL);
+    walkerArgs.blockedCommandsData = firstCommandData.get();
+    HardwareInterface<FamilyType>::template dispatchWalker<typename FamilyType::DefaultWalkerType>(mockCmdQ, multiDispatchInfo, CsrDependencies(), walkerArgs);
+    auto iohUsedByFirstCommand = firstCommandData->ioh->getUsed();
+
+    auto secondCommandData = createBlockedCommandsData(mockCmdQ);
+    walkerArgs.blockedCommandsData = secondCommandData.get();
+    HardwareInterface<FamilyType>::template dispatchWalker<typename FamilyType::DefaultWalkerType>(mockCmdQ, multiDispatchInfo, CsrDependencies(), walkerArgs);
+
+    EXPECT_EQ(0u, mockCmdQ.getCS(1024).getUsed());
+    EXPECT_NE(nullptr, firstCommandData->dsh);
+    EXPECT_EQ(firstCommandData->dsh, secondCommandData->dsh);
+    EXPECT_EQ(firstCommandData->ioh, secondCommandData->ioh);
+    EXPECT_EQ(firstCommandData->ssh, secondCommandData->ssh);
+    EXPECT_NE(firstCommandData->commandStream.get(), secondCommandData->commandStream.get());
+    EXPECT_LE(iohUsedByFirstCommand, secondCommandData->ioh->getUsed());
+}
+
+HWTEST_F(DispatchWalkerTest, givenSharedBlockedHeapsEnabledWhenDispatchingChainOfBlockedCommandsThenHeapAllocationsAreReusedAcrossCommands) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableSharedBlockedEnqueueHeaps.set(1);
+    MockCommandQueueHw<FamilyType> mockCmdQ(nullptr, pClDevice, nullptr);
+
+    MockKernel kernel(program.get(), kernelInfo, *pClDevice);
+    ASSERT_EQ(CL_SUCCESS, kernel.initialize());
+    MockMultiDispatchInfo multiDispatchInfo(pClDevice, &kernel);
+
+    constexpr size_t chainLength = 100;
+    std::vector<std::unique_ptr<KernelOperation>> blockedChain;
+    std::set<GraphicsAllocation *> heapAllocations;
+    for (size_t i = 0; i < chainLength; i++) {
+        blockedChain.push_back(createBlockedCommandsData(mockCmdQ));
+        HardwareInterfaceWalkerArgs walkerArgs = createHardwareInterfaceWalkerArgs(CL_COMMAND_NDRANGE_KERNEL);
+        walkerArgs.blockedCommandsData = blockedChain.back().get();
+        HardwareInterface<FamilyType>::template dispatchWalker<typename FamilyType::DefaultWalkerType>(mockCmdQ, multiDispatchInfo, CsrDependencies(), walkerArgs);
+
+        heapAllocations.insert(blockedChain.back()->dsh->getGraphicsAllocation());
+        heapAllocations.insert(blockedChain.back()->ioh->getGraphicsAllocation());
+        heapAllocations.insert(blockedChain.back()->ssh->getGraphicsAllocation());
+    }
+
+    EXPECT_LT(heapAllocations.size(), chainLength);
+}
+
+HWTEST_F(DispatchWalkerTest, givenSharedBlockedHeapsWhenLastBlockedCommandIsDestroyedThenHeapAllocationIsStoredForReuse) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableSharedBlockedEnqueueHeaps.set(1);
+    debugManager.flags.SetAmountOfReusableAllocationsPerCmdQueue.set(0);
+    MockCommandQueueHw<FamilyType> mockCmdQ(nullptr, pClDevice, nullptr);
+    auto &allocationsForReuse = mockCmdQ.getGpgpuCommandStreamReceiver().getInternalAllocationStorage()->getAllocationsForReuse();
+
+    auto firstCommandData = createBlockedCommandsData(mockCmdQ);
+    auto secondCommandData = createBlockedCommandsData(mockCmdQ);
+    firstCommandData->setSharedHeaps(mockCmdQ.obtainSharedBlockedHeap(IndirectHeap::Type::dynamicState, 1),
+                                     mockCmdQ.obtainSharedBlockedHeap(IndirectHeap::Type::indirectObject, 1),
+                                     mockCmdQ.obtainSharedBlockedHeap(IndirectHeap::Type::surfaceState, 1));
+    secondCommandData->setSharedHeaps(mockCmdQ.obtainSharedBlockedHeap(IndirectHeap::Type::dynamicState, 1),
+                                      mockCmdQ.obtainSharedBlockedHeap(IndirectHeap::Type::indirectObject, 1),
+                                      mockCmdQ.obtainSharedBlockedHeap(IndirectHeap::Type::surfaceState, 1));
+    EXPECT_EQ(firstCommandData->dsh, secondCommandData->dsh);
+    auto &dshAllocation = *firstCommandData->dsh->getGraphicsAllocation();
+
+    firstCommandData.reset();
+    secondCommandData.reset();
+    EXPECT_FALSE(allocationsForReuse.peekContains(dshAllocation));
+
+    auto newHeap = mockCmdQ.obtainSharedBlockedHeap(IndirectHeap::Type::dynamicState, MemoryConstants::pageSize64k);
+    EXPECT_NE(&dshAllocation, newHeap->getGraphicsAllocation());
+    EXPECT_TRUE(allocationsForReuse.peekContains(dshAllocation));
+}
+
 HWTEST_F(DispatchWalkerTest, givenBlockedQueueWhenDispatchWalkerIsCalledThenCommandStreamHasGpuAddress) {
     MockKernel kernel(program.get(), kernelInfo, *pClDevice);
     ASSERT_EQ(CL_SUCCESS, kernel.initialize());
@@ -975,3 +975,29 @@ TEST_F(LocalWorkSizeTest, givenGwsWithSmallXAndBigYWhenLwsIsCalculatedThenDescen
     EXPECT_EQ(workGroupSize[1], 128u);
     EXPECT_EQ(workGroupSize[2], 1u);
 }
+
+TEST_F(LocalWorkSizeTest, givenLocalWorkSizeCacheEnabledWhenComputingWorkgroupSizeThenResultIsCachedPerGlobalSize) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableLocalWorkSizeCache.set(1);
+
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo(&device, kernel.mockKernel, 1, {1021 * 64, 1, 1}, {0, 0, 0}, {0, 0, 0});
+
+    auto &cache = kernel.mockKernel->getLocalWorkSizeCache();
+    EXPECT_EQ(0u, cache.size());
+
+    auto lws = computeWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(1u, cache.size());
+    EXPECT_EQ(lws, computeWorkgroupSize(dispatchInfo));
+    EXPECT_EQ(1u, cache.size());
+
+    dispatchInfo.setGWS({256, 1, 1});
+    computeWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(2u, cache.size());
+
+    debugManager.flags.EnableLocalWorkSizeCache.set(0);
+    dispatchInfo.setGWS({512, 1, 1});
+    computeWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(2u, cache.size());
+}
@@ -182,6 +182,33 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeAndTwoRecord
     EXPECT_EQ(mockCsr->recordedCommandBuffer->batchBuffer.endCmdPtr, lastbbEndPtr);
 }
 
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenTwoTasksAreFlushedAndBatchedSubmissionsAreFlushedThenSingleSubmissionIsCounted) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+    mockCsr->useNewResourceImplicitFlush = false;
+    mockCsr->useGpuIdleImplicitFlush = false;
+    mockCsr->overrideDispatchPolicy(DispatchMode::batchedDispatch);
+    mockCsr->overrideSubmissionAggregator(new MockSubmissionsAggregator());
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+
+    mockCsr->flushTask(commandStream, 0, &dsh, &ioh, &ssh, taskLevel, dispatchFlags, *pDevice);
+    mockCsr->flushTask(commandStream, 0, &dsh, &ioh, &ssh, taskLevel, dispatchFlags, *pDevice);
+
+    EXPECT_EQ(2u, mockCsr->peekSubmissionStatistics().flushedTasks);
+    EXPECT_EQ(0u, mockCsr->peekSubmissionStatistics().submissions);
+
+    mockCsr->flushBatchedSubmissions();
+
+    EXPECT_EQ(2u, mockCsr->peekSubmissionStatistics().flushedTasks);
+    EXPECT_EQ(1u, mockCsr->peekSubmissionStatistics().submissions);
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+}
+
 HWTEST_F(CommandStreamReceiverFlushTaskTests, whenFlushSmallTaskThenCommandStreamAlignedToCacheLine) {
     using MI_BATCH_BUFFER_END = typename FamilyType::MI_BATCH_BUFFER_END;
     auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
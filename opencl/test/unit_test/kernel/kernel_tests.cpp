@@ -3901,6 +3901,16 @@ TEST_F(KernelImplicitArgsTest, givenKernelWithoutImplicitArgsWhenSettingKernelPa
     EXPECT_EQ(nullptr, kernel.getImplicitArgs());
 }
 
+TEST_F(KernelTests, givenTwoKernelsOnSameDeviceWhenLocalIdsCacheIsInitializedThenDeviceWideCacheIsShared) {
+    auto pKernelInfo = std::make_unique<MockKernelInfo>();
+    pKernelInfo->kernelDescriptor.kernelAttributes.simdSize = 32;
+    std::unique_ptr<MockKernel> kernel1(new MockKernel(pProgram, *pKernelInfo, *pClDevice));
+    std::unique_ptr<MockKernel> kernel2(new MockKernel(pProgram, *pKernelInfo, *pClDevice));
+
+    EXPECT_EQ(&pClDevice->getDevice().getLocalIdsCache(), kernel1->localIdsCache);
+    EXPECT_EQ(kernel1->localIdsCache, kernel2->localIdsCache);
+}
+
 TEST_F(KernelTests, GivenCorrectAllocationTypeThenFunctionCheckingSystemMemoryReturnsTrue) {
     std::vector<NEO::AllocationType> systemMemoryAllocationType = {
         NEO::AllocationType::bufferHostMemory,
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/aub/aub_stream_provider.h"
 #include "shared/source/aub/aub_subcapture.h"
+#include "shared/source/command_stream/tbx_page_hash_store.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/memory_manager/address_mapper.h"
 #include "shared/source/memory_manager/physical_address_allocator.h"
@@ -48,6 +49,10 @@ class AubCenter {
         return aubManager.get();
     }
 
+    TbxPageHashStore *getTbxPageHashStore() const {
+        return tbxPageHashStore.get();
+    }
+
     static uint32_t getAubStreamMode(const std::string &aubFileName, CommandStreamReceiverType csrType);
 
   protected:
@@ -57,6 +62,7 @@ class AubCenter {
 
     std::unique_ptr<AubSubCaptureCommon> subCaptureCommon;
     std::unique_ptr<aub_stream::AubManager> aubManager;
+    std::unique_ptr<TbxPageHashStore> tbxPageHashStore = std::make_unique<TbxPageHashStore>();
     uint32_t aubStreamMode = 0;
     uint32_t stepping = 0;
 };
@@ -8,9 +8,12 @@
 #pragma once
 #include "shared/source/aub_mem_dump/aub_data.h"
 
+#include <condition_variable>
 #include <fstream>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace NEO {
 class AubHelper;
@@ -120,6 +123,7 @@ struct AubStream {
 };
 
 struct AubFileStream : public AubStream {
+    ~AubFileStream() override;
     void open(const char *filePath) override;
     void close() override;
     bool init(uint32_t stepping, uint32_t device) override;
@@ -130,7 +134,8 @@ struct AubFileStream : public AubStream {
     void writeGTT(uint32_t offset, uint64_t entry) override;
     void writeMMIOImpl(uint32_t offset, uint32_t value) override;
     void registerPoll(uint32_t registerOffset, uint32_t mask, uint32_t value, bool pollNotEqual, uint32_t timeoutAction) override;
-    MOCKABLE_VIRTUAL bool isOpen() const { return fileHandle.is_open(); }
+    // A running writer thread implies an open file; don't query fileHandle while that thread writes to it
+    MOCKABLE_VIRTUAL bool isOpen() const { return asyncWriterThread.joinable() || fileHandle.is_open(); }
     MOCKABLE_VIRTUAL const std::string &getFileName() const { return fileName; }
     MOCKABLE_VIRTUAL void write(const char *data, size_t size);
     MOCKABLE_VIRTUAL void flush();
@@ -143,6 +148,25 @@ struct AubFileStream : public AubStream {
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+
+    // Optional background writer: records are appended to the fill buffer and
+    // a dedicated thread writes full buffers to the file in submission order.
+    // Only used when AUB capture goes through this stream (UseAubStream=0);
+    // captures done by aubstream's AubManager are written by aubstream itself.
+    void startAsyncWriter(size_t bufferSize);
+    void stopAsyncWriter();
+    void submitAsyncBuffer();
+    void waitForAsyncWriter();
+    void asyncWriterLoop();
+
+    std::vector<char> asyncFillBuffer;
+    std::vector<char> asyncWriteBuffer;
+    std::thread asyncWriterThread;
+    std::mutex asyncWriterMutex;
+    std::condition_variable asyncWriterCondition;
+    size_t asyncBufferSize = 0;
+    bool asyncWritePending = false;
+    bool asyncWriterStopRequested = false;
 };
 
 template <int addressingBits>
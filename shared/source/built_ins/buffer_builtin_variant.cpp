@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/built_ins/buffer_builtin_variant.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/hw_info.h"
+
+#include <algorithm>
+
+namespace NEO {
+namespace BufferBuiltinVariantHelper {
+
+BufferBuiltinVariant selectVariant(size_t sizeInBytes) {
+    if (debugManager.flags.EnableGridStrideBufferBuiltins.get() != 1) {
+        return BufferBuiltinVariant::split;
+    }
+
+    size_t threshold = defaultGridStrideThreshold;
+    if (debugManager.flags.BufferBuiltinGridStrideThreshold.get() != -1) {
+        threshold = static_cast<size_t>(debugManager.flags.BufferBuiltinGridStrideThreshold.get());
+    }
+    return (sizeInBytes >= threshold) ? BufferBuiltinVariant::gridStride : BufferBuiltinVariant::split;
+}
+
+size_t getGridStrideWorkItemsCount(size_t elementsCount, uint32_t simdSize, const HardwareInfo &hwInfo) {
+    const size_t deviceWorkItems = static_cast<size_t>(std::max(hwInfo.gtSystemInfo.ThreadCount, 1u)) * std::max(simdSize, 1u);
+    return std::min(elementsCount, deviceWorkItems);
+}
+
+} // namespace BufferBuiltinVariantHelper
+} // namespace NEO
@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+struct HardwareInfo;
+
+enum class BufferBuiltinVariant : int32_t {
+    split = 0,
+    gridStride = 1,
+};
+
+// Selects between the per-element buffer copy/fill builtins, which dispatch one work-item per element,
+// and grid-stride variants, which dispatch enough work-items to fill the device once and loop over the rest.
+namespace BufferBuiltinVariantHelper {
+inline constexpr size_t defaultGridStrideThreshold = MemoryConstants::megaByte;
+
+BufferBuiltinVariant selectVariant(size_t sizeInBytes);
+size_t getGridStrideWorkItemsCount(size_t elementsCount, uint32_t simdSize, const HardwareInfo &hwInfo);
+} // namespace BufferBuiltinVariantHelper
+
+} // namespace NEO
@@ -12,6 +12,7 @@
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
@@ -95,24 +96,111 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 
 extern const size_t dwordCountMax;
 
+AubFileStream::~AubFileStream() {
+    stopAsyncWriter();
+}
+
 void AubFileStream::open(const char *filePath) {
+    stopAsyncWriter();
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+
+    if (debugManager.flags.AUBDumpAsyncWriterBufferSizeInKb.get() > 0 && fileHandle.is_open()) {
+        startAsyncWriter(static_cast<size_t>(debugManager.flags.AUBDumpAsyncWriterBufferSizeInKb.get() * MemoryConstants::kiloByte));
+    }
 }
 
 void AubFileStream::close() {
+    stopAsyncWriter();
     fileHandle.close();
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
-    fileHandle.write(data, size);
+    if (!asyncWriterThread.joinable()) {
+        fileHandle.write(data, size);
+        return;
+    }
+
+    if (asyncFillBuffer.size() + size > asyncBufferSize) {
+        submitAsyncBuffer();
+    }
+    if (size > asyncBufferSize) {
+        waitForAsyncWriter();
+        fileHandle.write(data, size);
+        return;
+    }
+    asyncFillBuffer.insert(asyncFillBuffer.end(), data, data + size);
 }
 
 void AubFileStream::flush() {
+    if (asyncWriterThread.joinable()) {
+        submitAsyncBuffer();
+        waitForAsyncWriter();
+    }
     fileHandle.flush();
 }
 
+void AubFileStream::startAsyncWriter(size_t bufferSize) {
+    asyncBufferSize = bufferSize;
+    asyncFillBuffer.reserve(bufferSize);
+    asyncWriteBuffer.reserve(bufferSize);
+    asyncWritePending = false;
+    asyncWriterStopRequested = false;
+    asyncWriterThread = std::thread([this]() { asyncWriterLoop(); });
+}
+
+void AubFileStream::stopAsyncWriter() {
+    if (!asyncWriterThread.joinable()) {
+        return;
+    }
+    submitAsyncBuffer();
+    {
+        std::lock_guard<std::mutex> lock(asyncWriterMutex);
+        asyncWriterStopRequested = true;
+    }
+    asyncWriterCondition.notify_all();
+    asyncWriterThread.join();
+
+    asyncFillBuffer = {};
+    asyncWriteBuffer = {};
+    asyncBufferSize = 0;
+}
+
+void AubFileStream::submitAsyncBuffer() {
+    if (asyncFillBuffer.empty()) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(asyncWriterMutex);
+        asyncWriterCondition.wait(lock, [this]() { return !asyncWritePending; });
+        asyncFillBuffer.swap(asyncWriteBuffer);
+        asyncWritePending = true;
+    }
+    asyncWriterCondition.notify_all();
+    asyncFillBuffer.clear();
+}
+
+void AubFileStream::waitForAsyncWriter() {
+    std::unique_lock<std::mutex> lock(asyncWriterMutex);
+    asyncWriterCondition.wait(lock, [this]() { return !asyncWritePending; });
+}
+
+void AubFileStream::asyncWriterLoop() {
+    std::unique_lock<std::mutex> lock(asyncWriterMutex);
+    while (true) {
+        asyncWriterCondition.wait(lock, [this]() { return asyncWritePending || asyncWriterStopRequested; });
+        if (!asyncWritePending) {
+            return;
+        }
+        lock.unlock();
+        fileHandle.write(asyncWriteBuffer.data(), asyncWriteBuffer.size());
+        lock.lock();
+        asyncWritePending = false;
+        asyncWriterCondition.notify_all();
+    }
+}
+
 bool AubFileStream::init(uint32_t stepping, uint32_t device) {
     CmdServicesMemTraceVersion header = {};
 
@@ -76,6 +76,9 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
         indirectHeap[i] = nullptr;
     }
     internalAllocationStorage = std::make_unique<InternalAllocationStorage>(*this);
+    if (debugManager.flags.EnableAdaptiveWaitPolicy.get() == 1) {
+        adaptiveWaitPolicy = std::make_unique<AdaptiveWaitPolicy>();
+    }
     const auto &hwInfo = peekHwInfo();
     uint32_t subDeviceCount = static_cast<uint32_t>(deviceBitfield.count());
     auto &gfxCoreHelper = getGfxCoreHelper();
@@ -103,6 +106,21 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
 }
 
 CommandStreamReceiver::~CommandStreamReceiver() {
+    PRINT_DEBUG_STRING(debugManager.flags.PrintCsrSubmissionStatistics.get() == 1, stdout,
+                       "CSR %p: flushed tasks: %llu, submissions: %llu\n", this,
+                       static_cast<unsigned long long>(submissionStatistics.flushedTasks),
+                       static_cast<unsigned long long>(submissionStatistics.submissions));
+    if (adaptiveWaitPolicy && debugManager.flags.PrintAdaptiveWaitStatistics.get() == 1) {
+        auto counters = adaptiveWaitPolicy->getCounters();
+        PRINT_DEBUG_STRING(true, stdout,
+                           "CSR %p: adaptive waits spin: %llu, monitor wait: %llu, kmd wait: %llu, busy poll time: %llu us, wall time: %llu us\n", this,
+                           static_cast<unsigned long long>(counters.waitsPerMode[static_cast<uint32_t>(AdaptiveWaitMode::spin)]),
+                           static_cast<unsigned long long>(counters.waitsPerMode[static_cast<uint32_t>(AdaptiveWaitMode::monitorWait)]),
+                           static_cast<unsigned long long>(counters.waitsPerMode[static_cast<uint32_t>(AdaptiveWaitMode::kmdWait)]),
+                           static_cast<unsigned long long>(counters.busyPollTimeMicroseconds),
+                           static_cast<unsigned long long>(counters.wallTimeMicroseconds));
+    }
+
     if (userPauseConfirmation) {
         {
             std::unique_lock<SpinLock> lock{debugPauseStateLock};
@@ -502,7 +520,7 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
         while (*partitionAddress < taskCountToWait && timeDiff <= params.waitTimeout) {
             this->downloadTagAllocation(taskCountToWait);
 
-            if (!params.indefinitelyPoll && WaitUtils::waitFunction(partitionAddress, taskCountToWait)) {
+            if (!params.indefinitelyPoll && WaitUtils::waitFunction(partitionAddress, taskCountToWait, params.allowMonitorWait)) {
                 break;
             }
 
@@ -10,6 +10,7 @@
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/command_stream/stream_properties.h"
 #include "shared/source/gmm_helper/cache_settings_helper.h"
+#include "shared/source/helpers/adaptive_wait_policy.h"
 #include "shared/source/helpers/blit_properties_container.h"
 #include "shared/source/helpers/cache_policy.h"
 #include "shared/source/helpers/common_types.h"
@@ -181,6 +182,12 @@ class CommandStreamReceiver {
     bool isNTo1SubmissionModelEnabled() const { return this->nTo1SubmissionModelEnabled; }
     void overrideDispatchPolicy(DispatchMode overrideValue) { this->dispatchMode = overrideValue; }
 
+    struct SubmissionStatistics {
+        uint64_t flushedTasks = 0u;
+        uint64_t submissions = 0u;
+    };
+    const SubmissionStatistics &peekSubmissionStatistics() const { return submissionStatistics; }
+
     void setMediaVFEStateDirty(bool dirty) { mediaVfeStateDirty = dirty; }
     bool getMediaVFEStateDirty() const { return mediaVfeStateDirty; }
 
@@ -528,6 +535,8 @@ class CommandStreamReceiver {
         return this->resourcesInitialized;
     }
 
+    const AdaptiveWaitPolicy *getAdaptiveWaitPolicy() const { return adaptiveWaitPolicy.get(); }
+
     MOCKABLE_VIRTUAL bool getAcLineConnected(bool updateStatus) const {
         if (updateStatus) {
             this->kmdNotifyHelper->updateAcLineStatus();
@@ -569,6 +578,7 @@ class CommandStreamReceiver {
     std::atomic<uint32_t> requestedPreallocationsAmount{0};
 
     std::unique_ptr<KmdNotifyHelper> kmdNotifyHelper;
+    std::unique_ptr<AdaptiveWaitPolicy> adaptiveWaitPolicy;
     std::unique_ptr<ScratchSpaceController> scratchSpaceController;
     std::unique_ptr<TagAllocatorBase> profilingTimeStampAllocator;
     std::unique_ptr<TagAllocatorBase> perfCounterAllocator;
@@ -629,6 +639,7 @@ class CommandStreamReceiver {
     std::atomic<uint32_t> numClients = 0u;
 
     DispatchMode dispatchMode = DispatchMode::immediateDispatch;
+    SubmissionStatistics submissionStatistics;
     SamplerCacheFlushState samplerCacheFlushRequired = SamplerCacheFlushState::samplerCacheFlushNotRequired;
     PreemptionMode lastPreemptionMode = PreemptionMode::Initial;
     bool csrSurfaceProgrammingDone = false;
@@ -394,6 +394,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     DEBUG_BREAK_IF(taskLevel >= CompletionStamp::notReady);
 
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "taskLevel", taskLevel);
+    submissionStatistics.flushedTasks++;
 
     auto levelClosed = false;
     bool implicitFlush = dispatchFlags.implicitFlush || dispatchFlags.blocking || debugManager.flags.ForceImplicitFlush.get();
@@ -703,6 +704,7 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
 
             primaryCmdBuffer->batchBuffer.endCmdPtr = currentBBendLocation;
 
+            submissionStatistics.submissions++;
             if (this->flush(primaryCmdBuffer->batchBuffer, surfacesForSubmit) != SubmissionStatus::success) {
                 submitResult = false;
                 break;
@@ -819,16 +821,37 @@ inline size_t CommandStreamReceiverHw<GfxFamily>::getCmdSizeForPipelineSelect()
 
 template <typename GfxFamily>
 inline WaitStatus CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFallback(TaskCountType taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep, QueueThrottle throttle) {
-    const auto params = kmdNotifyHelper->obtainTimeoutParams(useQuickKmdSleep, *getTagAddress(), taskCountToWait, flushStampToWait, throttle, this->isKmdWaitModeActive(),
-                                                             this->isAnyDirectSubmissionEnabled());
+    const auto currentHwTag = *getTagAddress();
+    auto params = kmdNotifyHelper->obtainTimeoutParams(useQuickKmdSleep, currentHwTag, taskCountToWait, flushStampToWait, throttle, this->isKmdWaitModeActive(),
+                                                       this->isAnyDirectSubmissionEnabled());
+
+    uint32_t adaptiveWaitBucket = 0;
+    auto adaptiveWaitMode = AdaptiveWaitMode::spin;
+    std::chrono::steady_clock::time_point waitStartTime, busyPollEndTime;
+    if (adaptiveWaitPolicy) {
+        adaptiveWaitBucket = AdaptiveWaitPolicy::getBucket(currentHwTag, taskCountToWait);
+        adaptiveWaitMode = adaptiveWaitPolicy->selectMode(adaptiveWaitBucket, flushStampToWait != 0);
+        adaptiveWaitPolicy->adjustWaitParams(adaptiveWaitMode, adaptiveWaitBucket, params);
+        waitStartTime = std::chrono::steady_clock::now();
+    }
 
     auto status = waitForCompletionWithTimeout(params, taskCountToWait);
+    if (adaptiveWaitPolicy) {
+        busyPollEndTime = std::chrono::steady_clock::now();
+    }
     if (status == WaitStatus::notReady) {
         waitForFlushStamp(flushStampToWait);
         // now call blocking wait, this is to ensure that task count is reached
         status = waitForCompletionWithTimeout(WaitParams{false, false, false, 0}, taskCountToWait);
     }
 
+    if (adaptiveWaitPolicy && status == WaitStatus::ready) {
+        auto waitEndTime = std::chrono::steady_clock::now();
+        auto latency = std::chrono::duration_cast<std::chrono::microseconds>(waitEndTime - waitStartTime).count();
+        auto busyPollTime = std::chrono::duration_cast<std::chrono::microseconds>(busyPollEndTime - waitStartTime).count();
+        adaptiveWaitPolicy->recordWait(adaptiveWaitBucket, adaptiveWaitMode, latency, busyPollTime);
+    }
+
     // If GPU hang occured, then propagate it to the caller.
     if (status == WaitStatus::gpuHang) {
         return status;
@@ -1125,6 +1148,7 @@ TaskCountType CommandStreamReceiverHw<GfxFamily>::flushBcsTask(const BlitPropert
 
     updateStreamTaskCount(commandStream, newTaskCount);
 
+    submissionStatistics.submissions++;
     auto flushSubmissionStatus = flush(batchBuffer, getResidencyAllocations());
     if (flushSubmissionStatus != SubmissionStatus::success) {
         updateStreamTaskCount(commandStream, taskCount);
@@ -1272,6 +1296,7 @@ SubmissionStatus CommandStreamReceiverHw<GfxFamily>::sendRenderStateCacheFlush()
 
 template <typename GfxFamily>
 inline SubmissionStatus CommandStreamReceiverHw<GfxFamily>::flushHandler(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) {
+    submissionStatistics.submissions++;
     auto status = flush(batchBuffer, allocationsForResidency);
     makeSurfacePackNonResident(allocationsForResidency, true);
     return status;
@@ -43,11 +43,13 @@ struct StateComputeModeProperties {
 
     bool isDirty() const;
     void clearIsDirty();
+    bool isSameState(const StateComputeModeProperties &other) const;
 
   protected:
     void clearIsDirtyExtraPerContext();
     void clearIsDirtyExtraPerKernel();
     bool isDirtyExtra() const;
+    bool isSameStateExtra(const StateComputeModeProperties &other) const;
     void resetStateExtra();
 
     void setPropertiesExtraPerContext();
@@ -91,6 +93,7 @@ struct FrontEndProperties {
 
     bool isDirty() const;
     void clearIsDirty();
+    bool isSameState(const FrontEndProperties &other) const;
 
   protected:
     FrontEndPropertiesSupport frontEndPropertiesSupport = {};
@@ -119,6 +122,7 @@ struct PipelineSelectProperties {
 
     bool isDirty() const;
     void clearIsDirty();
+    bool isSameState(const PipelineSelectProperties &other) const;
 
   protected:
     PipelineSelectPropertiesSupport pipelineSelectPropertiesSupport = {};
@@ -164,6 +168,7 @@ struct StateBaseAddressProperties {
 
     bool isDirty() const;
     void clearIsDirty();
+    bool isSameState(const StateBaseAddressProperties &other) const;
 
   protected:
     StateBaseAddressPropertiesSupport stateBaseAddressPropertiesSupport = {};
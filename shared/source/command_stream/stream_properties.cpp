@@ -97,6 +97,17 @@ void StateComputeModeProperties::clearIsDirty() {
     clearIsDirtyExtraPerKernel();
 }
 
+bool StateComputeModeProperties::isSameState(const StateComputeModeProperties &other) const {
+    return isCoherencyRequired == other.isCoherencyRequired &&
+           largeGrfMode == other.largeGrfMode &&
+           zPassAsyncComputeThreadLimit == other.zPassAsyncComputeThreadLimit &&
+           pixelAsyncComputeThreadLimit == other.pixelAsyncComputeThreadLimit &&
+           threadArbitrationPolicy == other.threadArbitrationPolicy &&
+           devicePreemptionMode == other.devicePreemptionMode &&
+           memoryAllocationForScratchAndMidthreadPreemptionBuffers == other.memoryAllocationForScratchAndMidthreadPreemptionBuffers &&
+           isSameStateExtra(other);
+}
+
 void StateComputeModeProperties::setCoherencyProperty(bool requiresCoherency) {
     if (this->scmPropertiesSupport.coherencyRequired) {
         int32_t isCoherencyRequired = (requiresCoherency ? 1 : 0);
@@ -297,6 +308,13 @@ void FrontEndProperties::clearIsDirty() {
     computeDispatchAllWalkerEnable.isDirty = false;
 }
 
+bool FrontEndProperties::isSameState(const FrontEndProperties &other) const {
+    return computeDispatchAllWalkerEnable == other.computeDispatchAllWalkerEnable &&
+           disableEUFusion == other.disableEUFusion &&
+           disableOverdispatch == other.disableOverdispatch &&
+           singleSliceDispatchCcsMode == other.singleSliceDispatchCcsMode;
+}
+
 void PipelineSelectProperties::initSupport(const RootDeviceEnvironment &rootDeviceEnvironment) {
     auto &productHelper = rootDeviceEnvironment.getHelper<ProductHelper>();
     productHelper.fillPipelineSelectPropertiesSupportStructure(this->pipelineSelectPropertiesSupport, *rootDeviceEnvironment.getHardwareInfo());
@@ -379,6 +397,12 @@ void PipelineSelectProperties::clearIsDirty() {
     systolicMode.isDirty = false;
 }
 
+bool PipelineSelectProperties::isSameState(const PipelineSelectProperties &other) const {
+    return modeSelected == other.modeSelected &&
+           mediaSamplerDopClockGate == other.mediaSamplerDopClockGate &&
+           systolicMode == other.systolicMode;
+}
+
 void StateBaseAddressProperties::initSupport(const RootDeviceEnvironment &rootDeviceEnvironment) {
     auto &productHelper = rootDeviceEnvironment.getHelper<ProductHelper>();
     productHelper.fillStateBaseAddressPropertiesSupportStructure(this->stateBaseAddressPropertiesSupport);
@@ -535,3 +559,15 @@ void StateBaseAddressProperties::clearIsDirty() {
     dynamicStateBaseAddress.isDirty = false;
     indirectObjectBaseAddress.isDirty = false;
 }
+
+bool StateBaseAddressProperties::isSameState(const StateBaseAddressProperties &other) const {
+    return bindingTablePoolBaseAddress == other.bindingTablePoolBaseAddress &&
+           surfaceStateBaseAddress == other.surfaceStateBaseAddress &&
+           dynamicStateBaseAddress == other.dynamicStateBaseAddress &&
+           indirectObjectBaseAddress == other.indirectObjectBaseAddress &&
+           bindingTablePoolSize == other.bindingTablePoolSize &&
+           surfaceStateSize == other.surfaceStateSize &&
+           dynamicStateSize == other.dynamicStateSize &&
+           indirectObjectSize == other.indirectObjectSize &&
+           statelessMocs == other.statelessMocs;
+}
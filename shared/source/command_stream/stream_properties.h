@@ -29,6 +29,12 @@ struct StreamProperties {
         pipelineSelect.resetState();
         stateBaseAddress.resetState();
     }
+    bool isSameState(const StreamProperties &other) const {
+        return stateComputeMode.isSameState(other.stateComputeMode) &&
+               frontEndState.isSameState(other.frontEndState) &&
+               pipelineSelect.isSameState(other.pipelineSelect) &&
+               stateBaseAddress.isSameState(other.stateBaseAddress);
+    }
 };
 
 } // namespace NEO
@@ -21,6 +21,10 @@ bool StateComputeModeProperties::isDirtyExtra() const {
     return false;
 }
 
+bool StateComputeModeProperties::isSameStateExtra(const StateComputeModeProperties &other) const {
+    return true;
+}
+
 void StateComputeModeProperties::clearIsDirtyExtraPerContext() {
 }
 void StateComputeModeProperties::clearIsDirtyExtraPerKernel() {
@@ -30,6 +30,12 @@ struct StreamPropertyType {
             }
         }
     }
+    bool operator==(const StreamPropertyType &other) const {
+        return (value == other.value) && (isDirty == other.isDirty);
+    }
+    bool operator!=(const StreamPropertyType &other) const {
+        return !(*this == other);
+    }
 };
 
 using StreamProperty32 = StreamPropertyType<int32_t, true>;
@@ -17,6 +17,7 @@
 namespace NEO {
 
 class AubSubCaptureManager;
+class TbxPageHashStore;
 class TbxStream;
 
 template <typename GfxFamily>
@@ -93,6 +94,8 @@ class TbxCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
     AddressMapper gttRemap;
 
     std::set<GraphicsAllocation *> allocationsForDownload = {};
+    // shared by all receivers of the root device, used to skip uploading unchanged pages
+    TbxPageHashStore *pageHashStore = nullptr;
 
     CommandStreamReceiverType getType() const override {
         return CommandStreamReceiverType::tbx;
@@ -49,6 +49,7 @@ TbxCommandStreamReceiverHw<GfxFamily>::TbxCommandStreamReceiverHw(ExecutionEnvir
     UNRECOVERABLE_IF(nullptr == aubCenter);
 
     aubManager = aubCenter->getAubManager();
+    pageHashStore = aubCenter->getTbxPageHashStore();
 
     ppgtt = std::make_unique<std::conditional<is64bit, PML4, PDPE>::type>(physicalAddressAllocator.get());
     ggtt = std::make_unique<PDPE>(physicalAddressAllocator.get());
@@ -446,15 +447,25 @@ bool TbxCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
         return false;
     }
 
-    if (aubManager) {
-        this->writeMemoryWithAubManager(gfxAllocation, isChunkCopy, gpuVaChunkOffset, chunkSize);
+    auto writeRange = [&](bool isChunk, uint64_t offset, size_t rangeSize) {
+        if (aubManager) {
+            this->writeMemoryWithAubManager(gfxAllocation, isChunk, offset, rangeSize);
+        } else if (isChunk) {
+            writeMemory(gpuAddress + offset, ptrOffset(cpuAddress, static_cast<uintptr_t>(offset)), rangeSize, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        } else {
+            writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        }
+    };
+
+    if (debugManager.flags.EnableTbxDirtyPageTracking.get() != 1) {
+        writeRange(isChunkCopy, gpuVaChunkOffset, chunkSize);
+    } else if (isChunkCopy) {
+        writeRange(true, gpuVaChunkOffset, chunkSize);
+        pageHashStore->remove(gfxAllocation);
     } else {
-        if (isChunkCopy) {
-            gpuAddress += gpuVaChunkOffset;
-            cpuAddress = ptrOffset(cpuAddress, static_cast<uintptr_t>(gpuVaChunkOffset));
-            size = chunkSize;
+        for (const auto &[offset, rangeSize] : pageHashStore->updateForUpload(gfxAllocation, *this, cpuAddress, size)) {
+            writeRange(rangeSize != size, offset, rangeSize);
         }
-        writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
     }
 
     if (AubHelper::isOneTimeAubWritableAllocationType(gfxAllocation.getAllocationType())) {
@@ -563,16 +574,17 @@ void TbxCommandStreamReceiverHw<GfxFamily>::downloadAllocationTbx(GraphicsAlloca
     if (hardwareContextController) {
         hardwareContextController->readMemory(gpuAddress, cpuAddress, size,
                                               this->getMemoryBank(&gfxAllocation), gfxAllocation.getUsedPageSize());
-        return;
-    }
-
-    if (size) {
+    } else if (size) {
         PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
             DEBUG_BREAK_IF(offset > size);
             tbxStream.readMemory(physAddress, ptrOffset(cpuAddress, offset), size);
         };
         ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), size, 0, 0, walker, this->getMemoryBank(&gfxAllocation));
     }
+
+    if (size) {
+        pageHashStore->updateForDownload(gfxAllocation, *this, cpuAddress, size);
+    }
 }
 
 template <typename GfxFamily>
@@ -673,5 +685,6 @@ template <typename GfxFamily>
 void TbxCommandStreamReceiverHw<GfxFamily>::removeDownloadAllocation(GraphicsAllocation *alloc) {
     auto lockCSR = this->obtainUniqueOwnership();
     this->allocationsForDownload.erase(alloc);
+    this->pageHashStore->remove(*alloc);
 }
 } // namespace NEO
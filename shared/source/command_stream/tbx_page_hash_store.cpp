@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/tbx_page_hash_store.h"
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/ptr_math.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+std::vector<uint64_t> TbxPageHashStore::computePageHashes(const void *cpuAddress, size_t size) {
+    constexpr size_t pageSize = MemoryConstants::pageSize;
+    std::vector<uint64_t> pageHashes((size + pageSize - 1) / pageSize);
+    for (size_t page = 0; page < pageHashes.size(); page++) {
+        const size_t pageOffset = page * pageSize;
+        pageHashes[page] = Hash::hash(static_cast<const char *>(ptrOffset(cpuAddress, pageOffset)), std::min(pageSize, size - pageOffset));
+    }
+    return pageHashes;
+}
+
+TbxPageHashStore::ByteRanges TbxPageHashStore::updateForUpload(const GraphicsAllocation &allocation, const CommandStreamReceiver &csr, const void *cpuAddress, size_t size) {
+    constexpr size_t pageSize = MemoryConstants::pageSize;
+    auto pageHashes = computePageHashes(cpuAddress, size);
+
+    std::vector<uint64_t> previousHashes;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &entry = entries[&allocation];
+        if (entry.owner == &csr) {
+            previousHashes = std::move(entry.pageHashes);
+        }
+        entry.owner = &csr;
+        entry.pageHashes = pageHashes;
+    }
+
+    const bool allPagesDirty = previousHashes.size() != pageHashes.size();
+    ByteRanges dirtyRanges;
+    for (size_t page = 0; page < pageHashes.size(); page++) {
+        if (!allPagesDirty && pageHashes[page] == previousHashes[page]) {
+            continue;
+        }
+        const size_t pageOffset = page * pageSize;
+        const size_t bytesInPage = std::min(pageSize, size - pageOffset);
+        if (!dirtyRanges.empty() && dirtyRanges.back().first + dirtyRanges.back().second == pageOffset) {
+            dirtyRanges.back().second += bytesInPage;
+        } else {
+            dirtyRanges.emplace_back(pageOffset, bytesInPage);
+        }
+    }
+    return dirtyRanges;
+}
+
+void TbxPageHashStore::updateForDownload(const GraphicsAllocation &allocation, const CommandStreamReceiver &csr, const void *cpuAddress, size_t size) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (entries.find(&allocation) == entries.end()) {
+            return;
+        }
+    }
+
+    // host copy matches the simulator right after the read back
+    auto pageHashes = computePageHashes(cpuAddress, size);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(&allocation);
+    if (it != entries.end()) {
+        it->second.owner = &csr;
+        it->second.pageHashes = std::move(pageHashes);
+    }
+}
+
+void TbxPageHashStore::remove(const GraphicsAllocation &allocation) {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.erase(&allocation);
+}
+
+} // namespace NEO
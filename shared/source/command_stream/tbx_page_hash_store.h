@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+class CommandStreamReceiver;
+class GraphicsAllocation;
+
+// Content hash of every page of TBX allocations, shared by all command stream receivers
+// of a root device since they write the same simulator memory. Hashes are owned by the
+// receiver that last uploaded or downloaded the allocation; when a different receiver
+// touches it, the hashes are dropped and the whole allocation is treated as changed.
+class TbxPageHashStore {
+  public:
+    using ByteRanges = std::vector<std::pair<size_t, size_t>>;
+
+    ByteRanges updateForUpload(const GraphicsAllocation &allocation, const CommandStreamReceiver &csr, const void *cpuAddress, size_t size);
+    void updateForDownload(const GraphicsAllocation &allocation, const CommandStreamReceiver &csr, const void *cpuAddress, size_t size);
+    void remove(const GraphicsAllocation &allocation);
+
+  protected:
+    struct Entry {
+        const CommandStreamReceiver *owner = nullptr;
+        std::vector<uint64_t> pageHashes;
+    };
+
+    static std::vector<uint64_t> computePageHashes(const void *cpuAddress, size_t size);
+
+    std::unordered_map<const GraphicsAllocation *, Entry> entries;
+    std::mutex mutex;
+};
+
+} // namespace NEO
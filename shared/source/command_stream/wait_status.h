@@ -26,6 +26,7 @@ struct WaitParams {
     bool enableTimeout = false;
     bool skipTbxDownload = false;
     int64_t waitTimeout = 0;
+    bool allowMonitorWait = true;
 };
 
 } // namespace NEO
@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/compiler_interface/external_functions.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/zebin/zebin_elf.h"
 #include "shared/source/helpers/blit_commands_helper.h"
@@ -25,7 +26,12 @@
 
 #include "RelocationInfo.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 
 namespace NEO {
@@ -431,34 +437,103 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
 
     auto &relocationsPerSegment = data.getRelocationsInInstructionSegments();
     UNRECOVERABLE_IF(data.getRelocationsInInstructionSegments().size() > instructionsSegments.size());
-    for (size_t segId = 0U; segId < relocationsPerSegment.size(); segId++) {
-        auto &segment = instructionsSegments[segId];
-        for (const auto &relocation : relocationsPerSegment[segId]) {
-            UNRECOVERABLE_IF(nullptr == segment.hostPointer);
-            bool invalidRelocation = relocation.offset + addressSizeInBytes(relocation.type) > segment.segmentSize;
-            if (invalidRelocation) {
-                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
-                DEBUG_BREAK_IF(true);
-                continue;
+    const auto segmentsCount = static_cast<uint32_t>(relocationsPerSegment.size());
+
+    size_t relocationsCount = 0u;
+    for (uint32_t segId = 0U; segId < segmentsCount; segId++) {
+        UNRECOVERABLE_IF(false == relocationsPerSegment[segId].empty() && nullptr == instructionsSegments[segId].hostPointer);
+        relocationsCount += relocationsPerSegment[segId].size();
+    }
+
+    patchingWorkersCount = 1u;
+    if (debugManager.flags.EnableParallelInstructionSegmentsPatching.get() == 1) {
+        // Spawning threads only pays off when every worker gets enough relocations to patch
+        auto maxWorkersCount = maxPatchingWorkersCount != 0u ? maxPatchingWorkersCount : std::max(1u, std::thread::hardware_concurrency());
+        auto workersForRelocations = static_cast<uint32_t>(std::min(relocationsCount / std::max(size_t{1u}, minRelocationsPerPatchingWorker), size_t{segmentsCount}));
+        patchingWorkersCount = std::max(1u, std::min(maxWorkersCount, workersForRelocations));
+    }
+
+    if (patchingWorkersCount == 1u) {
+        for (uint32_t segId = 0U; segId < segmentsCount; segId++) {
+            StackVec<uint32_t *, 2> implicitArgsRelocationAddresses;
+            patchInstructionsSegment(segId, instructionsSegments[segId], relocationsPerSegment[segId], kernelDescriptors, outUnresolvedExternals, implicitArgsRelocationAddresses);
+            if (false == implicitArgsRelocationAddresses.empty()) {
+                pImplicitArgsRelocationAddresses[segId] = std::move(implicitArgsRelocationAddresses);
             }
+        }
+        return;
+    }
+
+    // Instruction segments don't overlap, so each one is patched independently.
+    // Per-segment results are gathered afterwards in segment order.
+    std::vector<UnresolvedExternals> unresolvedExternalsPerSegment(segmentsCount);
+    std::vector<StackVec<uint32_t *, 2>> implicitArgsRelocationAddressesPerSegment(segmentsCount);
+    std::atomic<uint32_t> nextSegId{0u};
+    std::mutex workerExceptionMutex;
+    std::exception_ptr workerException;
+    auto patchWorker = [&]() {
+        try {
+            for (uint32_t segId = nextSegId++; segId < segmentsCount; segId = nextSegId++) {
+                patchInstructionsSegment(segId, instructionsSegments[segId], relocationsPerSegment[segId], kernelDescriptors,
+                                         unresolvedExternalsPerSegment[segId], implicitArgsRelocationAddressesPerSegment[segId]);
+            }
+        } catch (...) {
+            // Stop remaining work and rethrow on the calling thread instead of terminating the process
+            nextSegId.store(segmentsCount);
+            std::lock_guard<std::mutex> lock(workerExceptionMutex);
+            if (!workerException) {
+                workerException = std::current_exception();
+            }
+        }
+    };
 
-            auto relocAddress = ptrOffset(segment.hostPointer, static_cast<uintptr_t>(relocation.offset));
-            if (relocation.type == LinkerInput::RelocationInfo::Type::perThreadPayloadOffset) {
-                uint32_t crossThreadDataSize = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize - kernelDescriptors.at(segId)->kernelAttributes.inlineDataPayloadSize;
-                *reinterpret_cast<uint32_t *>(relocAddress) = crossThreadDataSize;
-            } else if (relocation.symbolName == implicitArgsRelocationSymbolName) {
-                pImplicitArgsRelocationAddresses[static_cast<uint32_t>(segId)].push_back(reinterpret_cast<uint32_t *>(relocAddress));
-            } else if (relocation.symbolName.empty()) {
-                uint64_t patchValue = 0;
+    std::vector<std::thread> workers;
+    workers.reserve(patchingWorkersCount - 1);
+    for (uint32_t i = 1u; i < patchingWorkersCount; i++) {
+        workers.emplace_back(patchWorker);
+    }
+    patchWorker();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    if (workerException) {
+        std::rethrow_exception(workerException);
+    }
+
+    for (uint32_t segId = 0U; segId < segmentsCount; segId++) {
+        outUnresolvedExternals.insert(outUnresolvedExternals.end(), unresolvedExternalsPerSegment[segId].begin(), unresolvedExternalsPerSegment[segId].end());
+        if (false == implicitArgsRelocationAddressesPerSegment[segId].empty()) {
+            pImplicitArgsRelocationAddresses[segId] = std::move(implicitArgsRelocationAddressesPerSegment[segId]);
+        }
+    }
+}
+
+void Linker::patchInstructionsSegment(uint32_t segId, const PatchableSegment &segment, const LinkerInput::Relocations &relocations, const KernelDescriptorsT &kernelDescriptors,
+                                      std::vector<UnresolvedExternal> &outUnresolvedExternals, StackVec<uint32_t *, 2> &outImplicitArgsRelocationAddresses) const {
+    for (const auto &relocation : relocations) {
+        bool invalidRelocation = relocation.offset + addressSizeInBytes(relocation.type) > segment.segmentSize;
+        if (invalidRelocation) {
+            outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidRelocation});
+            DEBUG_BREAK_IF(true);
+            continue;
+        }
+
+        auto relocAddress = ptrOffset(segment.hostPointer, static_cast<uintptr_t>(relocation.offset));
+        if (relocation.type == LinkerInput::RelocationInfo::Type::perThreadPayloadOffset) {
+            uint32_t crossThreadDataSize = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize - kernelDescriptors.at(segId)->kernelAttributes.inlineDataPayloadSize;
+            *reinterpret_cast<uint32_t *>(relocAddress) = crossThreadDataSize;
+        } else if (relocation.symbolName == implicitArgsRelocationSymbolName) {
+            outImplicitArgsRelocationAddresses.push_back(reinterpret_cast<uint32_t *>(relocAddress));
+        } else if (relocation.symbolName.empty()) {
+            uint64_t patchValue = 0;
+            patchAddress(relocAddress, patchValue, relocation);
+        } else {
+            auto symbolIt = relocatedSymbols.find(relocation.symbolName);
+            if (symbolIt != relocatedSymbols.end()) {
+                uint64_t patchValue = symbolIt->second.gpuAddress + relocation.addend;
                 patchAddress(relocAddress, patchValue, relocation);
             } else {
-                auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-                if (symbolIt != relocatedSymbols.end()) {
-                    uint64_t patchValue = symbolIt->second.gpuAddress + relocation.addend;
-                    patchAddress(relocAddress, patchValue, relocation);
-                } else {
-                    outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
-                }
+                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidRelocation});
             }
         }
     }
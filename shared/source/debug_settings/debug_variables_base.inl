@@ -369,8 +369,13 @@ DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForIdleGpu, -1, "-1: platfor
 DECLARE_DEBUG_VARIABLE(int32_t, EventWaitOnHost, -1, "Wait for events on host instead of program semaphores for them, works for append kernel launch with immediate command list, -1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCacheFlushAfterWalkerForAllQueues, -1, "Enable cache flush after walker even if queue doesn't require it")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideUseKmdWaitFunction, -1, "-1: default (L0: disabled), 0: disabled, 1: enabled. It uses only busy loop to wait or busy loop with KMD wait function, when KMD fallback is enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCommandQueueExecutionPlanCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, L0 command queue reuses state walk results when the same closed command lists are executed again on unchanged csr state")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableImmediateCmdListFlushCoalescing, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, asynchronous in-order immediate command lists defer flushing kernel appends without signal event and submit them together")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListFlushCoalescingMaxAppends, -1, "-1: default (16), >0: maximal number of kernel appends deferred by immediate command list before flushing them")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListFlushCoalescingTimeoutUs, -1, "-1: default (100), >0: time in microseconds after which deferred kernel appends are flushed on next append or by background thread, other values fall back to default")
 DECLARE_DEBUG_VARIABLE(int32_t, ResolveDependenciesViaPipeControls, -1, "-1: default , 0: disabled, 1: enabled. If enabled, instead of programming semaphores, dependencies are resolved using task levels")
 DECLARE_DEBUG_VARIABLE(int32_t, MakeIndirectAllocationsResidentAsPack, -1, "-1: default, 0:disabled, 1: enabled. If enabled, driver handles all indirect allocations as one pack instead of making them resident individually.")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIndirectAllocationsResidencySnapshot, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, indirect allocations made resident individually are taken from snapshot updated only with allocations created or freed since last submission")
 DECLARE_DEBUG_VARIABLE(int32_t, DetectIndirectAccessInKernel, -1, "-1: default, 0:disabled, 1: enabled. If enabled and indirect accesses are not detected in kernel, indirect allocations will not be allowed even if set by API.")
 DECLARE_DEBUG_VARIABLE(int32_t, MakeEachAllocationResident, -1, "-1: default, 0: disabled, 1: bind every allocation at creation time, 2: bind all created allocations in flush")
 DECLARE_DEBUG_VARIABLE(int32_t, AssignBCSAtEnqueue, -1, "-1: default, 0:disabled, 1: enabled.")
@@ -487,6 +492,27 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleepForSporadicWaits, -1,
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDelayQuickKmdSleepForSporadicWaitsMicroseconds, -1, "-1: don't override, >0: timeout in microseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleepForDirectSubmission, -1, "-1: don't override, 0: disable, 1: enable. It works only when QuickKmdSleep is enabled.")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDelayQuickKmdSleepForDirectSubmissionMicroseconds, -1, "-1: don't override, >0: timeout in microseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAdaptiveWaitPolicy, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, CSR chooses between spinning, umwait and KMD wait based on completion latency observed in previous waits")
+DECLARE_DEBUG_VARIABLE(int32_t, PrintAdaptiveWaitStatistics, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, each command stream receiver with EnableAdaptiveWaitPolicy prints number of waits per wait mode, busy poll time and wall time spent waiting when destroyed")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableEventPoolSlabAllocator, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, small event pools are suballocated from driver-wide slabs instead of getting own allocation")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableGridStrideBufferBuiltins, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, buffer copy and fill builtins use grid-stride kernels for sizes above BufferBuiltinGridStrideThreshold")
+DECLARE_DEBUG_VARIABLE(int32_t, BufferBuiltinGridStrideThreshold, -1, "-1: default (1MB), >=0: size in bytes starting from which buffer copy and fill use grid-stride builtin kernels, 0 selects them for all sizes")
+DECLARE_DEBUG_VARIABLE(int32_t, PrefetchBuiltinsInBackground, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, L0 builtin kernels needed by the device are created on background threads during device initialization")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSharedBlockedEnqueueHeaps, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, blocked OpenCL enqueues program their DSH/IOH/SSH in place into heaps shared by consecutive blocked commands of a queue instead of allocating separate heaps per command")
+DECLARE_DEBUG_VARIABLE(int32_t, PrintCsrSubmissionStatistics, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, each command stream receiver prints number of flushed tasks and hardware submissions when destroyed")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalWorkSizeCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, OpenCL kernels cache local work sizes computed for enqueues with NULL local work size")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanFdCacheSize, -1, "-1: default (10), >0: number of sysfs file descriptors kept open by sysman for repeated telemetry reads")
+DECLARE_DEBUG_VARIABLE(int32_t, PmtTelemetrySampleStaleness, -1, "-1: default (disabled), >=0: PMT telemetry keys are decoded from a single bulk read of telemetry region, which is reused for given number of milliseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, EnablePersistentSysmanEventMonitor, -1, "-1: default (disabled), 0: disabled, 1: udev monitor and wakeup pipe used by sysman event listen are created once and kept for subsequent listen calls")
+DECLARE_DEBUG_VARIABLE(int32_t, IpSamplingDecodeThreadCount, -1, "-1: default (1), >1: number of threads raw IP sampling reports are split across when calculating metric values")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableMetricExportMetadataCache, -1, "-1: default (disabled), 0: disabled, 1: OA metric group export metadata (header and heap, without adapter params and raw data) is generated once and reused by following zetMetricGroupGetExportDataExp calls")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableParallelInstructionSegmentsPatching, -1, "-1: default (disabled), 0: disabled, 1: linker patches relocations of different instruction segments on separate threads")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableTbxDirtyPageTracking, -1, "-1: default (disabled), 0: disabled, 1: hash allocation pages and upload only pages changed since the last upload or download")
+DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpAsyncWriterBufferSizeInKb, -1, "-1: default (disabled), 0: disabled, >0: AUB file records are collected in two buffers of given size in KB and written to the file by a background thread. Applies only to the legacy AUB file stream (UseAubStream=0), aubstream captures are not affected")
+DECLARE_DEBUG_VARIABLE(int32_t, TbxSocketsWriteBufferSizeInKb, -1, "-1: default (disabled), 0: disabled, >0: TBX memory and GTT writes are coalesced in a buffer of given size in KB and sent before the next read, MMIO write or when the buffer is full")
+DECLARE_DEBUG_VARIABLE(int32_t, ApiLatencyHistogramSamplingRate, -1, "-1: default (disabled), 0: disabled, >0: record host latency of every n-th call of selected L0 and OpenCL API entry points on each thread, histograms can be queried with zexDriverGetApiLatencyHistogram")
+DECLARE_DEBUG_VARIABLE(int32_t, ApiLatencyHistogramDumpIntervalMs, -1, "-1: default (print API latency percentiles at process exit), 0: do not print, >0: additionally print them every given number of milliseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, KernelLaunchStatePoolSize, -1, "-1: default (8), >0: maximal number of launch states created per kernel for zexCommandListAppendLaunchKernelWithArguments, further concurrent launches of the kernel wait for a launch state to be released")
 DECLARE_DEBUG_VARIABLE(int32_t, PowerSavingMode, 0, "0: default 1: enable. Whenever driver waits on GPU and its not ready, put waiting thread to sleep and wait for notification.")
 DECLARE_DEBUG_VARIABLE(int32_t, CsrDispatchMode, 0, "Chooses DispatchMode for Csr")
 DECLARE_DEBUG_VARIABLE(int32_t, RenderCompressedImagesEnabled, -1, "-1: default, 0: disabled, 1: enabled")
@@ -15,3 +15,4 @@ DECLARE_DEBUG_VARIABLE(bool, NEO_CAL_ENABLED, false, "Set by the Compute Aggrega
 DECLARE_DEBUG_VARIABLE(std::string, ZE_AFFINITY_MASK, std::string("default"), "Refer to the Level Zero Specification for a description")
 DECLARE_DEBUG_VARIABLE(std::string, ZEX_NUMBER_OF_CCS, std::string("default"), "Define number of CCS engines per root device, e.g. setting Root Device Index 0 to 4 CCS, and Root Device Index 1 To 1 CCS: ZEX_NUMBER_OF_CCS=0:4,1:1")
 DECLARE_DEBUG_VARIABLE(bool, ZE_ENABLE_PCI_ID_DEVICE_ORDER, false, "Refer to the Level Zero Specification for a description")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableInOrderQueueBatching, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, creating an in-order OpenCL command queue switches its command stream receiver to batched dispatch, submissions are then flushed on clFlush, clFinish, blocking calls, waits and event status queries. CsrDispatchMode takes precedence")
@@ -28,6 +28,7 @@ class ExecutionEnvironment;
 class Debugger;
 class GmmClientContext;
 class GmmHelper;
+class LocalIdsCache;
 class SyncBufferHandler;
 enum class EngineGroupType : uint32_t;
 class DebuggerL0;
@@ -194,6 +195,9 @@ class Device : public ReferenceTrackedObject<Device> {
     ISAPoolAllocator &getIsaPoolAllocator() {
         return isaPoolAllocator;
     }
+    LocalIdsCache &getLocalIdsCache() const {
+        return *localIdsCache;
+    }
     MOCKABLE_VIRTUAL void stopDirectSubmissionAndWaitForCompletion();
     bool isAnyDirectSubmissionEnabled();
     bool isStateSipRequired() const {
@@ -289,6 +293,7 @@ class Device : public ReferenceTrackedObject<Device> {
     std::vector<RTDispatchGlobalsInfo *> rtDispatchGlobalsInfos;
 
     ISAPoolAllocator isaPoolAllocator;
+    std::unique_ptr<LocalIdsCache> localIdsCache;
 
     struct {
         bool isValid = false;
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/adaptive_wait_policy.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+uint32_t AdaptiveWaitPolicy::getBucket(TagAddressType currentHwTag, TaskCountType taskCountToWait) {
+    if (taskCountToWait <= currentHwTag + 1) {
+        return 0u;
+    }
+    auto outstanding = taskCountToWait - currentHwTag;
+    if (outstanding < 4) {
+        return 1u;
+    }
+    if (outstanding < 8) {
+        return 2u;
+    }
+    return 3u;
+}
+
+AdaptiveWaitMode AdaptiveWaitPolicy::selectMode(uint32_t bucket, bool kmdWaitAvailable) const {
+    auto predictedLatency = getPredictedLatency(bucket);
+    if (!hasSamples(bucket) || predictedLatency <= spinLatencyThresholdMicroseconds) {
+        return AdaptiveWaitMode::spin;
+    }
+    if (predictedLatency <= monitorWaitLatencyThresholdMicroseconds || !kmdWaitAvailable) {
+        return AdaptiveWaitMode::monitorWait;
+    }
+    return AdaptiveWaitMode::kmdWait;
+}
+
+void AdaptiveWaitPolicy::adjustWaitParams(AdaptiveWaitMode mode, uint32_t bucket, WaitParams &params) const {
+    params.allowMonitorWait = (mode != AdaptiveWaitMode::spin);
+
+    if (mode == AdaptiveWaitMode::kmdWait) {
+        // poll once and go straight to KMD wait, also when KMD notify did not enable the timeout
+        params.indefinitelyPoll = false;
+        params.enableTimeout = true;
+        params.waitTimeout = 0;
+        return;
+    }
+
+    if (!params.enableTimeout || !hasSamples(bucket)) {
+        return;
+    }
+
+    auto predictedLatency = getPredictedLatency(bucket);
+    switch (mode) {
+    case AdaptiveWaitMode::spin:
+        params.waitTimeout = std::max(params.waitTimeout, 4 * spinLatencyThresholdMicroseconds);
+        break;
+    case AdaptiveWaitMode::monitorWait:
+        params.waitTimeout = std::max(params.waitTimeout, 2 * predictedLatency);
+        break;
+    default:
+        break;
+    }
+}
+
+void AdaptiveWaitPolicy::recordWait(uint32_t bucket, AdaptiveWaitMode mode, int64_t latencyMicroseconds, int64_t busyPollTimeMicroseconds) {
+    latencyMicroseconds = std::max(latencyMicroseconds, int64_t{0});
+    busyPollTimeMicroseconds = std::clamp(busyPollTimeMicroseconds, int64_t{0}, latencyMicroseconds);
+
+    if (samplesCount[bucket].fetch_add(1, std::memory_order_relaxed) == 0) {
+        latencyEwma[bucket].store(latencyMicroseconds, std::memory_order_relaxed);
+    } else {
+        auto previous = latencyEwma[bucket].load(std::memory_order_relaxed);
+        latencyEwma[bucket].store(previous + ((latencyMicroseconds - previous) >> ewmaShift), std::memory_order_relaxed);
+    }
+
+    waitsPerMode[static_cast<uint32_t>(mode)].fetch_add(1, std::memory_order_relaxed);
+    this->busyPollTimeMicroseconds.fetch_add(static_cast<uint64_t>(busyPollTimeMicroseconds), std::memory_order_relaxed);
+    this->wallTimeMicroseconds.fetch_add(static_cast<uint64_t>(latencyMicroseconds), std::memory_order_relaxed);
+}
+
+AdaptiveWaitCounters AdaptiveWaitPolicy::getCounters() const {
+    AdaptiveWaitCounters counters;
+    for (uint32_t i = 0; i < counters.waitsPerMode.size(); i++) {
+        counters.waitsPerMode[i] = waitsPerMode[i].load(std::memory_order_relaxed);
+    }
+    counters.busyPollTimeMicroseconds = busyPollTimeMicroseconds.load(std::memory_order_relaxed);
+    counters.wallTimeMicroseconds = wallTimeMicroseconds.load(std::memory_order_relaxed);
+    return counters;
+}
+
+} // namespace NEO
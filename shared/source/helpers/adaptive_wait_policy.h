@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/command_stream/wait_status.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace NEO {
+
+enum class AdaptiveWaitMode : uint32_t {
+    spin = 0,
+    monitorWait,
+    kmdWait,
+    count
+};
+
+struct AdaptiveWaitCounters {
+    std::array<uint64_t, static_cast<uint32_t>(AdaptiveWaitMode::count)> waitsPerMode = {};
+    uint64_t busyPollTimeMicroseconds = 0;
+    uint64_t wallTimeMicroseconds = 0;
+};
+
+// Per-CSR wait policy learned from observed completion latencies.
+// Latency is tracked as an integer EWMA bucketed by the number of outstanding
+// task counts at the beginning of the wait. Short predicted latencies are spun on,
+// medium ones use umwait, long ones go to KMD wait right away. KMD wait needs a flush
+// stamp to wait on; without one long waits fall back to umwait polling instead.
+class AdaptiveWaitPolicy {
+  public:
+    static constexpr uint32_t bucketCount = 4u;
+    static constexpr uint32_t ewmaShift = 3u;
+    static constexpr int64_t spinLatencyThresholdMicroseconds = 20;
+    static constexpr int64_t monitorWaitLatencyThresholdMicroseconds = 500;
+
+    static uint32_t getBucket(TagAddressType currentHwTag, TaskCountType taskCountToWait);
+
+    AdaptiveWaitMode selectMode(uint32_t bucket, bool kmdWaitAvailable) const;
+    void adjustWaitParams(AdaptiveWaitMode mode, uint32_t bucket, WaitParams &params) const;
+    void recordWait(uint32_t bucket, AdaptiveWaitMode mode, int64_t latencyMicroseconds, int64_t busyPollTimeMicroseconds);
+
+    int64_t getPredictedLatency(uint32_t bucket) const { return latencyEwma[bucket].load(std::memory_order_relaxed); }
+    bool hasSamples(uint32_t bucket) const { return samplesCount[bucket].load(std::memory_order_relaxed) > 0; }
+    AdaptiveWaitCounters getCounters() const;
+
+  protected:
+    std::array<std::atomic<int64_t>, bucketCount> latencyEwma = {};
+    std::array<std::atomic<uint32_t>, bucketCount> samplesCount = {};
+    std::array<std::atomic<uint64_t>, static_cast<uint32_t>(AdaptiveWaitMode::count)> waitsPerMode = {};
+    std::atomic<uint64_t> busyPollTimeMicroseconds{0};
+    std::atomic<uint64_t> wallTimeMicroseconds{0};
+};
+
+} // namespace NEO
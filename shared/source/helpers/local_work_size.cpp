@@ -14,6 +14,7 @@
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/work_size_info.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 
@@ -89,6 +90,35 @@ inline uint32_t factor<0>(size_t workItems, uint32_t workSize, uint32_t maxWorkG
     return workSize;
 }
 
+constexpr uint32_t maxDivisorLimit = 1024u;
+
+// Collects divisors of value not greater than limit in ascending order.
+// Trial division only runs up to sqrt(value) and each hit also yields its
+// complementary divisor, so large global sizes cost at most sqrt(value) mod operations.
+uint32_t collectDivisors(size_t value, uint32_t limit, uint32_t divisors[1024]) {
+    DEBUG_BREAK_IF(limit > maxDivisorLimit);
+    uint32_t count = 0;
+    if (value == 0) {
+        for (uint32_t divisor = 1; divisor <= limit; divisor++) {
+            divisors[count++] = divisor;
+        }
+        return count;
+    }
+
+    for (size_t divisor = 1; divisor <= limit && divisor * divisor <= value; divisor++) {
+        if ((value % divisor) != 0) {
+            continue;
+        }
+        divisors[count++] = static_cast<uint32_t>(divisor);
+        auto complement = value / divisor;
+        if (complement != divisor && complement <= limit) {
+            divisors[count++] = static_cast<uint32_t>(complement);
+        }
+    }
+    std::sort(divisors, divisors + count);
+    return count;
+}
+
 void computePowerOfTwoLWS(const size_t workItems[3], WorkSizeInfo &workGroupInfo, size_t workGroupSize[3], const uint32_t workDim, bool canUseNx4) {
     uint32_t targetIndex = (canUseNx4 || workGroupInfo.numThreadsPerSubSlice < highThreadCountThreshold) ? 2 : 0;
     auto simdSize = workGroupInfo.simdSize;
@@ -248,12 +278,9 @@ void choosePrefferedWorkgroupSize(WorkSizeInfo &wsInfo, size_t workGroupSize[3],
     uint32_t xyzFactorsLen[3] = {};
     for (int i = 0; i < 3; i++)
         xyzFactors[i][xyzFactorsLen[i]++] = 1;
+    const uint32_t factorsLimit = std::max(wsInfo.maxWorkGroupSize, 2u) - 1;
     for (auto i = 0u; i < workDim; i++) {
-        for (auto j = 2u; j < wsInfo.maxWorkGroupSize; ++j) {
-            if ((workItems[i] % j) == 0) {
-                xyzFactors[i][xyzFactorsLen[i]++] = j;
-            }
-        }
+        xyzFactorsLen[i] = collectDivisors(workItems[i], factorsLimit, xyzFactors[i]);
     }
 
     choosePreferredWorkgroupSize(xyzFactors, xyzFactorsLen, workGroupSize, workItems, wsInfo, true);
@@ -264,10 +291,8 @@ void choosePrefferedWorkgroupSize(WorkSizeInfo &wsInfo, size_t workGroupSize[3],
 }
 
 void computeWorkgroupSize2D(uint32_t maxWorkGroupSize, size_t workGroupSize[3], const size_t workItems[3], size_t simdSize) {
-    uint32_t xFactors[1024];
-    uint32_t yFactors[1024];
-    uint32_t xFactorsLen = 0;
-    uint32_t yFactorsLen = 0;
+    uint32_t xDivisors[1024];
+    uint32_t yDivisors[1024];
     uint64_t waste;
     uint64_t localWSWaste = 0xffffffffffffffff;
     uint64_t euThrdsDispatched;
@@ -279,15 +304,16 @@ void computeWorkgroupSize2D(uint32_t maxWorkGroupSize, size_t workGroupSize[3],
     for (int i = 0; i < 3; i++)
         workGroupSize[i] = 1;
 
-    for (uint32_t i = 2; i <= maxWorkGroupSize; i++) {
-        if ((workItems[0] % i) == 0) {
-            xFactors[xFactorsLen++] = i;
-        }
-        if (((workItems[1] % i) == 0)) {
-            yFactors[yFactorsLen++] = i;
-        }
+    if (maxWorkGroupSize == 0) {
+        return;
     }
 
+    // factors start from 2, skip leading divisor 1
+    const uint32_t *xFactors = xDivisors + 1;
+    const uint32_t *yFactors = yDivisors + 1;
+    uint32_t xFactorsLen = collectDivisors(workItems[0], maxWorkGroupSize, xDivisors) - 1;
+    uint32_t yFactorsLen = collectDivisors(workItems[1], maxWorkGroupSize, yDivisors) - 1;
+
     for (uint32_t xFactorsIdx = 0; xFactorsIdx < xFactorsLen; ++xFactorsIdx) {
         for (uint32_t yFactorsIdx = 0; yFactorsIdx < yFactorsLen; ++yFactorsIdx) {
             // Pick a LocalWorkSize that is a multiple as well as appropriate:
@@ -41,6 +41,8 @@ void computeWorkgroupSizeSquared(
 
 void choosePrefferedWorkgroupSize(WorkSizeInfo &wsInfo, size_t workGroupSize[3], const size_t workItems[3], const uint32_t workDim);
 
+uint32_t collectDivisors(size_t value, uint32_t limit, uint32_t divisors[1024]);
+
 Vec3<size_t> computeWorkgroupsNumber(
     const Vec3<size_t> &gws,
     const Vec3<size_t> &lws);
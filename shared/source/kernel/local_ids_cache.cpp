@@ -10,79 +10,165 @@
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/local_id_gen.h"
 #include "shared/source/helpers/simd_helper.h"
 #include "shared/source/kernel/grf_config.h"
 
+#include <algorithm>
 #include <cstring>
 
 namespace NEO {
 
-LocalIdsCache::LocalIdsCache(size_t cacheSize, std::array<uint8_t, 3> wgDimOrder, uint32_t grfCount, uint8_t simdSize, uint8_t grfSize, bool usesOnlyImages)
-    : wgDimOrder(wgDimOrder), localIdsSizePerThread(getPerThreadSizeLocalIDs(static_cast<uint32_t>(simdSize), static_cast<uint32_t>(grfSize))),
-      grfCount(grfCount), grfSize(grfSize), simdSize(simdSize), usesOnlyImages(usesOnlyImages) {
+LocalIdsCache::LocalIdsCache(size_t cacheSize)
+    : cache(std::make_unique<std::atomic<LocalIdsCacheEntry *>[]>(cacheSize)), cacheSize(cacheSize) {
     UNRECOVERABLE_IF(cacheSize == 0)
-    cache.resize(cacheSize);
+    for (size_t i = 0; i < cacheSize; i++) {
+        cache[i].store(nullptr);
+    }
 }
 
 LocalIdsCache::~LocalIdsCache() {
-    for (auto &cacheEntry : cache) {
-        alignedFree(cacheEntry.localIdsData);
+    for (size_t i = 0; i < cacheSize; i++) {
+        destroyEntry(cache[i].load());
+    }
+    for (auto entry : retiredEntries) {
+        destroyEntry(entry);
     }
 }
 
-std::unique_lock<std::mutex> LocalIdsCache::lock() {
-    return std::unique_lock<std::mutex>(setLocalIdsMutex);
+uint64_t LocalIdsCache::getKeyHash(const LocalIdsCacheKey &key) {
+    uint64_t packedGroup = static_cast<uint64_t>(key.groupSize[0]) |
+                           static_cast<uint64_t>(key.groupSize[1]) << 16 |
+                           static_cast<uint64_t>(key.groupSize[2]) << 32 |
+                           static_cast<uint64_t>(key.simdSize) << 48 |
+                           static_cast<uint64_t>(key.grfSize) << 56;
+    uint64_t packedLayout = static_cast<uint64_t>(key.wgDimOrder[0]) |
+                            static_cast<uint64_t>(key.wgDimOrder[1]) << 8 |
+                            static_cast<uint64_t>(key.wgDimOrder[2]) << 16 |
+                            static_cast<uint64_t>(key.usesOnlyImages) << 24 |
+                            static_cast<uint64_t>(key.grfCount) << 32;
+
+    uint64_t hash = packedGroup * 0x9E3779B97F4A7C15ull;
+    hash ^= (packedLayout + 0x7F4A7C159E3779B9ull + (hash << 6) + (hash >> 2));
+    return hash ^ (hash >> 29);
 }
 
-size_t LocalIdsCache::getLocalIdsSizeForGroup(const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment) const {
-    const auto numElementsInGroup = static_cast<uint32_t>(Math::computeTotalElementsCount({group[0], group[1], group[2]}));
-    if (isSimd1(simdSize)) {
+size_t LocalIdsCache::getLocalIdsSizeForGroup(const LocalIdsCacheKey &key, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    const auto numElementsInGroup = static_cast<uint32_t>(Math::computeTotalElementsCount({key.groupSize[0], key.groupSize[1], key.groupSize[2]}));
+    const auto localIdsSizePerThread = getLocalIdsSizePerThread(key);
+    if (isSimd1(key.simdSize)) {
         return static_cast<size_t>(numElementsInGroup * localIdsSizePerThread);
     }
     auto &gfxCoreHelper = rootDeviceEnvironment.getHelper<NEO::GfxCoreHelper>();
-    const auto numberOfThreads = gfxCoreHelper.calculateNumThreadsPerThreadGroup(simdSize, numElementsInGroup, grfCount, false, rootDeviceEnvironment);
+    const auto numberOfThreads = gfxCoreHelper.calculateNumThreadsPerThreadGroup(key.simdSize, numElementsInGroup, key.grfCount, false, rootDeviceEnvironment);
     return static_cast<size_t>(numberOfThreads * localIdsSizePerThread);
 }
 
-size_t LocalIdsCache::getLocalIdsSizePerThread() const {
-    return localIdsSizePerThread;
+size_t LocalIdsCache::getLocalIdsSizePerThread(const LocalIdsCacheKey &key) {
+    return getPerThreadSizeLocalIDs(static_cast<uint32_t>(key.simdSize), static_cast<uint32_t>(key.grfSize));
+}
+
+void LocalIdsCache::generateLocalIds(const LocalIdsCacheKey &key, void *destination, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    NEO::generateLocalIDs(destination, static_cast<uint16_t>(key.simdSize),
+                          {key.groupSize[0], key.groupSize[1], key.groupSize[2]}, key.wgDimOrder, key.usesOnlyImages, key.grfSize, key.grfCount, rootDeviceEnvironment);
+}
+
+LocalIdsCache::LocalIdsCacheEntry *LocalIdsCache::createEntry(const LocalIdsCacheKey &key, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    auto entry = new LocalIdsCacheEntry;
+    entry->key = key;
+    entry->localIdsSize = getLocalIdsSizeForGroup(key, rootDeviceEnvironment);
+    entry->localIdsData = static_cast<uint8_t *>(alignedMalloc(entry->localIdsSize, 64));
+    generateLocalIds(key, entry->localIdsData, rootDeviceEnvironment);
+    return entry;
 }
 
-void LocalIdsCache::setLocalIdsForEntry(LocalIdsCacheEntry &entry, void *destination) {
-    entry.accessCounter++;
-    std::memcpy(destination, entry.localIdsData, entry.localIdsSize);
+void LocalIdsCache::destroyEntry(LocalIdsCacheEntry *entry) {
+    if (entry) {
+        alignedFree(entry->localIdsData);
+        delete entry;
+    }
 }
 
-void LocalIdsCache::setLocalIdsForGroup(const Vec3<uint16_t> &group, void *destination, const RootDeviceEnvironment &rootDeviceEnvironment) {
-    auto setLocalIdsLock = lock();
-    LocalIdsCacheEntry *leastAccessedEntry = &cache[0];
-    for (auto &cacheEntry : cache) {
-        if (cacheEntry.groupSize == group) {
-            return setLocalIdsForEntry(cacheEntry, destination);
+void LocalIdsCache::retireEntry(LocalIdsCacheEntry *entry) {
+    std::vector<LocalIdsCacheEntry *> entriesToDestroy;
+    {
+        std::lock_guard<std::mutex> lock(retiredEntriesMutex);
+        if (entry != nullptr) {
+            retiredEntries.push_back(entry);
+        }
+        // Lookups register before loading a slot, so once none is in flight
+        // no one can still hold an entry that was unlinked before this point.
+        if (activeLookups.load() == 0U) {
+            entriesToDestroy.swap(retiredEntries);
         }
+        hasRetiredEntries.store(!retiredEntries.empty(), std::memory_order_relaxed);
+    }
+    for (auto retiredEntry : entriesToDestroy) {
+        destroyEntry(retiredEntry);
+    }
+}
 
-        if (cacheEntry.accessCounter < leastAccessedEntry->accessCounter) {
-            leastAccessedEntry = &cacheEntry;
+void LocalIdsCache::setLocalIdsForGroup(const LocalIdsCacheKey &key, void *destination, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    const auto hash = getKeyHash(key);
+    const auto probeCount = std::min(cacheSize, maxProbeCount);
+
+    std::atomic<LocalIdsCacheEntry *> *victimSlot = nullptr;
+    LocalIdsCacheEntry *victim = nullptr;
+    LocalIdsCacheEntry *replacedEntry = nullptr;
+    bool found = false;
+
+    activeLookups++;
+    for (size_t probe = 0; probe < probeCount; probe++) {
+        auto &slot = cache[(hash + probe) % cacheSize];
+        auto entry = slot.load();
+
+        if (entry == nullptr) {
+            auto newEntry = createEntry(key, rootDeviceEnvironment);
+            if (slot.compare_exchange_strong(entry, newEntry)) {
+                entry = newEntry;
+            } else {
+                destroyEntry(newEntry);
+            }
+        }
+
+        if (entry->key == key) {
+            if (!entry->recentlyUsed.load(std::memory_order_relaxed)) {
+                entry->recentlyUsed.store(true, std::memory_order_relaxed);
+            }
+            std::memcpy(destination, entry->localIdsData, entry->localIdsSize);
+            found = true;
+            break;
+        }
+
+        if (victimSlot == nullptr && !entry->recentlyUsed.exchange(false, std::memory_order_relaxed)) {
+            victimSlot = &slot;
+            victim = entry;
         }
     }
 
-    commitNewEntry(*leastAccessedEntry, group, rootDeviceEnvironment);
-    setLocalIdsForEntry(*leastAccessedEntry, destination);
-}
+    if (!found) {
+        if (victimSlot == nullptr) {
+            victimSlot = &cache[hash % cacheSize];
+            victim = victimSlot->load();
+        }
+        auto newEntry = createEntry(key, rootDeviceEnvironment);
+        std::memcpy(destination, newEntry->localIdsData, newEntry->localIdsSize);
+        if (victimSlot->compare_exchange_strong(victim, newEntry)) {
+            replacedEntry = victim;
+        } else {
+            destroyEntry(newEntry);
+        }
+    }
+    activeLookups--;
 
-void LocalIdsCache::commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment) {
-    entry.localIdsSize = getLocalIdsSizeForGroup(group, rootDeviceEnvironment);
-    entry.groupSize = group;
-    entry.accessCounter = 0U;
-    if (entry.localIdsSize > entry.localIdsSizeAllocated) {
-        alignedFree(entry.localIdsData);
-        entry.localIdsData = static_cast<uint8_t *>(alignedMalloc(entry.localIdsSize, 32));
-        entry.localIdsSizeAllocated = entry.localIdsSize;
+    if (replacedEntry != nullptr) {
+        retireEntry(replacedEntry);
+    } else if (hasRetiredEntries.load(std::memory_order_relaxed) && activeLookups.load() == 0U) {
+        // release entries retired while other lookups were in flight
+        retireEntry(nullptr);
     }
-    NEO::generateLocalIDs(entry.localIdsData, static_cast<uint16_t>(simdSize),
-                          {group[0], group[1], group[2]}, wgDimOrder, usesOnlyImages, grfSize, grfCount, rootDeviceEnvironment);
 }
 
-} // namespace NEO
\ No newline at end of file
+} // namespace NEO
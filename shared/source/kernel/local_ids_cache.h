@@ -5,47 +5,76 @@
  *
  */
 
+#pragma once
 #include "shared/source/helpers/vec.h"
-#include "shared/source/utilities/stackvec.h"
 
 #include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace NEO {
 struct RootDeviceEnvironment;
+
+struct LocalIdsCacheKey {
+    Vec3<uint16_t> groupSize = {0, 0, 0};
+    std::array<uint8_t, 3> wgDimOrder = {0, 1, 2};
+    uint32_t grfCount = 0U;
+    uint8_t simdSize = 0U;
+    uint8_t grfSize = 0U;
+    bool usesOnlyImages = false;
+
+    bool operator==(const LocalIdsCacheKey &other) const {
+        return groupSize == other.groupSize &&
+               wgDimOrder == other.wgDimOrder &&
+               grfCount == other.grfCount &&
+               simdSize == other.simdSize &&
+               grfSize == other.grfSize &&
+               usesOnlyImages == other.usesOnlyImages;
+    }
+};
+
+// Device-wide cache of generated per-thread local ids.
+// Entries are immutable once published, so lookups and insertions are lock-free.
+// When all slots in the probe window are taken, an entry not used since the previous
+// sweep (second chance) is replaced. Replaced entries are released by the first lookup
+// that finishes with no other lookup in flight, so they do not pile up under contention.
 class LocalIdsCache {
   public:
     struct LocalIdsCacheEntry {
-        Vec3<uint16_t> groupSize = {0, 0, 0};
+        LocalIdsCacheKey key;
         uint8_t *localIdsData = nullptr;
         size_t localIdsSize = 0U;
-        size_t localIdsSizeAllocated = 0U;
-        size_t accessCounter = 0;
+        std::atomic<bool> recentlyUsed{true};
     };
 
+    static constexpr size_t defaultCacheSize = 64U;
+    static constexpr size_t maxProbeCount = 8U;
+
     LocalIdsCache() = delete;
     LocalIdsCache(LocalIdsCache &) = delete;
     LocalIdsCache &operator=(const LocalIdsCache &other) = delete;
 
-    LocalIdsCache(size_t cacheSize, std::array<uint8_t, 3> wgDimOrder, uint32_t grfCount, uint8_t simdSize, uint8_t grfSize, bool usesOnlyImages = false);
+    explicit LocalIdsCache(size_t cacheSize);
     ~LocalIdsCache();
 
-    void setLocalIdsForGroup(const Vec3<uint16_t> &group, void *destination, const RootDeviceEnvironment &rootDeviceEnvironment);
-    size_t getLocalIdsSizeForGroup(const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment) const;
-    size_t getLocalIdsSizePerThread() const;
+    void setLocalIdsForGroup(const LocalIdsCacheKey &key, void *destination, const RootDeviceEnvironment &rootDeviceEnvironment);
+    static size_t getLocalIdsSizeForGroup(const LocalIdsCacheKey &key, const RootDeviceEnvironment &rootDeviceEnvironment);
+    static size_t getLocalIdsSizePerThread(const LocalIdsCacheKey &key);
 
   protected:
-    void setLocalIdsForEntry(LocalIdsCacheEntry &entry, void *destination);
-    void commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment);
-    std::unique_lock<std::mutex> lock();
-
-    StackVec<LocalIdsCacheEntry, 4> cache;
-    std::mutex setLocalIdsMutex;
-    const std::array<uint8_t, 3> wgDimOrder;
-    const uint32_t localIdsSizePerThread;
-    const uint32_t grfCount;
-    const uint8_t grfSize;
-    const uint8_t simdSize;
-    const bool usesOnlyImages;
+    static uint64_t getKeyHash(const LocalIdsCacheKey &key);
+    static void generateLocalIds(const LocalIdsCacheKey &key, void *destination, const RootDeviceEnvironment &rootDeviceEnvironment);
+    LocalIdsCacheEntry *createEntry(const LocalIdsCacheKey &key, const RootDeviceEnvironment &rootDeviceEnvironment);
+    static void destroyEntry(LocalIdsCacheEntry *entry);
+    void retireEntry(LocalIdsCacheEntry *entry);
+
+    std::unique_ptr<std::atomic<LocalIdsCacheEntry *>[]> cache;
+    const size_t cacheSize;
+    std::atomic<uint32_t> activeLookups{0U};
+    std::mutex retiredEntriesMutex;
+    std::vector<LocalIdsCacheEntry *> retiredEntries;
+    std::atomic<bool> hasRetiredEntries{false};
 };
-} // namespace NEO
\ No newline at end of file
+} // namespace NEO
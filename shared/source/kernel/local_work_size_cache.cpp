@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/kernel/local_work_size_cache.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <mutex>
+
+namespace NEO {
+
+LocalWorkSizeCache::LocalWorkSizeCache(size_t cacheSize) : cacheSize(cacheSize) {
+    UNRECOVERABLE_IF(cacheSize == 0)
+    index.reserve(cacheSize);
+}
+
+size_t LocalWorkSizeCache::KeyHash::operator()(const LocalWorkSizeCacheKey &key) const {
+    uint64_t hash = static_cast<uint64_t>(key.globalSize.x) * 0x9E3779B97F4A7C15ull;
+    hash ^= static_cast<uint64_t>(key.globalSize.y) + 0x7F4A7C159E3779B9ull + (hash << 6) + (hash >> 2);
+    hash ^= static_cast<uint64_t>(key.globalSize.z) + 0x7F4A7C159E3779B9ull + (hash << 6) + (hash >> 2);
+    hash ^= (static_cast<uint64_t>(key.slmTotalSize) << 2 | key.workDim) + 0x7F4A7C159E3779B9ull + (hash << 6) + (hash >> 2);
+    return static_cast<size_t>(hash ^ (hash >> 29));
+}
+
+bool LocalWorkSizeCache::find(const LocalWorkSizeCacheKey &key, Vec3<size_t> &localWorkSize) {
+    std::lock_guard<SpinLock> lock(mutex);
+    auto it = index.find(key);
+    if (it == index.end()) {
+        return false;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    localWorkSize = it->second->second;
+    return true;
+}
+
+void LocalWorkSizeCache::insert(const LocalWorkSizeCacheKey &key, const Vec3<size_t> &localWorkSize) {
+    std::lock_guard<SpinLock> lock(mutex);
+    auto it = index.find(key);
+    if (it != index.end()) {
+        it->second->second = localWorkSize;
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+    if (entries.size() == cacheSize) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+    entries.emplace_front(key, localWorkSize);
+    index.emplace(key, entries.begin());
+}
+
+size_t LocalWorkSizeCache::size() const {
+    std::lock_guard<SpinLock> lock(mutex);
+    return entries.size();
+}
+
+} // namespace NEO
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/vec.h"
+#include "shared/source/utilities/spinlock.h"
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace NEO {
+
+struct LocalWorkSizeCacheKey {
+    Vec3<size_t> globalSize = {0, 0, 0};
+    uint32_t slmTotalSize = 0u;
+    uint32_t workDim = 0u;
+
+    bool operator==(const LocalWorkSizeCacheKey &other) const {
+        return globalSize == other.globalSize &&
+               slmTotalSize == other.slmTotalSize &&
+               workDim == other.workDim;
+    }
+};
+
+// Bounded per-kernel cache of local work sizes chosen for a given global size.
+// Entries are looked up through a hash index and the least recently used one is
+// evicted when the cache is full. Properties which also affect the result
+// (kernel descriptor, barriers, device) are fixed for the owning kernel. Keeping
+// the cache per kernel instead of per device avoids keying on descriptor addresses
+// that may be reused after module destruction and keeps launches of different
+// kernels from contending on one lock.
+class LocalWorkSizeCache {
+  public:
+    static constexpr size_t defaultCacheSize = 64u;
+
+    LocalWorkSizeCache() : LocalWorkSizeCache(defaultCacheSize) {}
+    explicit LocalWorkSizeCache(size_t cacheSize);
+    LocalWorkSizeCache(const LocalWorkSizeCache &) = delete;
+    LocalWorkSizeCache &operator=(const LocalWorkSizeCache &) = delete;
+
+    bool find(const LocalWorkSizeCacheKey &key, Vec3<size_t> &localWorkSize);
+    void insert(const LocalWorkSizeCacheKey &key, const Vec3<size_t> &localWorkSize);
+    size_t size() const;
+
+  protected:
+    struct KeyHash {
+        size_t operator()(const LocalWorkSizeCacheKey &key) const;
+    };
+    using EntryList = std::list<std::pair<LocalWorkSizeCacheKey, Vec3<size_t>>>;
+
+    EntryList entries;
+    std::unordered_map<LocalWorkSizeCacheKey, EntryList::iterator, KeyHash> index;
+    const size_t cacheSize;
+    mutable SpinLock mutex;
+};
+} // namespace NEO
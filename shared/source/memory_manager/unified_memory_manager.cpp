@@ -23,6 +23,8 @@
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 uint32_t SVMAllocsManager::UnifiedMemoryProperties::getRootDeviceIndex() const {
@@ -143,6 +145,15 @@ SvmMapOperation *SVMAllocsManager::MapOperationsTracker::get(const void *regionP
 void SVMAllocsManager::addInternalAllocationsToResidencyContainer(uint32_t rootDeviceIndex,
                                                                   ResidencyContainer &residencyContainer,
                                                                   uint32_t requestedTypesMask) {
+    if (residencySnapshotsEnabled) {
+        std::unique_lock<std::shared_mutex> lock(mtx);
+        auto snapshot = obtainResidencySnapshot(rootDeviceIndex, requestedTypesMask);
+        residencyContainer.reserve(residencyContainer.size() + snapshot->allocations.size());
+        for (auto &allocation : snapshot->allocations) {
+            residencyContainer.push_back(allocation.gpuAllocation);
+        }
+        return;
+    }
     std::shared_lock<std::shared_mutex> lock(mtx);
     for (auto &allocation : this->svmAllocs.allocations) {
         if (rootDeviceIndex >= allocation.second->gpuAllocations.getGraphicsAllocations().size()) {
@@ -160,6 +171,27 @@ void SVMAllocsManager::addInternalAllocationsToResidencyContainer(uint32_t rootD
 }
 
 void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &commandStreamReceiver, uint32_t requestedTypesMask) {
+    if (residencySnapshotsEnabled) {
+        std::unique_lock<std::shared_mutex> lock(mtx);
+        auto snapshot = obtainResidencySnapshot(commandStreamReceiver.getRootDeviceIndex(), requestedTypesMask);
+        auto &csrResidency = snapshot->csrResidencies[&commandStreamReceiver];
+
+        // Without residency packs every submission has to list all indirect allocations,
+        // generations are only used to count allocations added since previous submission of this CSR.
+        uint32_t allocationsAdded = 0u;
+        for (auto &allocation : snapshot->allocations) {
+            commandStreamReceiver.makeResident(*allocation.gpuAllocation);
+            if (allocation.generation > csrResidency.residentGeneration) {
+                allocationsAdded++;
+            }
+        }
+
+        csrResidency.lastSubmissionCounters.allocationsTouched = static_cast<uint32_t>(snapshot->allocations.size());
+        csrResidency.lastSubmissionCounters.allocationsChanged = allocationsAdded + static_cast<uint32_t>(snapshot->removalsCount - csrResidency.seenRemovalsCount);
+        csrResidency.residentGeneration = snapshot->generation;
+        csrResidency.seenRemovalsCount = snapshot->removalsCount;
+        return;
+    }
     std::shared_lock<std::shared_mutex> lock(mtx);
     for (auto &allocation : this->svmAllocs.allocations) {
         if (static_cast<uint32_t>(allocation.second->memoryType) & requestedTypesMask) {
@@ -172,8 +204,79 @@ void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &co
     }
 }
 
+SVMAllocsManager::ResidencySnapshotCounters SVMAllocsManager::getResidencySnapshotCounters(CommandStreamReceiver &commandStreamReceiver, uint32_t requestedTypesMask) {
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    auto snapshot = findResidencySnapshot(commandStreamReceiver.getRootDeviceIndex(), requestedTypesMask);
+    if (snapshot == nullptr) {
+        return {};
+    }
+    auto csrResidency = snapshot->csrResidencies.find(&commandStreamReceiver);
+    if (csrResidency == snapshot->csrResidencies.end()) {
+        return {};
+    }
+    return csrResidency->second.lastSubmissionCounters;
+}
+
+SVMAllocsManager::ResidencySnapshot *SVMAllocsManager::findResidencySnapshot(uint32_t rootDeviceIndex, uint32_t requestedTypesMask) const {
+    for (auto &snapshot : residencySnapshots) {
+        if (snapshot->rootDeviceIndex == rootDeviceIndex && snapshot->requestedTypesMask == requestedTypesMask) {
+            return snapshot.get();
+        }
+    }
+    return nullptr;
+}
+
+SVMAllocsManager::ResidencySnapshot *SVMAllocsManager::obtainResidencySnapshot(uint32_t rootDeviceIndex, uint32_t requestedTypesMask) {
+    auto snapshot = findResidencySnapshot(rootDeviceIndex, requestedTypesMask);
+    if (snapshot != nullptr) {
+        return snapshot;
+    }
+
+    auto newSnapshot = std::make_unique<ResidencySnapshot>();
+    newSnapshot->rootDeviceIndex = rootDeviceIndex;
+    newSnapshot->requestedTypesMask = requestedTypesMask;
+    for (auto &allocation : this->svmAllocs.allocations) {
+        addToResidencySnapshot(*newSnapshot, allocation.first, *allocation.second);
+    }
+    residencySnapshots.push_back(std::move(newSnapshot));
+    return residencySnapshots.back().get();
+}
+
+void SVMAllocsManager::addToResidencySnapshot(ResidencySnapshot &snapshot, const void *svmPtr, const SvmAllocationData &allocData) {
+    if (!(static_cast<uint32_t>(allocData.memoryType) & snapshot.requestedTypesMask) ||
+        snapshot.rootDeviceIndex >= allocData.gpuAllocations.getGraphicsAllocations().size()) {
+        return;
+    }
+    auto gpuAllocation = allocData.gpuAllocations.getGraphicsAllocation(snapshot.rootDeviceIndex);
+    if (gpuAllocation == nullptr) {
+        return;
+    }
+    auto entry = snapshot.allocations.insert(snapshot.allocations.end(), ResidencySnapshot::Entry{svmPtr, gpuAllocation, ++snapshot.generation});
+    snapshot.allocationsIndices[svmPtr] = entry;
+}
+
+void SVMAllocsManager::addToResidencySnapshots(const void *svmPtr, const SvmAllocationData &allocData) {
+    for (auto &snapshot : residencySnapshots) {
+        addToResidencySnapshot(*snapshot, svmPtr, allocData);
+    }
+}
+
+void SVMAllocsManager::removeFromResidencySnapshots(const void *svmPtr) {
+    for (auto &snapshot : residencySnapshots) {
+        auto index = snapshot->allocationsIndices.find(svmPtr);
+        if (index != snapshot->allocationsIndices.end()) {
+            snapshot->allocations.erase(index->second);
+            snapshot->allocationsIndices.erase(index);
+            snapshot->removalsCount++;
+        }
+    }
+}
+
 SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager, bool multiOsContextSupport)
     : memoryManager(memoryManager), multiOsContextSupport(multiOsContextSupport) {
+    if (debugManager.flags.EnableIndirectAllocationsResidencySnapshot.get() != -1) {
+        residencySnapshotsEnabled = !!debugManager.flags.EnableIndirectAllocationsResidencySnapshot.get();
+    }
 }
 
 SVMAllocsManager::~SVMAllocsManager() = default;
@@ -438,6 +541,7 @@ void SVMAllocsManager::insertSVMAlloc(const SvmAllocationData &svmAllocData) {
 void SVMAllocsManager::removeSVMAlloc(const SvmAllocationData &svmAllocData) {
     std::unique_lock<std::shared_mutex> lock(mtx);
     internalAllocationsMap.erase(svmAllocData.getAllocId());
+    removeFromResidencySnapshots(reinterpret_cast<void *>(svmAllocData.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
     svmAllocs.remove(reinterpret_cast<void *>(svmAllocData.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
 }
 
@@ -682,6 +786,7 @@ void SVMAllocsManager::freeSVMData(SvmAllocationData *svmData) {
     std::unique_lock<std::mutex> lockForIndirect(mtxForIndirectAccess);
     std::unique_lock<std::shared_mutex> lock(mtx);
     internalAllocationsMap.erase(svmData->getAllocId());
+    removeFromResidencySnapshots(reinterpret_cast<void *>(svmData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
     svmAllocs.remove(reinterpret_cast<void *>(svmData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
 }
 
@@ -764,7 +869,7 @@ void SVMAllocsManager::makeIndirectAllocationsResident(CommandStreamReceiver &co
         tracker.latestResidentObjectId = this->allocationsCounter;
         tracker.latestSentTaskCount = taskCount;
 
-        this->indirectAllocationsResidency.insert(std::make_pair(&commandStreamReceiver, tracker));
+        entry = this->indirectAllocationsResidency.insert(std::make_pair(&commandStreamReceiver, tracker)).first;
     } else {
         if (this->allocationsCounter > entry->second.latestResidentObjectId) {
             parseAllAllocations = true;
@@ -773,8 +878,10 @@ void SVMAllocsManager::makeIndirectAllocationsResident(CommandStreamReceiver &co
         }
         entry->second.latestSentTaskCount = taskCount;
     }
+    entry->second.latestTouchedAllocationsCount = 0u;
     if (parseAllAllocations) {
         auto currentCounter = this->allocationsCounter.load();
+        entry->second.latestTouchedAllocationsCount = static_cast<uint32_t>(currentCounter - previousCounter);
         for (auto allocationId = static_cast<uint32_t>(previousCounter + 1); allocationId <= currentCounter; allocationId++) {
             makeResidentForAllocationsWithId(allocationId, commandStreamReceiver);
         }
@@ -905,6 +1012,7 @@ std::unique_lock<std::mutex> SVMAllocsManager::obtainOwnership() {
 void SVMAllocsManager::insertSVMAlloc(void *svmPtr, const SvmAllocationData &allocData) {
     std::unique_lock<std::shared_mutex> lock(mtx);
     this->svmAllocs.insert(svmPtr, allocData);
+    addToResidencySnapshots(svmPtr, allocData);
     UNRECOVERABLE_IF(internalAllocationsMap.count(allocData.getAllocId()) > 0);
     for (auto alloc : allocData.gpuAllocations.getGraphicsAllocations()) {
         if (alloc != nullptr) {
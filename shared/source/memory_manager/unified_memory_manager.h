@@ -17,11 +17,14 @@
 
 #include <atomic>
 #include <cstdint>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -122,6 +125,12 @@ class SVMAllocsManager {
     struct InternalAllocationsTracker {
         TaskCountType latestSentTaskCount = 0lu;
         TaskCountType latestResidentObjectId = 0lu;
+        uint32_t latestTouchedAllocationsCount = 0u;
+    };
+
+    struct ResidencySnapshotCounters {
+        uint32_t allocationsChanged = 0u;
+        uint32_t allocationsTouched = 0u;
     };
 
     struct UnifiedMemoryProperties {
@@ -224,6 +233,7 @@ class SVMAllocsManager {
                                                                      ResidencyContainer &residencyContainer,
                                                                      uint32_t requestedTypesMask);
     void makeInternalAllocationsResident(CommandStreamReceiver &commandStreamReceiver, uint32_t requestedTypesMask);
+    ResidencySnapshotCounters getResidencySnapshotCounters(CommandStreamReceiver &commandStreamReceiver, uint32_t requestedTypesMask);
     void *createUnifiedAllocationWithDeviceStorage(size_t size, const SvmAllocationProperties &svmProperties, const UnifiedMemoryProperties &unifiedMemoryProperties);
     void freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData);
     bool hasHostAllocations();
@@ -244,6 +254,30 @@ class SVMAllocsManager {
     bool submitIndirectAllocationsAsPack(CommandStreamReceiver &csr);
 
   protected:
+    // Allocations of requested types on given root device, updated with every allocation created or freed,
+    // so submissions don't have to walk all live allocations. Allocations are kept in the order they were added
+    // and tagged with a generation, so changes since previous submission of each CSR can be counted.
+    struct ResidencySnapshot {
+        struct Entry {
+            const void *svmPtr = nullptr;
+            GraphicsAllocation *gpuAllocation = nullptr;
+            uint64_t generation = 0u;
+        };
+        struct CsrResidency {
+            uint64_t residentGeneration = 0u;
+            uint64_t seenRemovalsCount = 0u;
+            ResidencySnapshotCounters lastSubmissionCounters{};
+        };
+
+        std::list<Entry> allocations;
+        std::unordered_map<const void *, std::list<Entry>::iterator> allocationsIndices;
+        std::unordered_map<CommandStreamReceiver *, CsrResidency> csrResidencies;
+        uint64_t generation = 0u;
+        uint64_t removalsCount = 0u;
+        uint32_t rootDeviceIndex = 0u;
+        uint32_t requestedTypesMask = 0u;
+    };
+
     void *createZeroCopySvmAllocation(size_t size, const SvmAllocationProperties &svmProperties,
                                       const RootDeviceIndicesContainer &rootDeviceIndices,
                                       const std::map<uint32_t, DeviceBitfield> &subdeviceBitfields);
@@ -256,6 +290,11 @@ class SVMAllocsManager {
     void freeSVMData(SvmAllocationData *svmData);
     void insertSVMAlloc(void *ptr, const SvmAllocationData &allocData);
     void makeResidentForAllocationsWithId(uint32_t allocationId, CommandStreamReceiver &csr);
+    ResidencySnapshot *findResidencySnapshot(uint32_t rootDeviceIndex, uint32_t requestedTypesMask) const;
+    ResidencySnapshot *obtainResidencySnapshot(uint32_t rootDeviceIndex, uint32_t requestedTypesMask);
+    void addToResidencySnapshots(const void *svmPtr, const SvmAllocationData &allocData);
+    void removeFromResidencySnapshots(const void *svmPtr);
+    static void addToResidencySnapshot(ResidencySnapshot &snapshot, const void *svmPtr, const SvmAllocationData &allocData);
 
     SortedVectorBasedAllocationTracker svmAllocs;
     MapOperationsTracker svmMapOperations;
@@ -269,5 +308,7 @@ class SVMAllocsManager {
     bool usmDeviceAllocationsCacheEnabled = false;
     bool usmHostAllocationsCacheEnabled = false;
     std::multimap<uint32_t, GraphicsAllocation *> internalAllocationsMap;
+    std::vector<std::unique_ptr<ResidencySnapshot>> residencySnapshots;
+    bool residencySnapshotsEnabled = false;
 };
 } // namespace NEO
@@ -7,6 +7,8 @@
 
 #include "shared/source/tbx/tbx_sockets_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/string.h"
 
@@ -32,10 +34,15 @@ namespace NEO {
 
 TbxSocketsImp::TbxSocketsImp(std::ostream &err)
     : cerrStream(err) {
+    if (debugManager.flags.TbxSocketsWriteBufferSizeInKb.get() > 0) {
+        pendingWriteDataCapacity = static_cast<size_t>(debugManager.flags.TbxSocketsWriteBufferSizeInKb.get() * MemoryConstants::kiloByte);
+        pendingWriteData.reserve(pendingWriteDataCapacity);
+    }
 }
 
 void TbxSocketsImp::close() {
     if (0 != socket) {
+        flushWriteData();
 #ifdef WIN32
         ::shutdown(socket, 0x02 /*SD_BOTH*/);
 
@@ -144,7 +151,7 @@ bool TbxSocketsImp::readMMIO(uint32_t offset, uint32_t *data) {
         cmd.u.mmioReq.msgType = MSG_TYPE_MMIO;
         cmd.u.mmioReq.size = sizeof(uint32_t);
 
-        success = sendWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size);
+        success = queueWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size) && flushWriteData();
         if (!success) {
             break;
         }
@@ -181,7 +188,7 @@ bool TbxSocketsImp::writeMMIO(uint32_t offset, uint32_t value) {
     cmd.u.mmioReq.write = 1;
     cmd.u.mmioReq.size = sizeof(uint32_t);
 
-    return sendWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size);
+    return queueWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size) && flushWriteData();
 }
 
 bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
@@ -200,7 +207,7 @@ bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
 
     bool success;
     do {
-        success = sendWriteData(&cmd, sizeof(HasHdr) + sizeof(HasReadDataReq));
+        success = queueWriteData(&cmd, sizeof(HasHdr) + sizeof(HasReadDataReq)) && flushWriteData();
         if (!success) {
             break;
         }
@@ -242,12 +249,12 @@ bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size
 
     bool success;
     do {
-        success = sendWriteData(&cmd, sizeof(HasHdr) + sizeof(HasWriteDataReq));
+        success = queueWriteData(&cmd, sizeof(HasHdr) + sizeof(HasWriteDataReq));
         if (!success) {
             break;
         }
 
-        success = sendWriteData(data, size);
+        success = queueWriteData(data, size);
         if (!success) {
             cerrStream << "Problem sending write data?" << std::endl;
             break;
@@ -269,7 +276,7 @@ bool TbxSocketsImp::writeGTT(uint32_t offset, uint64_t entry) {
     cmd.u.gtt64Req.data = static_cast<uint32_t>(entry & 0xffffffff);
     cmd.u.gtt64Req.dataH = static_cast<uint32_t>(entry >> 32);
 
-    return sendWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size);
+    return queueWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size);
 }
 
 bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
@@ -289,6 +296,35 @@ bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
     return true;
 }
 
+bool TbxSocketsImp::queueWriteData(const void *buffer, size_t sizeInBytes) {
+    if (pendingWriteDataCapacity == 0) {
+        return sendWriteData(buffer, sizeInBytes);
+    }
+
+    if (pendingWriteData.size() + sizeInBytes > pendingWriteDataCapacity) {
+        if (!flushWriteData()) {
+            return false;
+        }
+        if (sizeInBytes > pendingWriteDataCapacity) {
+            return sendWriteData(buffer, sizeInBytes);
+        }
+    }
+
+    auto dataBuffer = static_cast<const char *>(buffer);
+    pendingWriteData.insert(pendingWriteData.end(), dataBuffer, dataBuffer + sizeInBytes);
+    return true;
+}
+
+bool TbxSocketsImp::flushWriteData() {
+    if (pendingWriteData.empty()) {
+        return true;
+    }
+
+    auto success = sendWriteData(pendingWriteData.data(), pendingWriteData.size());
+    pendingWriteData.clear();
+    return success;
+}
+
 bool TbxSocketsImp::getResponseData(void *buffer, size_t sizeInBytes) {
     size_t totalRecv = 0;
     auto dataBuffer = static_cast<char *>(buffer);
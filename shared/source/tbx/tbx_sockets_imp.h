@@ -12,6 +12,7 @@
 
 #include <cstdint>
 #include <iostream>
+#include <vector>
 
 namespace NEO {
 
@@ -36,13 +37,20 @@ class TbxSocketsImp : public TbxSockets {
     SOCKET socket = 0;
 
     bool connectToServer(const std::string &hostNameOrIp, uint16_t port);
-    bool sendWriteData(const void *buffer, size_t sizeInBytes);
-    bool getResponseData(void *buffer, size_t sizeInBytes);
+    MOCKABLE_VIRTUAL bool sendWriteData(const void *buffer, size_t sizeInBytes);
+    bool queueWriteData(const void *buffer, size_t sizeInBytes);
+    bool flushWriteData();
+    MOCKABLE_VIRTUAL bool getResponseData(void *buffer, size_t sizeInBytes);
 
     inline uint32_t getNextTransID() { return transID++; }
 
     void logErrorInfo(const char *tag);
 
     uint32_t transID = 0;
+
+    // Requests without a response are coalesced and sent together before the next request
+    // that waits for a response, the next MMIO write or when the buffer fills up.
+    std::vector<char> pendingWriteData;
+    size_t pendingWriteDataCapacity = 0;
 };
 } // namespace NEO
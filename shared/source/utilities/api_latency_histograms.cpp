@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/api_latency_histograms.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/basic_math.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+namespace NEO {
+
+std::atomic<uint64_t> ApiLatencyHistograms::instancesCounter{0};
+thread_local ApiLatencyHistograms::ThreadHistogramsSlot ApiLatencyHistograms::threadHistogramsSlot;
+
+namespace {
+std::atomic<bool> globalHistogramsDestroyed{false};
+
+int64_t getCurrentTimeMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
+ApiLatencyHistograms::ApiLatencyHistograms(uint32_t samplingRate, int64_t dumpIntervalMs)
+    : instanceId(++instancesCounter), samplingRate(samplingRate), dumpIntervalMs(dumpIntervalMs), registry(std::make_shared<ThreadHistogramsRegistry>()) {
+    lastDumpTimeMs = getCurrentTimeMs();
+}
+
+ApiLatencyHistograms::~ApiLatencyHistograms() {
+    if (isEnabled() && dumpIntervalMs != 0) {
+        std::ostringstream out;
+        dump(out);
+        PRINT_DEBUG_STRING(true, stdout, "%s", out.str().c_str());
+    }
+}
+
+ApiLatencyHistograms *ApiLatencyHistograms::getGlobal() {
+    struct GlobalApiLatencyHistograms : ApiLatencyHistograms {
+        using ApiLatencyHistograms::ApiLatencyHistograms;
+        ~GlobalApiLatencyHistograms() {
+            globalHistogramsDestroyed.store(true);
+        }
+    };
+    static GlobalApiLatencyHistograms globalHistograms(static_cast<uint32_t>(std::max(0, debugManager.flags.ApiLatencyHistogramSamplingRate.get())),
+                                                       static_cast<int64_t>(debugManager.flags.ApiLatencyHistogramDumpIntervalMs.get()));
+    if (globalHistogramsDestroyed.load()) {
+        return nullptr;
+    }
+    return &globalHistograms;
+}
+
+const char *ApiLatencyHistograms::getEntryPointName(ApiLatencyEntryPoint entryPoint) {
+    static constexpr const char *names[entryPointsCount] = {
+        "clEnqueueNDRangeKernel",
+        "clEnqueueReadBuffer",
+        "clEnqueueWriteBuffer",
+        "clFinish",
+        "clWaitForEvents",
+        "zeCommandListAppendLaunchKernel",
+        "zeCommandListAppendMemoryCopy",
+        "zeCommandQueueExecuteCommandLists",
+        "zeCommandQueueSynchronize",
+        "zeEventHostSynchronize"};
+    return names[static_cast<uint32_t>(entryPoint)];
+}
+
+bool ApiLatencyHistograms::getEntryPoint(const char *entryPointName, ApiLatencyEntryPoint &entryPoint) {
+    for (uint32_t i = 0; i < entryPointsCount; i++) {
+        if (strcmp(entryPointName, getEntryPointName(static_cast<ApiLatencyEntryPoint>(i))) == 0) {
+            entryPoint = static_cast<ApiLatencyEntryPoint>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t ApiLatencyHistograms::getBucketIndex(uint64_t latencyNs) {
+    if (latencyNs == 0u) {
+        return 0u;
+    }
+    return std::min(Math::log2(latencyNs) + 1u, bucketsCount - 1u);
+}
+
+ApiLatencyHistograms::ThreadHistogramsSlot::~ThreadHistogramsSlot() {
+    release();
+}
+
+void ApiLatencyHistograms::ThreadHistogramsSlot::release() {
+    if (auto lockedRegistry = registry.lock()) {
+        std::lock_guard<std::mutex> lock(lockedRegistry->mutex);
+        histograms->inUse = false;
+    }
+    registry.reset();
+    histograms = nullptr;
+    instanceId = 0;
+}
+
+ApiLatencyHistograms::ThreadHistograms &ApiLatencyHistograms::getThreadHistograms() {
+    // The id guards against picking up histograms of a destroyed instance allocated at the same address
+    if (threadHistogramsSlot.instanceId != instanceId) {
+        threadHistogramsSlot.release();
+
+        std::lock_guard<std::mutex> lock(registry->mutex);
+        auto &threadHistograms = registry->threadHistograms;
+        auto freeHistograms = std::find_if(threadHistograms.begin(), threadHistograms.end(), [](const auto &histograms) { return !histograms->inUse; });
+        if (freeHistograms != threadHistograms.end()) {
+            (*freeHistograms)->inUse = true;
+            (*freeHistograms)->callsSinceLastSample = 0u;
+            threadHistogramsSlot.histograms = freeHistograms->get();
+        } else {
+            threadHistograms.push_back(std::make_unique<ThreadHistograms>());
+            threadHistogramsSlot.histograms = threadHistograms.back().get();
+        }
+        threadHistogramsSlot.registry = registry;
+        threadHistogramsSlot.instanceId = instanceId;
+    }
+    return *threadHistogramsSlot.histograms;
+}
+
+bool ApiLatencyHistograms::shouldSampleCall() {
+    auto &histograms = getThreadHistograms();
+    if (++histograms.callsSinceLastSample < samplingRate) {
+        return false;
+    }
+    histograms.callsSinceLastSample = 0u;
+    return true;
+}
+
+void ApiLatencyHistograms::record(ApiLatencyEntryPoint entryPoint, uint64_t latencyNs) {
+    auto &bucket = getThreadHistograms().buckets[static_cast<uint32_t>(entryPoint)][getBucketIndex(latencyNs)];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+
+    if (dumpIntervalMs > 0) {
+        dumpIfIntervalElapsed();
+    }
+}
+
+void ApiLatencyHistograms::dumpIfIntervalElapsed() {
+    auto now = getCurrentTimeMs();
+    auto lastDump = lastDumpTimeMs.load(std::memory_order_relaxed);
+    if (now - lastDump < dumpIntervalMs || !lastDumpTimeMs.compare_exchange_strong(lastDump, now)) {
+        return;
+    }
+    std::ostringstream out;
+    dump(out);
+    PRINT_DEBUG_STRING(true, stdout, "%s", out.str().c_str());
+}
+
+ApiLatencyHistograms::Histogram ApiLatencyHistograms::getHistogram(ApiLatencyEntryPoint entryPoint) const {
+    Histogram merged{};
+    std::lock_guard<std::mutex> lock(registry->mutex);
+    for (const auto &histograms : registry->threadHistograms) {
+        const auto &buckets = histograms->buckets[static_cast<uint32_t>(entryPoint)];
+        for (uint32_t i = 0; i < bucketsCount; i++) {
+            merged[i] += buckets[i].load(std::memory_order_relaxed);
+        }
+    }
+    return merged;
+}
+
+uint64_t ApiLatencyHistograms::getSamplesCount(ApiLatencyEntryPoint entryPoint) const {
+    auto histogram = getHistogram(entryPoint);
+    uint64_t samplesCount = 0u;
+    for (auto count : histogram) {
+        samplesCount += count;
+    }
+    return samplesCount;
+}
+
+uint64_t ApiLatencyHistograms::getPercentileNs(ApiLatencyEntryPoint entryPoint, double percentile) const {
+    return getPercentileNs(getHistogram(entryPoint), percentile);
+}
+
+uint64_t ApiLatencyHistograms::getPercentileNs(const Histogram &histogram, double percentile) {
+    uint64_t samplesCount = 0u;
+    for (auto count : histogram) {
+        samplesCount += count;
+    }
+    if (samplesCount == 0u) {
+        return 0u;
+    }
+
+    auto rank = std::max(uint64_t{1}, static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(samplesCount))));
+    uint64_t accumulated = 0u;
+    for (uint32_t i = 0; i < bucketsCount; i++) {
+        accumulated += histogram[i];
+        if (accumulated >= rank) {
+            return (uint64_t{1} << i) - 1u;
+        }
+    }
+    return std::numeric_limits<uint64_t>::max();
+}
+
+ApiLatencyHistograms::Summary ApiLatencyHistograms::getSummary(ApiLatencyEntryPoint entryPoint) const {
+    // Percentiles are taken from one merged histogram, so they are consistent with its counts
+    Summary summary;
+    summary.histogram = getHistogram(entryPoint);
+    for (auto count : summary.histogram) {
+        summary.samplesCount += count;
+    }
+    summary.p50Ns = getPercentileNs(summary.histogram, 50.0);
+    summary.p90Ns = getPercentileNs(summary.histogram, 90.0);
+    summary.p99Ns = getPercentileNs(summary.histogram, 99.0);
+    summary.maxNs = getPercentileNs(summary.histogram, 100.0);
+    return summary;
+}
+
+void ApiLatencyHistograms::dump(std::ostream &out) const {
+    out << "API latency histograms (sampling rate " << samplingRate << ", upper bounds in ns)" << std::endl;
+    for (uint32_t i = 0; i < entryPointsCount; i++) {
+        auto entryPoint = static_cast<ApiLatencyEntryPoint>(i);
+        auto summary = getSummary(entryPoint);
+        if (summary.samplesCount == 0u) {
+            continue;
+        }
+        out << getEntryPointName(entryPoint) << ": samples " << summary.samplesCount
+            << ", p50 " << summary.p50Ns
+            << ", p90 " << summary.p90Ns
+            << ", p99 " << summary.p99Ns
+            << ", max " << summary.maxNs << std::endl;
+    }
+}
+
+} // namespace NEO
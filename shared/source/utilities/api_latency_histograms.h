@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace NEO {
+
+enum class ApiLatencyEntryPoint : uint32_t {
+    clEnqueueNDRangeKernel = 0,
+    clEnqueueReadBuffer,
+    clEnqueueWriteBuffer,
+    clFinish,
+    clWaitForEvents,
+    zeCommandListAppendLaunchKernel,
+    zeCommandListAppendMemoryCopy,
+    zeCommandQueueExecuteCommandLists,
+    zeCommandQueueSynchronize,
+    zeEventHostSynchronize,
+    count
+};
+
+// Sampled host latency histograms of selected API entry points.
+// Every thread records into its own histograms without locking; readers merge
+// all of them. Histograms of exited threads keep their counts and are reused by
+// new threads. Bucket 0 counts zero latencies and bucket i counts latencies
+// in [2^(i-1), 2^i) ns.
+class ApiLatencyHistograms {
+  public:
+    static constexpr uint32_t bucketsCount = 64u;
+    static constexpr uint32_t entryPointsCount = static_cast<uint32_t>(ApiLatencyEntryPoint::count);
+    using Histogram = std::array<uint64_t, bucketsCount>;
+
+    struct Summary {
+        Histogram histogram{};
+        uint64_t samplesCount = 0u;
+        uint64_t p50Ns = 0u;
+        uint64_t p90Ns = 0u;
+        uint64_t p99Ns = 0u;
+        uint64_t maxNs = 0u;
+    };
+
+    ApiLatencyHistograms(uint32_t samplingRate, int64_t dumpIntervalMs);
+    ~ApiLatencyHistograms();
+
+    // Returns nullptr once the global instance is destroyed at process exit
+    static ApiLatencyHistograms *getGlobal();
+    static const char *getEntryPointName(ApiLatencyEntryPoint entryPoint);
+    static bool getEntryPoint(const char *entryPointName, ApiLatencyEntryPoint &entryPoint);
+    static uint32_t getBucketIndex(uint64_t latencyNs);
+    static uint64_t getPercentileNs(const Histogram &histogram, double percentile);
+
+    bool isEnabled() const { return samplingRate > 0u; }
+    uint32_t getSamplingRate() const { return samplingRate; }
+    bool shouldSampleCall();
+    void record(ApiLatencyEntryPoint entryPoint, uint64_t latencyNs);
+
+    Histogram getHistogram(ApiLatencyEntryPoint entryPoint) const;
+    uint64_t getSamplesCount(ApiLatencyEntryPoint entryPoint) const;
+    uint64_t getPercentileNs(ApiLatencyEntryPoint entryPoint, double percentile) const;
+    Summary getSummary(ApiLatencyEntryPoint entryPoint) const;
+    void dump(std::ostream &out) const;
+
+  protected:
+    struct ThreadHistograms {
+        std::array<std::array<std::atomic<uint64_t>, bucketsCount>, entryPointsCount> buckets{};
+        uint32_t callsSinceLastSample = 0u;
+        bool inUse = true;
+    };
+    // Shared with threads, which return their histograms on exit even if the instance is gone by then
+    struct ThreadHistogramsRegistry {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadHistograms>> threadHistograms;
+    };
+    // Calling thread's histograms of the most recently used instance
+    struct ThreadHistogramsSlot {
+        ~ThreadHistogramsSlot();
+        void release();
+
+        std::weak_ptr<ThreadHistogramsRegistry> registry;
+        ThreadHistograms *histograms = nullptr;
+        uint64_t instanceId = 0;
+    };
+
+    ThreadHistograms &getThreadHistograms();
+    void dumpIfIntervalElapsed();
+
+    static std::atomic<uint64_t> instancesCounter;
+    static thread_local ThreadHistogramsSlot threadHistogramsSlot;
+
+    const uint64_t instanceId;
+    const uint32_t samplingRate;
+    const int64_t dumpIntervalMs;
+    std::atomic<int64_t> lastDumpTimeMs{0};
+
+    std::shared_ptr<ThreadHistogramsRegistry> registry;
+};
+
+class ApiLatencyScope {
+  public:
+    ApiLatencyScope(ApiLatencyEntryPoint entryPoint) : ApiLatencyScope(ApiLatencyHistograms::getGlobal(), entryPoint) {}
+    ApiLatencyScope(ApiLatencyHistograms &histograms, ApiLatencyEntryPoint entryPoint) : ApiLatencyScope(&histograms, entryPoint) {}
+    ApiLatencyScope(ApiLatencyHistograms *histograms, ApiLatencyEntryPoint entryPoint) : histograms(histograms), entryPoint(entryPoint) {
+        sampled = histograms && histograms->isEnabled() && histograms->shouldSampleCall();
+        if (sampled) {
+            start = std::chrono::steady_clock::now();
+        }
+    }
+    ~ApiLatencyScope() {
+        if (sampled) {
+            auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            histograms->record(entryPoint, static_cast<uint64_t>(latency.count()));
+        }
+    }
+    ApiLatencyScope(const ApiLatencyScope &) = delete;
+    ApiLatencyScope &operator=(const ApiLatencyScope &) = delete;
+
+  protected:
+    ApiLatencyHistograms *histograms;
+    std::chrono::steady_clock::time_point start;
+    ApiLatencyEntryPoint entryPoint;
+    bool sampled = false;
+};
+
+} // namespace NEO
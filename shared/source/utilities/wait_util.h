@@ -35,7 +35,7 @@ inline bool monitorWait(volatile void const *monitorAddress, uint64_t counterMod
 }
 
 template <typename T>
-inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedValue, std::function<bool(T, T)> predicate) {
+inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedValue, std::function<bool(T, T)> predicate, bool allowMonitorWait = true) {
     for (uint32_t i = 0; i < waitCount; i++) {
         CpuIntrinsics::pause();
     }
@@ -43,7 +43,7 @@ inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedV
         if (predicate(*pollAddress, expectedValue)) {
             return true;
         }
-        if (waitpkgUse) {
+        if (waitpkgUse && allowMonitorWait) {
             if (monitorWait(pollAddress, 0)) {
                 if (predicate(*pollAddress, expectedValue)) {
                     return true;
@@ -55,8 +55,18 @@ inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedV
     return false;
 }
 
-inline bool waitFunction(volatile TagAddressType *pollAddress, TaskCountType expectedValue) {
-    return waitFunctionWithPredicate<TaskCountType>(pollAddress, expectedValue, std::greater_equal<TaskCountType>());
+inline void waitOnAddress(volatile void const *monitorAddress) {
+    for (uint32_t i = 0; i < waitCount; i++) {
+        CpuIntrinsics::pause();
+    }
+    if (monitorAddress != nullptr && waitpkgUse) {
+        monitorWait(monitorAddress, 0);
+    }
+    std::this_thread::yield();
+}
+
+inline bool waitFunction(volatile TagAddressType *pollAddress, TaskCountType expectedValue, bool allowMonitorWait = true) {
+    return waitFunctionWithPredicate<TaskCountType>(pollAddress, expectedValue, std::greater_equal<TaskCountType>(), allowMonitorWait);
 }
 
 void init();
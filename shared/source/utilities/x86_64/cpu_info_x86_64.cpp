@@ -27,10 +27,17 @@ void CpuInfo::detect() const {
 
     cpuid(cpuInfo, 0u);
     auto numFunctionIds = cpuInfo[eax];
+    bool osSavesAvx512State = false;
     if (numFunctionIds >= processorInfo) {
         cpuid(cpuInfo, processorInfo);
         {
             features |= cpuInfo[edx] & BIT(19) ? featureClflush : featureNone;
+
+            // AVX-512 is usable only when OS enabled XSAVE and saves SSE, AVX, opmask and ZMM state (XCR0)
+            if (cpuInfo[ecx] & BIT(27)) {
+                auto avx512StateMask = BIT(1) | BIT(2) | BIT(5) | BIT(6) | BIT(7);
+                osSavesAvx512State = (xgetbv(0) & avx512StateMask) == avx512StateMask;
+            }
         }
     }
 
@@ -40,6 +47,9 @@ void CpuInfo::detect() const {
             auto mask = BIT(5) | BIT(3) | BIT(8);
             features |= (cpuInfo[ebx] & mask) == mask ? featureAvX2 : featureNone;
 
+            auto avx512Mask = BIT(16) | BIT(30);
+            features |= (osSavesAvx512State && (cpuInfo[ebx] & avx512Mask) == avx512Mask) ? featureAvX512 : featureNone;
+
             features |= (cpuInfo[ecx] & BIT(5)) ? featureWaitPkg : featureNone;
         }
     }
@@ -53,7 +63,7 @@ void CpuInfo::detect() const {
         }
     }
     if (debugManager.flags.PrintCpuFlags.get()) {
-        printf("CPUFlags:\nCLFlush: %d Avx2: %d WaitPkg: %d\nVirtual Address Size %u\n", !!(features & featureClflush), !!(features & featureAvX2), !!(features & featureWaitPkg), virtualAddressSize);
+        printf("CPUFlags:\nCLFlush: %d Avx2: %d Avx512: %d WaitPkg: %d\nVirtual Address Size %u\n", !!(features & featureClflush), !!(features & featureAvX2), !!(features & featureAvX512), !!(features & featureWaitPkg), virtualAddressSize);
     }
 }
 } // namespace NEO
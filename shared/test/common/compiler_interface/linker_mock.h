@@ -38,7 +38,10 @@ template <>
 struct WhiteBox<NEO::Linker> : NEO::Linker {
     using BaseClass = NEO::Linker;
     using BaseClass::BaseClass;
+    using BaseClass::maxPatchingWorkersCount;
+    using BaseClass::minRelocationsPerPatchingWorker;
     using BaseClass::patchDataSegments;
+    using BaseClass::patchingWorkersCount;
     using BaseClass::patchInstructionsSegments;
     using BaseClass::relocatedSymbols;
     using BaseClass::relocateSymbols;
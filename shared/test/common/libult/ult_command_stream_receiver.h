@@ -95,6 +95,7 @@ class UltCommandStreamReceiver : public CommandStreamReceiverHw<GfxFamily>, publ
     using BaseClass::staticWorkPartitioningEnabled;
     using BaseClass::streamProperties;
     using BaseClass::wasSubmittedToSingleSubdevice;
+    using BaseClass::CommandStreamReceiver::adaptiveWaitPolicy;
     using BaseClass::CommandStreamReceiver::activePartitions;
     using BaseClass::CommandStreamReceiver::activePartitionsConfig;
     using BaseClass::CommandStreamReceiver::baseWaitFunction;
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/tbx/tbx_proto.h"
+#include "shared/source/tbx/tbx_sockets_imp.h"
+
+#include <cstring>
+#include <vector>
+
+namespace NEO {
+
+class MockTbxSocketsImp : public TbxSocketsImp {
+  public:
+    using TbxSocketsImp::pendingWriteData;
+    using TbxSocketsImp::pendingWriteDataCapacity;
+    using TbxSocketsImp::socket;
+    using TbxSocketsImp::transID;
+
+    bool sendWriteData(const void *buffer, size_t sizeInBytes) override {
+        auto dataBuffer = static_cast<const char *>(buffer);
+        sentData.emplace_back(dataBuffer, dataBuffer + sizeInBytes);
+        return true;
+    }
+
+    bool getResponseData(void *buffer, size_t sizeInBytes) override {
+        sendsCountAtResponse.push_back(sentData.size());
+        memset(buffer, 0, sizeInBytes);
+        if (sizeInBytes >= sizeof(HasHdr)) {
+            auto hdr = static_cast<HasHdr *>(buffer);
+            hdr->msgType = responseMsgType;
+            hdr->transID = transID - 1;
+        }
+        return true;
+    }
+
+    std::vector<std::vector<char>> sentData;
+    std::vector<size_t> sendsCountAtResponse;
+    uint32_t responseMsgType = HAS_MMIO_RES_TYPE;
+};
+
+} // namespace NEO
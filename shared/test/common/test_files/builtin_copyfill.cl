@@ -132,6 +132,43 @@ __kernel void CopyBufferToBufferMiddleRegion(
     }
 }
 
+__kernel void CopyBufferToBufferMiddleGridStride(
+    const __global uint* pSrc,
+    __global uint* pDst,
+    uint srcOffsetInBytes,
+    uint dstOffsetInBytes,
+    uint elemsToCopy)
+{
+    ALIGNED4(pSrc);
+    ALIGNED4(pDst);
+    pDst += dstOffsetInBytes >> 2;
+    pSrc += srcOffsetInBytes >> 2;
+    const uint stride = get_global_size(0);
+    for (uint idx = get_global_id(0); idx < elemsToCopy; idx += stride) {
+        uint16 loaded = vload16(idx, pSrc);
+        vstore16(loaded, idx, pDst);
+    }
+}
+
+__kernel void CopyBufferToBufferMiddleRegionGridStride(
+    __global uint* pDst,
+    const __global uint* pSrc,
+    unsigned int elems,
+    uint dstSshOffset, // Offset needed in case ptr has been adjusted for SSH alignment
+    uint srcSshOffset // Offset needed in case ptr has been adjusted for SSH alignment
+    )
+{
+    ALIGNED4(pSrc);
+    ALIGNED4(pDst);
+    __global uint* pDstWithOffset = (__global uint*)((__global uchar*)pDst + dstSshOffset);
+    __global uint* pSrcWithOffset = (__global uint*)((__global uchar*)pSrc + srcSshOffset);
+    const uint stride = get_global_size(0);
+    for (uint idx = get_global_id(0); idx < elems; idx += stride) {
+        uint4 loaded = vload4(idx, pSrcWithOffset);
+        vstore4(loaded, idx, pDstWithOffset);
+    }
+}
+
 #define ALIGNED4(ptr) __builtin_assume(((size_t)ptr&0b11) == 0)
 
 // assumption is local work size = pattern size
@@ -220,6 +257,22 @@ __kernel void FillBufferSSHOffset(
     pDst[dstIndex] = pSrc[srcIndex];
 }
 
+__kernel void FillBufferMiddleGridStride(
+    __global uchar* pDst,
+    uint dstOffsetInBytes,
+    const __global uint* pPattern,
+    const uint patternSizeInEls,
+    const uint elemsToFill )
+{
+    ALIGNED4(pDst);
+    ALIGNED4(pPattern);
+    __global uint* pDstWithOffset = (__global uint*)(pDst + dstOffsetInBytes);
+    const uint stride = get_global_size(0);
+    for (uint idx = get_global_id(0); idx < elemsToFill; idx += stride) {
+        pDstWithOffset[idx] = pPattern[ idx & (patternSizeInEls - 1) ];
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 __kernel void CopyBufferRectBytes2d(
     __global const char* src,
@@ -114,6 +114,39 @@ __kernel void CopyBufferToBufferMiddleRegion(
     }
 }
 
+__kernel void CopyBufferToBufferMiddleGridStride(
+    const __global uint* pSrc,
+    __global uint* pDst,
+    ulong srcOffsetInBytes,
+    ulong dstOffsetInBytes,
+    ulong elemsToCopy)
+{
+    pDst += dstOffsetInBytes >> 2;
+    pSrc += srcOffsetInBytes >> 2;
+    const size_t stride = get_global_size(0);
+    for (size_t idx = get_global_id(0); idx < elemsToCopy; idx += stride) {
+        uint16 loaded = vload16(idx, pSrc);
+        vstore16(loaded, idx, pDst);
+    }
+}
+
+__kernel void CopyBufferToBufferMiddleRegionGridStride(
+    __global uint* pDst,
+    const __global uint* pSrc,
+    ulong elems,
+    ulong dstSshOffset, // Offset needed in case ptr has been adjusted for SSH alignment
+    ulong srcSshOffset // Offset needed in case ptr has been adjusted for SSH alignment
+    )
+{
+    __global uint* pDstWithOffset = (__global uint*)((__global uchar*)pDst + dstSshOffset);
+    __global uint* pSrcWithOffset = (__global uint*)((__global uchar*)pSrc + srcSshOffset);
+    const size_t stride = get_global_size(0);
+    for (size_t idx = get_global_id(0); idx < elems; idx += stride) {
+        uint4 loaded = vload4(idx, pSrcWithOffset);
+        vstore4(loaded, idx, pDstWithOffset);
+    }
+}
+
 // assumption is local work size = pattern size
 __kernel void FillBufferBytes(
     __global uchar* pDst,
@@ -188,6 +221,20 @@ __kernel void FillBufferSSHOffset(
     pDst[dstIndex] = pSrc[srcIndex];
 }
 
+__kernel void FillBufferMiddleGridStride(
+    __global uchar* pDst,
+    ulong dstOffsetInBytes,
+    const __global uint* pPattern,
+    const ulong patternSizeInEls,
+    const ulong elemsToFill )
+{
+    __global uint* pDstWithOffset = (__global uint*)(pDst + dstOffsetInBytes);
+    const size_t stride = get_global_size(0);
+    for (size_t idx = get_global_id(0); idx < elemsToFill; idx += stride) {
+        pDstWithOffset[idx] = pPattern[ idx & (patternSizeInEls - 1) ];
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 __kernel void CopyBufferRectBytes2d(
     __global const char* src,
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/built_ins/buffer_builtin_variant.h"
+#include "shared/source/helpers/hw_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/test_macros/test.h"
+
+using namespace NEO;
+
+TEST(BufferBuiltinVariantTest, givenDefaultSettingsWhenSelectingVariantThenSplitVariantIsReturned) {
+    EXPECT_EQ(BufferBuiltinVariant::split, BufferBuiltinVariantHelper::selectVariant(MemoryConstants::gigaByte));
+}
+
+TEST(BufferBuiltinVariantTest, givenGridStrideBuiltinsEnabledWhenSelectingVariantThenGridStrideIsReturnedFromDefaultThreshold) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableGridStrideBufferBuiltins.set(1);
+
+    EXPECT_EQ(BufferBuiltinVariant::split, BufferBuiltinVariantHelper::selectVariant(BufferBuiltinVariantHelper::defaultGridStrideThreshold - 1));
+    EXPECT_EQ(BufferBuiltinVariant::gridStride, BufferBuiltinVariantHelper::selectVariant(BufferBuiltinVariantHelper::defaultGridStrideThreshold));
+}
+
+TEST(BufferBuiltinVariantTest, givenGridStrideThresholdSetWhenSelectingVariantThenThresholdIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableGridStrideBufferBuiltins.set(1);
+    debugManager.flags.BufferBuiltinGridStrideThreshold.set(4096);
+
+    EXPECT_EQ(BufferBuiltinVariant::split, BufferBuiltinVariantHelper::selectVariant(4095));
+    EXPECT_EQ(BufferBuiltinVariant::gridStride, BufferBuiltinVariantHelper::selectVariant(4096));
+
+    debugManager.flags.BufferBuiltinGridStrideThreshold.set(0);
+    EXPECT_EQ(BufferBuiltinVariant::gridStride, BufferBuiltinVariantHelper::selectVariant(1));
+}
+
+TEST(BufferBuiltinVariantTest, givenElementsCountWhenGettingGridStrideWorkItemsCountThenItIsLimitedByDeviceThreads) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.gtSystemInfo.ThreadCount = 64;
+
+    EXPECT_EQ(100u, BufferBuiltinVariantHelper::getGridStrideWorkItemsCount(100u, 16u, hwInfo));
+    EXPECT_EQ(64u * 16u, BufferBuiltinVariantHelper::getGridStrideWorkItemsCount(MemoryConstants::megaByte, 16u, hwInfo));
+
+    hwInfo.gtSystemInfo.ThreadCount = 0;
+    EXPECT_EQ(32u, BufferBuiltinVariantHelper::getGridStrideWorkItemsCount(MemoryConstants::megaByte, 32u, hwInfo));
+}
@@ -31,8 +31,11 @@
 #include "gtest/gtest.h"
 #include "sys_calls.h"
 
+#include <cstdio>
 #include <fstream>
+#include <iterator>
 #include <memory>
+#include <vector>
 
 using namespace NEO;
 
@@ -1023,3 +1026,34 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWithAubManagerWhenInit
 
     EXPECT_EQ(expectedAddedComments, mockAubManager->receivedComments);
 }
+
+TEST(AubFileStreamAsyncWriterTest, givenAsyncWriterEnabledWhenRecordsAreWrittenThenFileContainsThemInSubmissionOrder) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.AUBDumpAsyncWriterBufferSizeInKb.set(1);
+
+    std::string fileName = "async_writer_file_name.aub";
+    std::vector<char> expectedContents;
+    {
+        AubMemDump::AubFileStream aubFileStream;
+        aubFileStream.open(fileName.c_str());
+        ASSERT_TRUE(aubFileStream.isOpen());
+        EXPECT_TRUE(aubFileStream.asyncWriterThread.joinable());
+
+        for (size_t recordSize : {100u, 600u, 400u, 3000u, 8u, 1000u}) {
+            std::vector<char> record(recordSize, static_cast<char>(recordSize & 0xff));
+            aubFileStream.write(record.data(), record.size());
+            expectedContents.insert(expectedContents.end(), record.begin(), record.end());
+        }
+        EXPECT_TRUE(aubFileStream.isOpen());
+        aubFileStream.close();
+        EXPECT_FALSE(aubFileStream.asyncWriterThread.joinable());
+        EXPECT_FALSE(aubFileStream.isOpen());
+    }
+
+    std::ifstream file(fileName, std::ios::binary);
+    std::vector<char> fileContents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(fileName.c_str());
+
+    EXPECT_EQ(expectedContents, fileContents);
+}
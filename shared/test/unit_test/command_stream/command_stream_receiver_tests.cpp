@@ -5506,6 +5506,90 @@ HWTEST_F(CommandStreamReceiverTest, givenCsrWhenGetAcLineConnectedCalledThenCorr
     EXPECT_TRUE(csr.getAcLineConnected(false));
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenAdaptiveWaitPolicyDisabledByDefaultWhenCreatingCsrThenPolicyIsNotCreated) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    EXPECT_EQ(nullptr, csr.getAdaptiveWaitPolicy());
+}
+
+HWTEST_F(CommandStreamReceiverTest, givenAdaptiveWaitPolicyEnabledWhenWaitingForTaskCountThenWaitIsRecordedInPolicy) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableAdaptiveWaitPolicy.set(1);
+
+    MockOsContext mockOsContext(0, EngineDescriptorHelper::getDefaultDescriptor({defaultHwInfo->capabilityTable.defaultEngineType, EngineUsage::regular}));
+    UltCommandStreamReceiver<FamilyType> csr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    csr.setupContext(mockOsContext);
+    csr.initializeTagAllocation();
+    ASSERT_NE(nullptr, csr.getAdaptiveWaitPolicy());
+
+    *csr.getTagAddress() = 2;
+    csr.latestFlushedTaskCount = 2;
+    EXPECT_EQ(WaitStatus::ready, csr.waitForTaskCountWithKmdNotifyFallback(2, 0, false, QueueThrottle::MEDIUM));
+    EXPECT_FALSE(csr.latestWaitForCompletionWithTimeoutWaitParams.allowMonitorWait);
+
+    auto counters = csr.getAdaptiveWaitPolicy()->getCounters();
+    EXPECT_EQ(1u, counters.waitsPerMode[static_cast<uint32_t>(AdaptiveWaitMode::spin)]);
+    EXPECT_TRUE(csr.getAdaptiveWaitPolicy()->hasSamples(0));
+    EXPECT_LE(counters.busyPollTimeMicroseconds, counters.wallTimeMicroseconds);
+}
+
+HWTEST_F(CommandStreamReceiverTest, givenAdaptiveWaitPolicyWithLongLatencyLearnedWhenWaitingForTaskCountThenKmdWaitModeIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableAdaptiveWaitPolicy.set(1);
+
+    MockOsContext mockOsContext(0, EngineDescriptorHelper::getDefaultDescriptor({defaultHwInfo->capabilityTable.defaultEngineType, EngineUsage::regular}));
+    UltCommandStreamReceiver<FamilyType> csr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    csr.setupContext(mockOsContext);
+    csr.initializeTagAllocation();
+    csr.adaptiveWaitPolicy->recordWait(0, AdaptiveWaitMode::spin, 10 * AdaptiveWaitPolicy::monitorWaitLatencyThresholdMicroseconds, 0);
+
+    *csr.getTagAddress() = 2;
+    csr.latestFlushedTaskCount = 2;
+    EXPECT_EQ(WaitStatus::ready, csr.waitForTaskCountWithKmdNotifyFallback(2, 1, false, QueueThrottle::MEDIUM));
+    EXPECT_TRUE(csr.latestWaitForCompletionWithTimeoutWaitParams.allowMonitorWait);
+    EXPECT_TRUE(csr.latestWaitForCompletionWithTimeoutWaitParams.enableTimeout);
+    EXPECT_EQ(0, csr.latestWaitForCompletionWithTimeoutWaitParams.waitTimeout);
+
+    auto counters = csr.getAdaptiveWaitPolicy()->getCounters();
+    EXPECT_EQ(1u, counters.waitsPerMode[static_cast<uint32_t>(AdaptiveWaitMode::kmdWait)]);
+}
+
+HWTEST_F(CommandStreamReceiverTest, givenAdaptiveWaitPolicyWithLongLatencyLearnedAndNoFlushStampWhenWaitingForTaskCountThenMonitorWaitModeIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableAdaptiveWaitPolicy.set(1);
+
+    MockOsContext mockOsContext(0, EngineDescriptorHelper::getDefaultDescriptor({defaultHwInfo->capabilityTable.defaultEngineType, EngineUsage::regular}));
+    UltCommandStreamReceiver<FamilyType> csr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    csr.setupContext(mockOsContext);
+    csr.initializeTagAllocation();
+    csr.adaptiveWaitPolicy->recordWait(0, AdaptiveWaitMode::spin, 10 * AdaptiveWaitPolicy::monitorWaitLatencyThresholdMicroseconds, 0);
+
+    *csr.getTagAddress() = 2;
+    csr.latestFlushedTaskCount = 2;
+    EXPECT_EQ(WaitStatus::ready, csr.waitForTaskCountWithKmdNotifyFallback(2, 0, false, QueueThrottle::MEDIUM));
+    EXPECT_TRUE(csr.latestWaitForCompletionWithTimeoutWaitParams.allowMonitorWait);
+
+    auto counters = csr.getAdaptiveWaitPolicy()->getCounters();
+    EXPECT_EQ(1u, counters.waitsPerMode[static_cast<uint32_t>(AdaptiveWaitMode::monitorWait)]);
+    EXPECT_EQ(0u, counters.waitsPerMode[static_cast<uint32_t>(AdaptiveWaitMode::kmdWait)]);
+}
+
+HWTEST_F(CommandStreamReceiverTest, givenPrintAdaptiveWaitStatisticsEnabledWhenDestroyingCsrThenAdaptiveWaitCountersArePrinted) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableAdaptiveWaitPolicy.set(1);
+    debugManager.flags.PrintAdaptiveWaitStatistics.set(1);
+
+    auto csr = std::make_unique<UltCommandStreamReceiver<FamilyType>>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    ASSERT_NE(nullptr, csr->getAdaptiveWaitPolicy());
+    csr->adaptiveWaitPolicy->recordWait(0, AdaptiveWaitMode::spin, 10, 4);
+    csr->adaptiveWaitPolicy->recordWait(3, AdaptiveWaitMode::kmdWait, 1000, 0);
+
+    testing::internal::CaptureStdout();
+    csr.reset();
+    std::string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_TRUE(hasSubstr(output, std::string("adaptive waits spin: 1, monitor wait: 0, kmd wait: 1, busy poll time: 4 us, wall time: 1010 us\n")));
+}
+
 HWTEST_F(CommandStreamReceiverTest, givenBcsCsrWhenInitializeDeviceWithFirstSubmissionIsCalledThenSuccessIsReturned) {
     MockOsContext mockOsContext(0, EngineDescriptorHelper::getDefaultDescriptor({aub_stream::EngineType::ENGINE_BCS, EngineUsage::regular}));
     MockCsrHw<FamilyType> commandStreamReceiver(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
@@ -1611,3 +1611,34 @@ TEST(StreamPropertiesTests, givenDynamicStateStateBaseAddressPropertyWhenCopying
     EXPECT_EQ(4, sbaProperties.dynamicStateBaseAddress.value);
     EXPECT_EQ(2u, sbaProperties.dynamicStateSize.value);
 }
+
+TEST(StreamPropertiesTests, givenStreamPropertiesWhenComparingStateThenValuesAndDirtyFlagsAreTakenIntoAccount) {
+    MockExecutionEnvironment executionEnvironment{};
+    auto &rootDeviceEnvironment = *executionEnvironment.rootDeviceEnvironments[0];
+
+    StreamProperties streamProperties{};
+    streamProperties.initSupport(rootDeviceEnvironment);
+    streamProperties.pipelineSelect.setPropertiesAll(true, false, false);
+    streamProperties.stateBaseAddress.setPropertiesDynamicState(2, 3);
+
+    StreamProperties streamPropertiesCopy = streamProperties;
+    EXPECT_TRUE(streamProperties.isSameState(streamPropertiesCopy));
+
+    streamPropertiesCopy.pipelineSelect.clearIsDirty();
+    EXPECT_FALSE(streamProperties.isSameState(streamPropertiesCopy));
+    streamProperties.pipelineSelect.clearIsDirty();
+    EXPECT_TRUE(streamProperties.isSameState(streamPropertiesCopy));
+
+    streamPropertiesCopy.stateBaseAddress.dynamicStateSize.set(4);
+    EXPECT_FALSE(streamProperties.isSameState(streamPropertiesCopy));
+    streamPropertiesCopy.stateBaseAddress.dynamicStateSize.set(3);
+    EXPECT_TRUE(streamProperties.isSameState(streamPropertiesCopy));
+
+    streamPropertiesCopy.frontEndState.disableEUFusion.set(1);
+    EXPECT_FALSE(streamProperties.isSameState(streamPropertiesCopy));
+    streamProperties.frontEndState.disableEUFusion.set(1);
+    EXPECT_TRUE(streamProperties.isSameState(streamPropertiesCopy));
+
+    streamPropertiesCopy.stateComputeMode.largeGrfMode.set(1);
+    EXPECT_FALSE(streamProperties.isSameState(streamPropertiesCopy));
+}
@@ -221,6 +221,99 @@ HWTEST_F(TbxCommandStreamTests, givenTbxCommandStreamReceiverWhenWriteMemoryIsCa
     memoryManager->freeGraphicsMemory(graphicsAllocation);
 }
 
+HWTEST_F(TbxCommandStreamTests, givenTbxDirtyPageTrackingEnabledWhenWriteMemoryIsCalledRepeatedlyThenOnlyChangedPagesAreUploaded) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableTbxDirtyPageTracking.set(1);
+
+    MockTbxCsr<FamilyType> tbxCsr(*pDevice->executionEnvironment, pDevice->getDeviceBitfield());
+    MockOsContext osContext(0, EngineDescriptorHelper::getDefaultDescriptor(pDevice->getDeviceBitfield()));
+    tbxCsr.setupContext(osContext);
+    tbxCsr.initializeEngine();
+    auto mockManager = reinterpret_cast<MockAubManager *>(pDevice->executionEnvironment->rootDeviceEnvironments[0]->aubCenter->getAubManager());
+    mockManager->storeAllocationParams = true;
+
+    constexpr size_t allocationSize = 4 * MemoryConstants::pageSize;
+    auto hostMemory = std::make_unique<uint8_t[]>(allocationSize);
+    memset(hostMemory.get(), 0, allocationSize);
+    MockGraphicsAllocation allocation(hostMemory.get(), allocationSize);
+
+    EXPECT_TRUE(tbxCsr.writeMemory(allocation));
+    ASSERT_EQ(1u, mockManager->storedAllocationParams.size());
+    EXPECT_EQ(allocation.getGpuAddress(), mockManager->storedAllocationParams[0].gfxAddress);
+    EXPECT_EQ(allocationSize, mockManager->storedAllocationParams[0].size);
+
+    mockManager->storedAllocationParams.clear();
+    EXPECT_TRUE(tbxCsr.writeMemory(allocation));
+    EXPECT_EQ(0u, mockManager->storedAllocationParams.size());
+
+    hostMemory[MemoryConstants::pageSize + 1] = 1;
+    hostMemory[2 * MemoryConstants::pageSize] = 1;
+    hostMemory[allocationSize - 1] = 1;
+    EXPECT_TRUE(tbxCsr.writeMemory(allocation));
+    ASSERT_EQ(2u, mockManager->storedAllocationParams.size());
+    EXPECT_EQ(allocation.getGpuAddress() + MemoryConstants::pageSize, mockManager->storedAllocationParams[0].gfxAddress);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, mockManager->storedAllocationParams[0].size);
+    EXPECT_EQ(allocation.getGpuAddress() + 3 * MemoryConstants::pageSize, mockManager->storedAllocationParams[1].gfxAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, mockManager->storedAllocationParams[1].size);
+
+    mockManager->storedAllocationParams.clear();
+    tbxCsr.removeDownloadAllocation(&allocation);
+    EXPECT_TRUE(tbxCsr.writeMemory(allocation));
+    ASSERT_EQ(1u, mockManager->storedAllocationParams.size());
+    EXPECT_EQ(allocationSize, mockManager->storedAllocationParams[0].size);
+}
+
+HWTEST_F(TbxCommandStreamTests, givenTbxDirtyPageTrackingEnabledWhenAllocationIsWrittenByAnotherCsrThenWholeAllocationIsUploadedAgain) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableTbxDirtyPageTracking.set(1);
+
+    MockTbxCsr<FamilyType> tbxCsr0(*pDevice->executionEnvironment, pDevice->getDeviceBitfield());
+    MockOsContext osContext0(0, EngineDescriptorHelper::getDefaultDescriptor(pDevice->getDeviceBitfield()));
+    tbxCsr0.setupContext(osContext0);
+    tbxCsr0.initializeEngine();
+
+    MockTbxCsr<FamilyType> tbxCsr1(*pDevice->executionEnvironment, pDevice->getDeviceBitfield());
+    MockOsContext osContext1(1, EngineDescriptorHelper::getDefaultDescriptor(pDevice->getDeviceBitfield()));
+    tbxCsr1.setupContext(osContext1);
+    tbxCsr1.initializeEngine();
+
+    auto mockManager = reinterpret_cast<MockAubManager *>(pDevice->executionEnvironment->rootDeviceEnvironments[0]->aubCenter->getAubManager());
+    mockManager->storeAllocationParams = true;
+
+    constexpr size_t allocationSize = 2 * MemoryConstants::pageSize;
+    auto hostMemory = std::make_unique<uint8_t[]>(allocationSize);
+    memset(hostMemory.get(), 0, allocationSize);
+    MockGraphicsAllocation allocation(hostMemory.get(), allocationSize);
+
+    EXPECT_TRUE(tbxCsr0.writeMemory(allocation));
+    EXPECT_TRUE(tbxCsr0.writeMemory(allocation));
+    ASSERT_EQ(1u, mockManager->storedAllocationParams.size());
+
+    mockManager->storedAllocationParams.clear();
+    EXPECT_TRUE(tbxCsr1.writeMemory(allocation));
+    ASSERT_EQ(1u, mockManager->storedAllocationParams.size());
+    EXPECT_EQ(allocationSize, mockManager->storedAllocationParams[0].size);
+
+    mockManager->storedAllocationParams.clear();
+    EXPECT_TRUE(tbxCsr0.writeMemory(allocation));
+    ASSERT_EQ(1u, mockManager->storedAllocationParams.size());
+    EXPECT_EQ(allocationSize, mockManager->storedAllocationParams[0].size);
+
+    mockManager->storedAllocationParams.clear();
+    tbxCsr1.downloadAllocationTbx(allocation);
+    hostMemory[MemoryConstants::pageSize] = 1;
+    EXPECT_TRUE(tbxCsr1.writeMemory(allocation));
+    ASSERT_EQ(1u, mockManager->storedAllocationParams.size());
+    EXPECT_EQ(allocation.getGpuAddress() + MemoryConstants::pageSize, mockManager->storedAllocationParams[0].gfxAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, mockManager->storedAllocationParams[0].size);
+
+    mockManager->storedAllocationParams.clear();
+    tbxCsr0.removeDownloadAllocation(&allocation);
+    EXPECT_TRUE(tbxCsr1.writeMemory(allocation));
+    ASSERT_EQ(1u, mockManager->storedAllocationParams.size());
+    EXPECT_EQ(allocationSize, mockManager->storedAllocationParams[0].size);
+}
+
 HWTEST_F(TbxCommandStreamTests, givenTbxCommandStreamReceiverWhenWriteMemoryIsCalledForGraphicsAllocationWithZeroSizeThenItShouldReturnFalse) {
     TbxCommandStreamReceiverHw<FamilyType> *tbxCsr = (TbxCommandStreamReceiverHw<FamilyType> *)pCommandStreamReceiver;
     tbxCsr->initializeEngine();
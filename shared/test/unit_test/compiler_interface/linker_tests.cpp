@@ -1127,6 +1127,171 @@ HWTEST_F(LinkerTests, givenValidSymbolsAndRelocationsThenInstructionSegmentsAreP
     EXPECT_EQ(kd.kernelAttributes.crossThreadDataSize, perThreadPayloadOffsetPatchedValue);
 }
 
+HWTEST_F(LinkerTests, givenParallelInstructionSegmentsPatchingEnabledWhenLinkingThenAllSegmentsArePatchedAndUnresolvedExternalsAreReportedInSegmentOrder) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableParallelInstructionSegmentsPatching.set(1);
+
+    NEO::LinkerInput linkerInput;
+
+    vISA::GenSymEntry symGlobalVariable = {};
+    symGlobalVariable.s_name[0] = 'A';
+    symGlobalVariable.s_offset = 4;
+    symGlobalVariable.s_size = 16;
+    symGlobalVariable.s_type = vISA::GenSymType::S_GLOBAL_VAR;
+    EXPECT_TRUE(linkerInput.decodeGlobalVariablesSymbolTable(&symGlobalVariable, 1));
+
+    vISA::GenRelocEntry relocA = {};
+    relocA.r_symbol[0] = 'A';
+    relocA.r_offset = 0;
+    relocA.r_type = vISA::GenRelocType::R_SYM_ADDR;
+
+    vISA::GenRelocEntry relocUnresolved = {};
+    relocUnresolved.r_symbol[0] = 'U';
+    relocUnresolved.r_offset = 8;
+    relocUnresolved.r_type = vISA::GenRelocType::R_SYM_ADDR;
+
+    constexpr uint32_t numSegments = 4;
+    vISA::GenRelocEntry relocs[] = {relocA, relocUnresolved};
+    for (uint32_t segId = 0; segId < numSegments; segId++) {
+        EXPECT_TRUE(linkerInput.decodeRelocationTable(&relocs, 2, segId));
+    }
+
+    WhiteBox<NEO::Linker> linker(linkerInput);
+    linker.minRelocationsPerPatchingWorker = 1u;
+    linker.maxPatchingWorkersCount = numSegments;
+    NEO::Linker::SegmentInfo globalVarSegment, globalConstSegment, exportedFuncSegment;
+    globalVarSegment.gpuAddress = 8;
+    globalVarSegment.segmentSize = 64;
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+
+    uint32_t initData = 0x77777777;
+    std::vector<std::vector<char>> instructionSegments(numSegments, std::vector<char>(64, static_cast<char>(initData)));
+    NEO::Linker::PatchableSegments patchableInstructionSegments(numSegments);
+    NEO::Linker::KernelDescriptorsT kernelDescriptors(numSegments);
+    KernelDescriptor kd;
+    for (uint32_t segId = 0; segId < numSegments; segId++) {
+        patchableInstructionSegments[segId].hostPointer = instructionSegments[segId].data();
+        patchableInstructionSegments[segId].segmentSize = instructionSegments[segId].size();
+        kernelDescriptors[segId] = &kd;
+    }
+
+    NEO::GraphicsAllocation *patchableGlobalVarSeg = nullptr;
+    NEO::GraphicsAllocation *patchableConstVarSeg = nullptr;
+    NEO::Linker::ExternalFunctionsT externalFunctions;
+
+    auto linkResult = linker.link(
+        globalVarSegment, globalConstSegment, exportedFuncSegment, {},
+        patchableGlobalVarSeg, patchableConstVarSeg, patchableInstructionSegments, unresolvedExternals,
+        pDevice, nullptr, 0, nullptr, 0, kernelDescriptors, externalFunctions);
+    EXPECT_EQ(NEO::LinkingStatus::linkedPartially, linkResult);
+    EXPECT_EQ(numSegments, linker.patchingWorkersCount);
+
+    auto expectedAddress = static_cast<uintptr_t>(globalVarSegment.gpuAddress + symGlobalVariable.s_offset);
+    ASSERT_EQ(numSegments, unresolvedExternals.size());
+    for (uint32_t segId = 0; segId < numSegments; segId++) {
+        EXPECT_EQ(expectedAddress, *reinterpret_cast<const uintptr_t *>(instructionSegments[segId].data() + relocA.r_offset));
+        EXPECT_EQ(initData, *reinterpret_cast<const uint32_t *>(instructionSegments[segId].data() + relocUnresolved.r_offset));
+
+        EXPECT_EQ(segId, unresolvedExternals[segId].instructionsSegmentId);
+        EXPECT_FALSE(unresolvedExternals[segId].internalError);
+        EXPECT_EQ(relocUnresolved.r_offset, unresolvedExternals[segId].unresolvedRelocation.offset);
+        EXPECT_EQ(std::string(relocUnresolved.r_symbol), std::string(unresolvedExternals[segId].unresolvedRelocation.symbolName));
+    }
+}
+
+TEST_F(LinkerTests, givenParallelInstructionSegmentsPatchingEnabledAndFewRelocationsWhenPatchingInstructionSegmentsThenSegmentsArePatchedOnCallingThread) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableParallelInstructionSegmentsPatching.set(1);
+
+    constexpr uint32_t numSegments = 4;
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    linkerInput.traits.requiresPatchingOfInstructionSegments = true;
+    NEO::LinkerInput::RelocationInfo rela;
+    rela.offset = 0U;
+    rela.type = NEO::LinkerInput::RelocationInfo::Type::address;
+    rela.relocationSegment = NEO::SegmentType::instructions;
+    linkerInput.textRelocations.resize(numSegments, {rela});
+
+    WhiteBox<NEO::Linker> linker(linkerInput);
+    linker.maxPatchingWorkersCount = numSegments;
+    std::vector<uint64_t> instructionSegments(numSegments, 0u);
+    NEO::Linker::PatchableSegments patchableInstructionSegments(numSegments);
+    for (uint32_t segId = 0; segId < numSegments; segId++) {
+        patchableInstructionSegments[segId].hostPointer = &instructionSegments[segId];
+        patchableInstructionSegments[segId].segmentSize = sizeof(uint64_t);
+    }
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+
+    linker.patchInstructionsSegments(patchableInstructionSegments, unresolvedExternals, kernelDescriptors);
+    EXPECT_EQ(1u, linker.patchingWorkersCount);
+    EXPECT_TRUE(unresolvedExternals.empty());
+
+    linker.minRelocationsPerPatchingWorker = 2u;
+    linker.patchInstructionsSegments(patchableInstructionSegments, unresolvedExternals, kernelDescriptors);
+    EXPECT_EQ(numSegments / 2, linker.patchingWorkersCount);
+    EXPECT_TRUE(unresolvedExternals.empty());
+}
+
+TEST_F(LinkerTests, givenParallelInstructionSegmentsPatchingWhenPatchingSegmentFailsOnWorkerThreadThenExceptionIsPropagatedToCallingThread) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableParallelInstructionSegmentsPatching.set(1);
+
+    constexpr uint32_t numSegments = 4;
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    linkerInput.traits.requiresPatchingOfInstructionSegments = true;
+    NEO::LinkerInput::RelocationInfo rela;
+    rela.offset = 0U;
+    rela.type = NEO::LinkerInput::RelocationInfo::Type::perThreadPayloadOffset;
+    rela.relocationSegment = NEO::SegmentType::instructions;
+    linkerInput.textRelocations.resize(numSegments, {rela});
+
+    WhiteBox<NEO::Linker> linker(linkerInput);
+    linker.minRelocationsPerPatchingWorker = 1u;
+    linker.maxPatchingWorkersCount = numSegments;
+    std::vector<uint32_t> instructionSegments(numSegments, 0u);
+    NEO::Linker::PatchableSegments patchableInstructionSegments(numSegments);
+    for (uint32_t segId = 0; segId < numSegments; segId++) {
+        patchableInstructionSegments[segId].hostPointer = &instructionSegments[segId];
+        patchableInstructionSegments[segId].segmentSize = sizeof(uint32_t);
+    }
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    KernelDescriptor kd;
+    NEO::Linker::KernelDescriptorsT kernelDescriptors = {&kd};
+
+    EXPECT_THROW(linker.patchInstructionsSegments(patchableInstructionSegments, unresolvedExternals, kernelDescriptors), std::out_of_range);
+    EXPECT_EQ(numSegments, linker.patchingWorkersCount);
+}
+
+TEST_F(LinkerTests, givenParallelInstructionSegmentsPatchingAndSegmentWithoutHostPointerWhenPatchingInstructionSegmentsThenAbortIsCalledOnCallingThread) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableParallelInstructionSegmentsPatching.set(1);
+
+    constexpr uint32_t numSegments = 4;
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    linkerInput.traits.requiresPatchingOfInstructionSegments = true;
+    NEO::LinkerInput::RelocationInfo rela;
+    rela.offset = 0U;
+    rela.type = NEO::LinkerInput::RelocationInfo::Type::address;
+    rela.relocationSegment = NEO::SegmentType::instructions;
+    linkerInput.textRelocations.resize(numSegments, {rela});
+
+    WhiteBox<NEO::Linker> linker(linkerInput);
+    linker.minRelocationsPerPatchingWorker = 1u;
+    linker.maxPatchingWorkersCount = numSegments;
+    std::vector<uint64_t> instructionSegments(numSegments, 0u);
+    NEO::Linker::PatchableSegments patchableInstructionSegments(numSegments);
+    for (uint32_t segId = 0; segId < numSegments - 1; segId++) {
+        patchableInstructionSegments[segId].hostPointer = &instructionSegments[segId];
+        patchableInstructionSegments[segId].segmentSize = sizeof(uint64_t);
+    }
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+
+    EXPECT_THROW(linker.patchInstructionsSegments(patchableInstructionSegments, unresolvedExternals, kernelDescriptors), std::exception);
+    EXPECT_EQ(0u, instructionSegments[0]);
+}
+
 HWTEST_F(LinkerTests, givenInvalidSymbolOffsetWhenPatchingInstructionsThenRelocationFails) {
     NEO::LinkerInput linkerInput;
 
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/adaptive_wait_policy.h"
+#include "shared/test/common/test_macros/test.h"
+
+using namespace NEO;
+
+TEST(AdaptiveWaitPolicyTest, givenOutstandingTaskCountsWhenGettingBucketThenBucketGrowsWithNumberOfOutstandingTaskCounts) {
+    EXPECT_EQ(0u, AdaptiveWaitPolicy::getBucket(10, 10));
+    EXPECT_EQ(0u, AdaptiveWaitPolicy::getBucket(10, 11));
+    EXPECT_EQ(1u, AdaptiveWaitPolicy::getBucket(10, 12));
+    EXPECT_EQ(1u, AdaptiveWaitPolicy::getBucket(10, 13));
+    EXPECT_EQ(2u, AdaptiveWaitPolicy::getBucket(10, 14));
+    EXPECT_EQ(2u, AdaptiveWaitPolicy::getBucket(10, 17));
+    EXPECT_EQ(3u, AdaptiveWaitPolicy::getBucket(10, 18));
+    EXPECT_EQ(3u, AdaptiveWaitPolicy::getBucket(10, 1000));
+}
+
+TEST(AdaptiveWaitPolicyTest, givenNoSamplesWhenSelectingModeThenSpinIsSelectedAndTimeoutIsNotChanged) {
+    AdaptiveWaitPolicy policy;
+    EXPECT_FALSE(policy.hasSamples(0));
+    auto mode = policy.selectMode(0, true);
+    EXPECT_EQ(AdaptiveWaitMode::spin, mode);
+
+    WaitParams params{false, true, false, 1};
+    policy.adjustWaitParams(mode, 0, params);
+    EXPECT_FALSE(params.allowMonitorWait);
+    EXPECT_EQ(1, params.waitTimeout);
+}
+
+TEST(AdaptiveWaitPolicyTest, givenRecordedLatenciesWhenSelectingModeThenModeMatchesPredictedLatency) {
+    AdaptiveWaitPolicy policy;
+    policy.recordWait(0, AdaptiveWaitMode::spin, AdaptiveWaitPolicy::spinLatencyThresholdMicroseconds, 0);
+    policy.recordWait(1, AdaptiveWaitMode::spin, AdaptiveWaitPolicy::monitorWaitLatencyThresholdMicroseconds, 0);
+    policy.recordWait(2, AdaptiveWaitMode::spin, AdaptiveWaitPolicy::monitorWaitLatencyThresholdMicroseconds + 1, 0);
+
+    EXPECT_EQ(AdaptiveWaitMode::spin, policy.selectMode(0, true));
+    EXPECT_EQ(AdaptiveWaitMode::monitorWait, policy.selectMode(1, true));
+    EXPECT_EQ(AdaptiveWaitMode::kmdWait, policy.selectMode(2, true));
+    EXPECT_EQ(AdaptiveWaitMode::spin, policy.selectMode(3, true));
+}
+
+TEST(AdaptiveWaitPolicyTest, givenLongPredictedLatencyAndKmdWaitNotAvailableWhenSelectingModeThenMonitorWaitIsSelected) {
+    AdaptiveWaitPolicy policy;
+    policy.recordWait(0, AdaptiveWaitMode::spin, AdaptiveWaitPolicy::spinLatencyThresholdMicroseconds, 0);
+    policy.recordWait(1, AdaptiveWaitMode::spin, 10 * AdaptiveWaitPolicy::monitorWaitLatencyThresholdMicroseconds, 0);
+
+    EXPECT_EQ(AdaptiveWaitMode::spin, policy.selectMode(0, false));
+    EXPECT_EQ(AdaptiveWaitMode::monitorWait, policy.selectMode(1, false));
+}
+
+TEST(AdaptiveWaitPolicyTest, givenFirstSampleWhenRecordingWaitThenItIsTakenAsIsAndNextSamplesAreAveraged) {
+    AdaptiveWaitPolicy policy;
+    policy.recordWait(0, AdaptiveWaitMode::spin, 800, 0);
+    EXPECT_EQ(800, policy.getPredictedLatency(0));
+
+    policy.recordWait(0, AdaptiveWaitMode::kmdWait, 0, 0);
+    EXPECT_EQ(700, policy.getPredictedLatency(0));
+
+    policy.recordWait(0, AdaptiveWaitMode::kmdWait, 1500, 0);
+    EXPECT_EQ(800, policy.getPredictedLatency(0));
+}
+
+TEST(AdaptiveWaitPolicyTest, givenKmdWaitModeWhenAdjustingParamsWithTimeoutEnabledThenKmdWaitIsStartedImmediately) {
+    AdaptiveWaitPolicy policy;
+    policy.recordWait(0, AdaptiveWaitMode::spin, 10 * AdaptiveWaitPolicy::monitorWaitLatencyThresholdMicroseconds, 0);
+
+    WaitParams params{false, true, false, 1000};
+    policy.adjustWaitParams(AdaptiveWaitMode::kmdWait, 0, params);
+    EXPECT_TRUE(params.allowMonitorWait);
+    EXPECT_EQ(0, params.waitTimeout);
+}
+
+TEST(AdaptiveWaitPolicyTest, givenMonitorWaitModeWhenAdjustingParamsWithTimeoutEnabledThenTimeoutCoversPredictedLatency) {
+    AdaptiveWaitPolicy policy;
+    policy.recordWait(0, AdaptiveWaitMode::spin, 100, 0);
+
+    WaitParams params{false, true, false, 1};
+    policy.adjustWaitParams(AdaptiveWaitMode::monitorWait, 0, params);
+    EXPECT_TRUE(params.allowMonitorWait);
+    EXPECT_EQ(200, params.waitTimeout);
+
+    params.waitTimeout = 1000;
+    policy.adjustWaitParams(AdaptiveWaitMode::monitorWait, 0, params);
+    EXPECT_EQ(1000, params.waitTimeout);
+}
+
+TEST(AdaptiveWaitPolicyTest, givenTimeoutDisabledWhenAdjustingParamsForPollingModesThenTimeoutIsNotChanged) {
+    AdaptiveWaitPolicy policy;
+    policy.recordWait(0, AdaptiveWaitMode::spin, 100, 0);
+
+    WaitParams params{false, false, false, 5};
+    policy.adjustWaitParams(AdaptiveWaitMode::spin, 0, params);
+    EXPECT_FALSE(params.enableTimeout);
+    EXPECT_EQ(5, params.waitTimeout);
+
+    policy.adjustWaitParams(AdaptiveWaitMode::monitorWait, 0, params);
+    EXPECT_TRUE(params.allowMonitorWait);
+    EXPECT_FALSE(params.enableTimeout);
+    EXPECT_EQ(5, params.waitTimeout);
+}
+
+TEST(AdaptiveWaitPolicyTest, givenTimeoutDisabledWhenAdjustingParamsForKmdWaitModeThenTimeoutIsEnabledSoKmdWaitIsStartedImmediately) {
+    AdaptiveWaitPolicy policy;
+    policy.recordWait(0, AdaptiveWaitMode::spin, 10 * AdaptiveWaitPolicy::monitorWaitLatencyThresholdMicroseconds, 0);
+
+    WaitParams params{true, false, false, 5};
+    policy.adjustWaitParams(AdaptiveWaitMode::kmdWait, 0, params);
+    EXPECT_FALSE(params.indefinitelyPoll);
+    EXPECT_TRUE(params.enableTimeout);
+    EXPECT_EQ(0, params.waitTimeout);
+}
+
+TEST(AdaptiveWaitPolicyTest, givenRecordedWaitsWhenGettingCountersThenWaitsPerModeAndTimesAreAccumulated) {
+    AdaptiveWaitPolicy policy;
+    policy.recordWait(0, AdaptiveWaitMode::spin, 10, 10);
+    policy.recordWait(1, AdaptiveWaitMode::monitorWait, 100, 100);
+    policy.recordWait(2, AdaptiveWaitMode::kmdWait, 1000, 2000);
+    policy.recordWait(3, AdaptiveWaitMode::kmdWait, -1, 5);
+
+    auto counters = policy.getCounters();
+    EXPECT_EQ(1u, counters.waitsPerMode[static_cast<uint32_t>(AdaptiveWaitMode::spin)]);
+    EXPECT_EQ(1u, counters.waitsPerMode[static_cast<uint32_t>(AdaptiveWaitMode::monitorWait)]);
+    EXPECT_EQ(2u, counters.waitsPerMode[static_cast<uint32_t>(AdaptiveWaitMode::kmdWait)]);
+    EXPECT_EQ(1110u, counters.busyPollTimeMicroseconds);
+    EXPECT_EQ(1110u, counters.wallTimeMicroseconds);
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/local_id_gen.h"
+#include "shared/source/utilities/cpu_info.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+
+// This file is built without AVX-512 code generation; AVX-512 code is only executed
+// through the generator instantiated in local_id_gen_avx512.cpp, after the CPU check.
+namespace NEO {
+struct uint16x8_t;
+struct uint16x32_t;
+} // namespace NEO
+
+using namespace NEO;
+
+struct LocalIdGenAvx512 : public ::testing::Test {
+    void SetUp() override {
+        if (!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512)) {
+            GTEST_SKIP();
+        }
+    }
+};
+
+TEST_F(LocalIdGenAvx512, givenVariousWorkgroupSizesWhenGeneratingSimd32LocalIdsThenResultMatchesSse4Generator) {
+    const std::array<std::array<uint16_t, 3>, 5> workgroupSizes = {{{1, 1, 1}, {33, 1, 1}, {16, 8, 2}, {7, 5, 3}, {1024, 1, 1}}};
+    const std::array<std::array<uint8_t, 3>, 2> dimensionsOrders = {{{0, 1, 2}, {2, 1, 0}}};
+    constexpr size_t bufferSize = 64 * 1024;
+
+    auto avx512Buffer = alignedMalloc(bufferSize, 64);
+    auto sse4Buffer = alignedMalloc(bufferSize, 64);
+
+    for (auto &lws : workgroupSizes) {
+        for (auto &dimensionsOrder : dimensionsOrders) {
+            for (auto chooseMaxRowSize : {false, true}) {
+                auto threadsPerWorkGroup = static_cast<uint16_t>(getThreadsPerWG(32, lws[0] * lws[1] * lws[2]));
+                memset(avx512Buffer, 0, bufferSize);
+                memset(sse4Buffer, 0, bufferSize);
+
+                generateLocalIDsSimd<uint16x32_t, 32>(avx512Buffer, lws, threadsPerWorkGroup, dimensionsOrder, chooseMaxRowSize);
+                generateLocalIDsSimd<uint16x8_t, 32>(sse4Buffer, lws, threadsPerWorkGroup, dimensionsOrder, chooseMaxRowSize);
+
+                EXPECT_EQ(0, memcmp(avx512Buffer, sse4Buffer, bufferSize));
+            }
+        }
+    }
+
+    alignedFree(avx512Buffer);
+    alignedFree(sse4Buffer);
+}
+
+TEST_F(LocalIdGenAvx512, givenAvx512SupportedWhenInitializingLocalIdHelperThenAvx512GeneratorIsUsedForSimd32) {
+    void (*expectedGenerator)(void *, const std::array<uint16_t, 3> &, uint16_t, const std::array<uint8_t, 3> &, bool) = generateLocalIDsSimd<uint16x32_t, 32>;
+    EXPECT_EQ(expectedGenerator, LocalIDHelper::generateSimd32);
+}
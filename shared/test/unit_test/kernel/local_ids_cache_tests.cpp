@@ -9,6 +9,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/local_id_gen.h"
 #include "shared/source/helpers/per_thread_data.h"
 #include "shared/source/kernel/grf_config.h"
 #include "shared/source/kernel/local_ids_cache.h"
@@ -17,88 +18,227 @@
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include <thread>
+
 class MockLocalIdsCache : public NEO::LocalIdsCache {
   public:
     using Base = NEO::LocalIdsCache;
     using Base::Base;
+    using Base::activeLookups;
     using Base::cache;
-    MockLocalIdsCache(size_t cacheSize) : MockLocalIdsCache(cacheSize, 32u){};
-    MockLocalIdsCache(size_t cacheSize, uint8_t simd) : Base(cacheSize, {0, 1, 2}, GrfConfig::defaultGrfNumber, simd, 32, false){};
+    using Base::cacheSize;
+    using Base::hasRetiredEntries;
+    using Base::retiredEntries;
+
+    size_t getCommittedEntriesCount() const {
+        size_t count = 0;
+        for (size_t i = 0; i < cacheSize; i++) {
+            count += cache[i].load() != nullptr ? 1 : 0;
+        }
+        return count;
+    }
+
+    LocalIdsCacheEntry *findEntry(const NEO::LocalIdsCacheKey &key) const {
+        for (size_t i = 0; i < cacheSize; i++) {
+            auto entry = cache[i].load();
+            if (entry && entry->key == key) {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
 };
+
 struct LocalIdsCacheFixture {
     void setUp() {
-        localIdsCache = std::make_unique<MockLocalIdsCache>(1);
+        localIdsCache = std::make_unique<MockLocalIdsCache>(NEO::LocalIdsCache::defaultCacheSize);
+        key.groupSize = {128, 2, 1};
+        key.wgDimOrder = {0, 1, 2};
+        key.grfCount = GrfConfig::defaultGrfNumber;
+        key.simdSize = 32;
+        key.grfSize = 32;
+        key.usesOnlyImages = false;
     }
     void tearDown() {}
 
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
     std::array<uint8_t, 2048> perThreadData = {0};
-    Vec3<uint16_t> groupSize = {128, 2, 1};
+    NEO::LocalIdsCacheKey key;
     std::unique_ptr<MockLocalIdsCache> localIdsCache;
 };
 
 using LocalIdsCacheTests = Test<LocalIdsCacheFixture>;
-TEST_F(LocalIdsCacheTests, GivenCacheMissWhenGetLocalIdsForGroupThenNewEntryIsCommitedIntoLeastUsedEntry) {
-    localIdsCache->cache.resize(2);
-    localIdsCache->cache[0].accessCounter = 2U;
-    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+TEST_F(LocalIdsCacheTests, GivenCacheMissWhenSetLocalIdsForGroupThenNewEntryIsCommitedWithGeneratedLocalIds) {
     auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
-    localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
+    localIdsCache->setLocalIdsForGroup(key, perThreadData.data(), rootDeviceEnvironment);
+
+    EXPECT_EQ(1U, localIdsCache->getCommittedEntriesCount());
+    auto entry = localIdsCache->findEntry(key);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_NE(nullptr, entry->localIdsData);
+    EXPECT_EQ(1536U, entry->localIdsSize);
 
-    EXPECT_EQ(groupSize, localIdsCache->cache[1].groupSize);
-    EXPECT_NE(nullptr, localIdsCache->cache[1].localIdsData);
-    EXPECT_EQ(1536U, localIdsCache->cache[1].localIdsSize);
-    EXPECT_EQ(1536U, localIdsCache->cache[1].localIdsSizeAllocated);
-    EXPECT_EQ(1U, localIdsCache->cache[1].accessCounter);
+    std::array<uint8_t, 2048> expectedPerThreadData = {0};
+    NEO::generateLocalIDs(expectedPerThreadData.data(), key.simdSize, {key.groupSize[0], key.groupSize[1], key.groupSize[2]},
+                          key.wgDimOrder, key.usesOnlyImages, key.grfSize, key.grfCount, rootDeviceEnvironment);
+    EXPECT_EQ(0, memcmp(expectedPerThreadData.data(), perThreadData.data(), entry->localIdsSize));
 }
 
-TEST_F(LocalIdsCacheTests, GivenEntryInCacheWhenGetLocalIdsForGroupThenEntryFromCacheIsUsed) {
-    localIdsCache->cache[0].groupSize = groupSize;
-    localIdsCache->cache[0].localIdsData = static_cast<uint8_t *>(alignedMalloc(512, 32));
-    localIdsCache->cache[0].localIdsSize = 512U;
-    localIdsCache->cache[0].localIdsSizeAllocated = 512U;
-    localIdsCache->cache[0].accessCounter = 1U;
-    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+TEST_F(LocalIdsCacheTests, GivenEntryInCacheWhenSetLocalIdsForGroupThenEntryFromCacheIsUsed) {
     auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
-    localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
-    EXPECT_EQ(2U, localIdsCache->cache[0].accessCounter);
+    localIdsCache->setLocalIdsForGroup(key, perThreadData.data(), rootDeviceEnvironment);
+    auto entry = localIdsCache->findEntry(key);
+    ASSERT_NE(nullptr, entry);
+
+    std::array<uint8_t, 2048> secondPerThreadData = {0};
+    localIdsCache->setLocalIdsForGroup(key, secondPerThreadData.data(), rootDeviceEnvironment);
+    EXPECT_EQ(1U, localIdsCache->getCommittedEntriesCount());
+    EXPECT_EQ(entry, localIdsCache->findEntry(key));
+    EXPECT_EQ(0, memcmp(perThreadData.data(), secondPerThreadData.data(), entry->localIdsSize));
 }
 
-TEST_F(LocalIdsCacheTests, GivenEntryWithBiggerBufferAllocatedWhenGetLocalIdsForGroupThenBufferIsReused) {
-    localIdsCache->cache[0].groupSize = {4, 1, 1};
-    localIdsCache->cache[0].localIdsData = static_cast<uint8_t *>(alignedMalloc(512, 32));
-    localIdsCache->cache[0].localIdsSize = 512U;
-    localIdsCache->cache[0].localIdsSizeAllocated = 512U;
-    localIdsCache->cache[0].accessCounter = 2U;
-    const auto localIdsData = localIdsCache->cache[0].localIdsData;
+TEST_F(LocalIdsCacheTests, GivenKeysDifferingOnlyInKernelPropertiesWhenSetLocalIdsForGroupThenSeparateEntriesAreCommited) {
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+    auto simd16Key = key;
+    simd16Key.simdSize = 16;
+    auto reversedOrderKey = key;
+    reversedOrderKey.wgDimOrder = {2, 1, 0};
 
-    groupSize = {2, 1, 1};
-    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    localIdsCache->setLocalIdsForGroup(key, perThreadData.data(), rootDeviceEnvironment);
+    localIdsCache->setLocalIdsForGroup(simd16Key, perThreadData.data(), rootDeviceEnvironment);
+    localIdsCache->setLocalIdsForGroup(reversedOrderKey, perThreadData.data(), rootDeviceEnvironment);
+
+    EXPECT_EQ(3U, localIdsCache->getCommittedEntriesCount());
+    EXPECT_NE(nullptr, localIdsCache->findEntry(key));
+    EXPECT_NE(nullptr, localIdsCache->findEntry(simd16Key));
+    EXPECT_NE(nullptr, localIdsCache->findEntry(reversedOrderKey));
+}
+
+TEST_F(LocalIdsCacheTests, GivenFullCacheWhenSetLocalIdsForNewGroupThenExistingEntryIsReplaced) {
     auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
-    localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
-    EXPECT_EQ(1U, localIdsCache->cache[0].accessCounter);
-    EXPECT_EQ(192U, localIdsCache->cache[0].localIdsSize);
-    EXPECT_EQ(512U, localIdsCache->cache[0].localIdsSizeAllocated);
-    EXPECT_EQ(localIdsData, localIdsCache->cache[0].localIdsData);
+    localIdsCache = std::make_unique<MockLocalIdsCache>(1u);
+    localIdsCache->setLocalIdsForGroup(key, perThreadData.data(), rootDeviceEnvironment);
+    ASSERT_NE(nullptr, localIdsCache->findEntry(key));
+
+    auto otherKey = key;
+    otherKey.groupSize = {2, 1, 1};
+    std::array<uint8_t, 2048> otherPerThreadData = {0};
+    localIdsCache->setLocalIdsForGroup(otherKey, otherPerThreadData.data(), rootDeviceEnvironment);
+
+    EXPECT_EQ(1U, localIdsCache->getCommittedEntriesCount());
+    EXPECT_EQ(nullptr, localIdsCache->findEntry(key));
+    EXPECT_NE(nullptr, localIdsCache->findEntry(otherKey));
+    EXPECT_TRUE(localIdsCache->retiredEntries.empty());
+
+    std::array<uint8_t, 2048> expectedPerThreadData = {0};
+    NEO::generateLocalIDs(expectedPerThreadData.data(), otherKey.simdSize, {otherKey.groupSize[0], otherKey.groupSize[1], otherKey.groupSize[2]},
+                          otherKey.wgDimOrder, otherKey.usesOnlyImages, otherKey.grfSize, otherKey.grfCount, rootDeviceEnvironment);
+    EXPECT_EQ(0, memcmp(expectedPerThreadData.data(), otherPerThreadData.data(), expectedPerThreadData.size()));
 }
 
-TEST_F(LocalIdsCacheTests, GivenValidLocalIdsCacheWhenGettingLocalIdsSizePerThreadThenCorrectValueIsReturned) {
-    auto localIdsSizePerThread = localIdsCache->getLocalIdsSizePerThread();
+TEST_F(LocalIdsCacheTests, GivenFullCacheWithRecentlyUsedEntryWhenSetLocalIdsForNewGroupThenEntryNotUsedRecentlyIsReplaced) {
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+    localIdsCache = std::make_unique<MockLocalIdsCache>(2u);
+    auto secondKey = key;
+    secondKey.groupSize = {4, 1, 1};
+    localIdsCache->setLocalIdsForGroup(key, perThreadData.data(), rootDeviceEnvironment);
+    localIdsCache->setLocalIdsForGroup(secondKey, perThreadData.data(), rootDeviceEnvironment);
+    ASSERT_EQ(2U, localIdsCache->getCommittedEntriesCount());
+
+    localIdsCache->findEntry(key)->recentlyUsed = false;
+    localIdsCache->findEntry(secondKey)->recentlyUsed = true;
+
+    auto thirdKey = key;
+    thirdKey.groupSize = {2, 1, 1};
+    localIdsCache->setLocalIdsForGroup(thirdKey, perThreadData.data(), rootDeviceEnvironment);
+
+    EXPECT_EQ(2U, localIdsCache->getCommittedEntriesCount());
+    EXPECT_EQ(nullptr, localIdsCache->findEntry(key));
+    EXPECT_NE(nullptr, localIdsCache->findEntry(secondKey));
+    EXPECT_NE(nullptr, localIdsCache->findEntry(thirdKey));
+}
+
+TEST_F(LocalIdsCacheTests, GivenLookupInFlightWhenEntryIsReplacedThenItIsReleasedAfterLookupsComplete) {
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+    localIdsCache = std::make_unique<MockLocalIdsCache>(1u);
+    localIdsCache->setLocalIdsForGroup(key, perThreadData.data(), rootDeviceEnvironment);
+    auto entry = localIdsCache->findEntry(key);
+
+    auto otherKey = key;
+    otherKey.groupSize = {2, 1, 1};
+    localIdsCache->activeLookups = 1U;
+    localIdsCache->setLocalIdsForGroup(otherKey, perThreadData.data(), rootDeviceEnvironment);
+    ASSERT_EQ(1U, localIdsCache->retiredEntries.size());
+    EXPECT_EQ(entry, localIdsCache->retiredEntries[0]);
+
+    localIdsCache->activeLookups = 0U;
+    localIdsCache->setLocalIdsForGroup(key, perThreadData.data(), rootDeviceEnvironment);
+    EXPECT_TRUE(localIdsCache->retiredEntries.empty());
+    EXPECT_NE(nullptr, localIdsCache->findEntry(key));
+}
+
+TEST_F(LocalIdsCacheTests, GivenRetiredEntryWhenLastLookupHitsCacheThenRetiredEntryIsReleased) {
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+    localIdsCache = std::make_unique<MockLocalIdsCache>(1u);
+    localIdsCache->setLocalIdsForGroup(key, perThreadData.data(), rootDeviceEnvironment);
+
+    auto otherKey = key;
+    otherKey.groupSize = {2, 1, 1};
+    localIdsCache->activeLookups = 1U;
+    localIdsCache->setLocalIdsForGroup(otherKey, perThreadData.data(), rootDeviceEnvironment);
+    ASSERT_EQ(1U, localIdsCache->retiredEntries.size());
+    EXPECT_TRUE(localIdsCache->hasRetiredEntries);
+
+    localIdsCache->setLocalIdsForGroup(otherKey, perThreadData.data(), rootDeviceEnvironment);
+    EXPECT_EQ(1U, localIdsCache->retiredEntries.size());
+
+    localIdsCache->activeLookups = 0U;
+    localIdsCache->setLocalIdsForGroup(otherKey, perThreadData.data(), rootDeviceEnvironment);
+    EXPECT_TRUE(localIdsCache->retiredEntries.empty());
+    EXPECT_FALSE(localIdsCache->hasRetiredEntries);
+    EXPECT_NE(nullptr, localIdsCache->findEntry(otherKey));
+}
+
+TEST_F(LocalIdsCacheTests, GivenMultipleThreadsWhenSetLocalIdsForSameGroupThenSingleEntryIsCommitedAndAllResultsMatch) {
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+    constexpr size_t numThreads = 4;
+    std::array<std::array<uint8_t, 2048>, numThreads> results = {};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; i++) {
+        threads.emplace_back([&, i]() {
+            localIdsCache->setLocalIdsForGroup(key, results[i].data(), rootDeviceEnvironment);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(1U, localIdsCache->getCommittedEntriesCount());
+    for (size_t i = 1; i < numThreads; i++) {
+        EXPECT_EQ(0, memcmp(results[0].data(), results[i].data(), results[0].size()));
+    }
+}
+
+TEST_F(LocalIdsCacheTests, GivenValidLocalIdsCacheKeyWhenGettingLocalIdsSizePerThreadThenCorrectValueIsReturned) {
+    auto localIdsSizePerThread = NEO::LocalIdsCache::getLocalIdsSizePerThread(key);
     EXPECT_EQ(192U, localIdsSizePerThread);
 }
 
-TEST_F(LocalIdsCacheTests, GivenValidLocalIdsCacheWhenGettingLocalIdsSizeForGroupThenCorrectValueIsReturned) {
-    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+TEST_F(LocalIdsCacheTests, GivenValidLocalIdsCacheKeyWhenGettingLocalIdsSizeForGroupThenCorrectValueIsReturned) {
     auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
-    auto localIdsSizePerThread = localIdsCache->getLocalIdsSizeForGroup(groupSize, rootDeviceEnvironment);
-    EXPECT_EQ(1536U, localIdsSizePerThread);
+    auto localIdsSizeForGroup = NEO::LocalIdsCache::getLocalIdsSizeForGroup(key, rootDeviceEnvironment);
+    EXPECT_EQ(1536U, localIdsSizeForGroup);
 }
 
 TEST(LocalIdsCacheTest, givenSimd1WhenGettingLocalIdsSizeForGroupThenCorrectValueIsReturned) {
     NEO::MockExecutionEnvironment mockExecutionEnvironment{};
     auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
-    auto localIdsCache = std::make_unique<MockLocalIdsCache>(1u, 1u);
-    Vec3<uint16_t> groupSize = {128, 2, 1};
-    auto localIdsSizePerThread = localIdsCache->getLocalIdsSizeForGroup(groupSize, rootDeviceEnvironment);
-    auto expectedLocalIdsSizePerThread = groupSize[0] * groupSize[1] * groupSize[2] * localIdsCache->getLocalIdsSizePerThread();
-    EXPECT_EQ(expectedLocalIdsSizePerThread, localIdsSizePerThread);
-}
\ No newline at end of file
+    NEO::LocalIdsCacheKey key;
+    key.groupSize = {128, 2, 1};
+    key.grfCount = GrfConfig::defaultGrfNumber;
+    key.simdSize = 1;
+    key.grfSize = 32;
+    auto localIdsSizeForGroup = NEO::LocalIdsCache::getLocalIdsSizeForGroup(key, rootDeviceEnvironment);
+    auto expectedLocalIdsSizeForGroup = key.groupSize[0] * key.groupSize[1] * key.groupSize[2] * NEO::LocalIdsCache::getLocalIdsSizePerThread(key);
+    EXPECT_EQ(expectedLocalIdsSizeForGroup, localIdsSizeForGroup);
+}
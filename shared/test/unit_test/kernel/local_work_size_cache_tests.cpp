@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/local_work_size.h"
+#include "shared/source/kernel/local_work_size_cache.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+LocalWorkSizeCacheKey createKey(size_t globalSizeX, uint32_t slmTotalSize = 0u) {
+    LocalWorkSizeCacheKey key;
+    key.globalSize = {globalSizeX, 1, 1};
+    key.slmTotalSize = slmTotalSize;
+    key.workDim = 1;
+    return key;
+}
+} // namespace
+
+TEST(LocalWorkSizeCacheTest, givenEmptyCacheWhenFindingKeyThenMissIsReturned) {
+    LocalWorkSizeCache cache;
+    Vec3<size_t> lws = {0, 0, 0};
+    EXPECT_FALSE(cache.find(createKey(256), lws));
+    EXPECT_EQ(0u, cache.size());
+}
+
+TEST(LocalWorkSizeCacheTest, givenInsertedEntryWhenFindingKeyThenCachedLocalWorkSizeIsReturned) {
+    LocalWorkSizeCache cache;
+    cache.insert(createKey(256), {64, 1, 1});
+
+    Vec3<size_t> lws = {0, 0, 0};
+    EXPECT_TRUE(cache.find(createKey(256), lws));
+    EXPECT_EQ(Vec3<size_t>(64, 1, 1), lws);
+
+    EXPECT_FALSE(cache.find(createKey(256, 1u), lws));
+    EXPECT_FALSE(cache.find(createKey(512), lws));
+    EXPECT_EQ(1u, cache.size());
+}
+
+TEST(LocalWorkSizeCacheTest, givenFullCacheWhenInsertingNewEntryThenLeastRecentlyUsedEntryIsEvicted) {
+    LocalWorkSizeCache cache(2u);
+    cache.insert(createKey(1), {1, 1, 1});
+    cache.insert(createKey(2), {2, 1, 1});
+
+    Vec3<size_t> lws = {0, 0, 0};
+    EXPECT_TRUE(cache.find(createKey(1), lws));
+
+    cache.insert(createKey(3), {3, 1, 1});
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_TRUE(cache.find(createKey(1), lws));
+    EXPECT_FALSE(cache.find(createKey(2), lws));
+    EXPECT_TRUE(cache.find(createKey(3), lws));
+    EXPECT_EQ(Vec3<size_t>(3, 1, 1), lws);
+}
+
+TEST(LocalWorkSizeCacheTest, givenDistinctGlobalSizesWhenCollectingDivisorsThenResultMatchesTrialDivision) {
+    constexpr uint32_t limit = 1024u;
+    uint32_t divisors[1024];
+    std::vector<uint32_t> expected;
+    expected.reserve(limit);
+
+    auto verify = [&](size_t value) {
+        expected.clear();
+        for (uint32_t divisor = 1; divisor <= limit; divisor++) {
+            if ((value % divisor) == 0) {
+                expected.push_back(divisor);
+            }
+        }
+        auto count = collectDivisors(value, limit, divisors);
+        ASSERT_EQ(expected.size(), count) << "value: " << value;
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), divisors)) << "value: " << value;
+    };
+
+    for (size_t value = 1; value <= 10000; value++) {
+        verify(value);
+    }
+    verify(4294967291u);
+    verify(2u * 3u * 5u * 7u * 11u * 13u * 17u * 19u * 23u);
+    verify(1021u * 1019u);
+}
+
+TEST(LocalWorkSizeCacheTest, givenZeroGlobalSizeWhenCollectingDivisorsThenAllValuesUpToLimitAreReturned) {
+    uint32_t divisors[1024];
+    EXPECT_EQ(8u, collectDivisors(0u, 8u, divisors));
+    EXPECT_EQ(1u, divisors[0]);
+    EXPECT_EQ(8u, divisors[7]);
+}
+
+TEST(LocalWorkSizeCacheTest, givenZeroMaxWorkGroupSizeWhenComputingWorkgroupSize2DThenWorkGroupSizeOfOneIsReturned) {
+    size_t workGroupSize[3] = {0, 0, 0};
+    const size_t workItems[3] = {64, 64, 1};
+    computeWorkgroupSize2D(0u, workGroupSize, workItems, 32u);
+    EXPECT_EQ(1u, workGroupSize[0]);
+    EXPECT_EQ(1u, workGroupSize[1]);
+    EXPECT_EQ(1u, workGroupSize[2]);
+}
@@ -589,6 +589,153 @@ TEST_F(SVMLocalMemoryAllocatorTest, givenInternalAllocationWhenNewAllocationIsCr
     svmManager->freeSVMAlloc(ptr2);
 }
 
+TEST_F(SVMLocalMemoryAllocatorTest, givenInternalAllocationsWhenMadeResidentAsPackThenTouchedAllocationsAreCountedPerCsr) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 2));
+    auto device = deviceFactory->rootDevices[0];
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getMemoryManager());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager, false);
+    auto csr = std::make_unique<MockCommandStreamReceiver>(*device->getExecutionEnvironment(), device->getRootDeviceIndex(), device->getDeviceBitfield());
+    csr->setupContext(*device->getDefaultEngine().osContext);
+
+    void *cmdQ = reinterpret_cast<void *>(0x12345);
+    auto mockPageFaultManager = new MockPageFaultManager();
+    memoryManager->pageFaultManager.reset(mockPageFaultManager);
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::sharedUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+
+    auto ptr = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, &cmdQ);
+    auto ptr2 = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, &cmdQ);
+    ASSERT_NE(nullptr, ptr);
+    ASSERT_NE(nullptr, ptr2);
+
+    svmManager->makeIndirectAllocationsResident(*csr, 1u);
+    EXPECT_EQ(2u, svmManager->indirectAllocationsResidency.find(csr.get())->second.latestTouchedAllocationsCount);
+
+    svmManager->makeIndirectAllocationsResident(*csr, 2u);
+    EXPECT_EQ(0u, svmManager->indirectAllocationsResidency.find(csr.get())->second.latestTouchedAllocationsCount);
+
+    auto ptr3 = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, &cmdQ);
+    svmManager->makeIndirectAllocationsResident(*csr, 3u);
+    EXPECT_EQ(1u, svmManager->indirectAllocationsResidency.find(csr.get())->second.latestTouchedAllocationsCount);
+
+    svmManager->freeSVMAlloc(ptr);
+    svmManager->freeSVMAlloc(ptr2);
+    svmManager->freeSVMAlloc(ptr3);
+}
+
+TEST_F(SVMLocalMemoryAllocatorTest, givenResidencySnapshotEnabledWhenAllocationsAreCreatedAndFreedThenOnlyLiveAllocationsOfRequestedTypesAreAddedToResidencyContainer) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableIndirectAllocationsResidencySnapshot.set(1);
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 2));
+    auto device = deviceFactory->rootDevices[0];
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getMemoryManager());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager, false);
+
+    void *cmdQ = reinterpret_cast<void *>(0x12345);
+    auto mockPageFaultManager = new MockPageFaultManager();
+    memoryManager->pageFaultManager.reset(mockPageFaultManager);
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::sharedUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+
+    auto ptr = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, &cmdQ);
+    auto ptr2 = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, &cmdQ);
+    ASSERT_NE(nullptr, ptr);
+    ASSERT_NE(nullptr, ptr2);
+    auto graphicsAllocation = svmManager->getSVMAlloc(ptr)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    auto graphicsAllocation2 = svmManager->getSVMAlloc(ptr2)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    auto sharedMask = static_cast<uint32_t>(InternalMemoryType::sharedUnifiedMemory);
+    auto deviceMask = static_cast<uint32_t>(InternalMemoryType::deviceUnifiedMemory);
+
+    ResidencyContainer residencyContainer;
+    svmManager->addInternalAllocationsToResidencyContainer(device->getRootDeviceIndex(), residencyContainer, sharedMask);
+    ASSERT_EQ(2u, residencyContainer.size());
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), graphicsAllocation));
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), graphicsAllocation2));
+
+    residencyContainer.clear();
+    svmManager->addInternalAllocationsToResidencyContainer(device->getRootDeviceIndex(), residencyContainer, sharedMask);
+    EXPECT_EQ(2u, residencyContainer.size());
+
+    residencyContainer.clear();
+    svmManager->addInternalAllocationsToResidencyContainer(device->getRootDeviceIndex(), residencyContainer, deviceMask);
+    EXPECT_EQ(0u, residencyContainer.size());
+
+    svmManager->freeSVMAlloc(ptr);
+    auto ptr3 = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, &cmdQ);
+    ASSERT_NE(nullptr, ptr3);
+    auto graphicsAllocation3 = svmManager->getSVMAlloc(ptr3)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    residencyContainer.clear();
+    svmManager->addInternalAllocationsToResidencyContainer(device->getRootDeviceIndex(), residencyContainer, sharedMask);
+    ASSERT_EQ(2u, residencyContainer.size());
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), graphicsAllocation2));
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), graphicsAllocation3));
+
+    svmManager->freeSVMAlloc(ptr2);
+    svmManager->freeSVMAlloc(ptr3);
+}
+
+TEST_F(SVMLocalMemoryAllocatorTest, givenResidencySnapshotEnabledWhenMakingInternalAllocationsResidentThenAllAllocationsFromSnapshotAreMadeResidentOnEverySubmission) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableIndirectAllocationsResidencySnapshot.set(1);
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 2));
+    auto device = deviceFactory->rootDevices[0];
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getMemoryManager());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager, false);
+    auto csr = std::make_unique<MockCommandStreamReceiver>(*device->getExecutionEnvironment(), device->getRootDeviceIndex(), device->getDeviceBitfield());
+    csr->setupContext(*device->getDefaultEngine().osContext);
+    auto csr2 = std::make_unique<MockCommandStreamReceiver>(*device->getExecutionEnvironment(), device->getRootDeviceIndex(), device->getDeviceBitfield());
+    csr2->setupContext(*device->getDefaultEngine().osContext);
+
+    void *cmdQ = reinterpret_cast<void *>(0x12345);
+    auto mockPageFaultManager = new MockPageFaultManager();
+    memoryManager->pageFaultManager.reset(mockPageFaultManager);
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::sharedUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    auto sharedMask = static_cast<uint32_t>(InternalMemoryType::sharedUnifiedMemory);
+
+    auto ptr = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, &cmdQ);
+    auto ptr2 = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, &cmdQ);
+    ASSERT_NE(nullptr, ptr);
+    ASSERT_NE(nullptr, ptr2);
+    auto graphicsAllocation = svmManager->getSVMAlloc(ptr)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    auto contextId = csr->getOsContext().getContextId();
+
+    svmManager->makeInternalAllocationsResident(*csr, sharedMask);
+    EXPECT_EQ(2u, csr->makeResidentCalledTimes);
+    EXPECT_FALSE(graphicsAllocation->isAlwaysResident(contextId));
+    auto counters = svmManager->getResidencySnapshotCounters(*csr, sharedMask);
+    EXPECT_EQ(2u, counters.allocationsChanged);
+    EXPECT_EQ(2u, counters.allocationsTouched);
+    EXPECT_EQ(svmManager->indirectAllocationsResidency.end(), svmManager->indirectAllocationsResidency.find(csr.get()));
+
+    svmManager->makeInternalAllocationsResident(*csr, sharedMask);
+    EXPECT_EQ(4u, csr->makeResidentCalledTimes);
+    counters = svmManager->getResidencySnapshotCounters(*csr, sharedMask);
+    EXPECT_EQ(0u, counters.allocationsChanged);
+    EXPECT_EQ(2u, counters.allocationsTouched);
+
+    svmManager->freeSVMAlloc(ptr);
+    auto ptr3 = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, &cmdQ);
+    ASSERT_NE(nullptr, ptr3);
+    auto graphicsAllocation3 = svmManager->getSVMAlloc(ptr3)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    svmManager->makeInternalAllocationsResident(*csr, sharedMask);
+    EXPECT_EQ(6u, csr->makeResidentCalledTimes);
+    EXPECT_FALSE(graphicsAllocation3->isAlwaysResident(contextId));
+    counters = svmManager->getResidencySnapshotCounters(*csr, sharedMask);
+    EXPECT_EQ(2u, counters.allocationsChanged);
+    EXPECT_EQ(2u, counters.allocationsTouched);
+
+    counters = svmManager->getResidencySnapshotCounters(*csr2, sharedMask);
+    EXPECT_EQ(0u, counters.allocationsTouched);
+    svmManager->makeInternalAllocationsResident(*csr2, sharedMask);
+    counters = svmManager->getResidencySnapshotCounters(*csr2, sharedMask);
+    EXPECT_EQ(3u, counters.allocationsChanged);
+    EXPECT_EQ(2u, counters.allocationsTouched);
+
+    svmManager->freeSVMAlloc(ptr2);
+    svmManager->freeSVMAlloc(ptr3);
+}
+
 TEST_F(SVMLocalMemoryAllocatorTest, givenLocalMemoryEnabledAndCompressionEnabledThenDeviceSideSharedUsmIsCompressed) {
     DebugManagerStateRestore restore;
     debugManager.flags.RenderCompressedBuffersEnabled.set(1);
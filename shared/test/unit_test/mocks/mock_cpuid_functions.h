@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include <cstdint>
 
 void mockCpuidEnableAll(int *cpuInfo, int functionId);
 
@@ -14,3 +15,7 @@ void mockCpuidFunctionAvailableDisableAll(int *cpuInfo, int functionId);
 void mockCpuidFunctionNotAvailableDisableAll(int *cpuInfo, int functionId);
 
 void mockCpuidReport36BitVirtualAddressSize(int *cpuInfo, int functionId);
+
+uint64_t mockXgetbvEnableAll(uint32_t xcr);
+
+uint64_t mockXgetbvAvxStateOnly(uint32_t xcr);
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_tbx_sockets_imp.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+using namespace NEO;
+
+namespace {
+constexpr size_t gttRequestSize = sizeof(HasHdr) + sizeof(HasGtt64Req);
+constexpr size_t writeRequestSize = sizeof(HasHdr) + sizeof(HasWriteDataReq);
+constexpr size_t mmioRequestSize = sizeof(HasHdr) + sizeof(HasMmioReq);
+
+HasHdr getHeaderAt(const std::vector<char> &data, size_t offset) {
+    HasHdr hdr = {};
+    EXPECT_LE(offset + sizeof(HasHdr), data.size());
+    memcpy(&hdr, data.data() + offset, sizeof(HasHdr));
+    return hdr;
+}
+} // namespace
+
+struct TbxSocketsImpWriteBufferTest : public ::testing::Test {
+    void SetUp() override {
+        debugManager.flags.TbxSocketsWriteBufferSizeInKb.set(1);
+        tbxSockets = std::make_unique<MockTbxSocketsImp>();
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockTbxSocketsImp> tbxSockets;
+};
+
+TEST(TbxSocketsImpTest, givenWriteBufferDisabledWhenWritingMemoryThenHeaderAndPayloadAreSentSeparately) {
+    MockTbxSocketsImp tbxSockets;
+    EXPECT_EQ(0u, tbxSockets.pendingWriteDataCapacity);
+
+    char payload[64] = {};
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, payload, sizeof(payload), MemType::system));
+
+    ASSERT_EQ(2u, tbxSockets.sentData.size());
+    EXPECT_EQ(writeRequestSize, tbxSockets.sentData[0].size());
+    EXPECT_EQ(sizeof(payload), tbxSockets.sentData[1].size());
+}
+
+TEST_F(TbxSocketsImpWriteBufferTest, givenQueuedWritesWhenReadingMmioThenQueuedWritesAndReadRequestAreSentInOrderBeforeWaitingForResponse) {
+    char payload[64];
+    for (size_t i = 0; i < sizeof(payload); i++) {
+        payload[i] = static_cast<char>(i);
+    }
+    EXPECT_TRUE(tbxSockets->writeGTT(0x80, 0x1234));
+    EXPECT_TRUE(tbxSockets->writeMemory(0x1000, payload, sizeof(payload), MemType::system));
+    EXPECT_EQ(0u, tbxSockets->sentData.size());
+
+    uint32_t value = 0;
+    EXPECT_TRUE(tbxSockets->readMMIO(0x2000, &value));
+
+    ASSERT_EQ(1u, tbxSockets->sentData.size());
+    ASSERT_EQ(1u, tbxSockets->sendsCountAtResponse.size());
+    EXPECT_EQ(1u, tbxSockets->sendsCountAtResponse[0]);
+
+    auto &sent = tbxSockets->sentData[0];
+    ASSERT_EQ(gttRequestSize + writeRequestSize + sizeof(payload) + mmioRequestSize, sent.size());
+
+    auto gttHdr = getHeaderAt(sent, 0);
+    EXPECT_EQ(static_cast<uint32_t>(HAS_GTT_REQ_TYPE), gttHdr.msgType);
+    EXPECT_EQ(0u, gttHdr.transID);
+
+    auto writeHdr = getHeaderAt(sent, gttRequestSize);
+    EXPECT_EQ(static_cast<uint32_t>(HAS_WRITE_DATA_REQ_TYPE), writeHdr.msgType);
+    EXPECT_EQ(1u, writeHdr.transID);
+    EXPECT_EQ(0, memcmp(payload, sent.data() + gttRequestSize + writeRequestSize, sizeof(payload)));
+
+    auto mmioHdr = getHeaderAt(sent, gttRequestSize + writeRequestSize + sizeof(payload));
+    EXPECT_EQ(static_cast<uint32_t>(HAS_MMIO_REQ_TYPE), mmioHdr.msgType);
+    EXPECT_EQ(2u, mmioHdr.transID);
+    EXPECT_TRUE(tbxSockets->pendingWriteData.empty());
+}
+
+TEST_F(TbxSocketsImpWriteBufferTest, givenQueuedWritesWhenReadingMemoryThenQueuedWritesAreSentBeforeWaitingForResponse) {
+    EXPECT_TRUE(tbxSockets->writeGTT(0x80, 0x1234));
+    tbxSockets->responseMsgType = HAS_READ_DATA_RES_TYPE;
+
+    uint32_t data = 0;
+    EXPECT_TRUE(tbxSockets->readMemory(0x1000, &data, sizeof(data)));
+
+    ASSERT_EQ(1u, tbxSockets->sentData.size());
+    EXPECT_EQ(gttRequestSize + sizeof(HasHdr) + sizeof(HasReadDataReq), tbxSockets->sentData[0].size());
+    ASSERT_EQ(2u, tbxSockets->sendsCountAtResponse.size());
+    EXPECT_EQ(1u, tbxSockets->sendsCountAtResponse[0]);
+    EXPECT_EQ(static_cast<uint32_t>(HAS_READ_DATA_REQ_TYPE), getHeaderAt(tbxSockets->sentData[0], gttRequestSize).msgType);
+}
+
+TEST_F(TbxSocketsImpWriteBufferTest, givenQueuedWritesWhenWritingMmioThenQueuedWritesAndMmioWriteAreSentImmediately) {
+    EXPECT_TRUE(tbxSockets->writeGTT(0x80, 0x1234));
+    EXPECT_TRUE(tbxSockets->writeMMIO(0x2000, 0x1));
+
+    ASSERT_EQ(1u, tbxSockets->sentData.size());
+    ASSERT_EQ(gttRequestSize + mmioRequestSize, tbxSockets->sentData[0].size());
+    EXPECT_EQ(static_cast<uint32_t>(HAS_GTT_REQ_TYPE), getHeaderAt(tbxSockets->sentData[0], 0).msgType);
+    EXPECT_EQ(static_cast<uint32_t>(HAS_MMIO_REQ_TYPE), getHeaderAt(tbxSockets->sentData[0], gttRequestSize).msgType);
+    EXPECT_TRUE(tbxSockets->pendingWriteData.empty());
+    EXPECT_EQ(0u, tbxSockets->sendsCountAtResponse.size());
+}
+
+TEST_F(TbxSocketsImpWriteBufferTest, givenPayloadLargerThanWriteBufferWhenWritingMemoryThenQueuedDataIsSentFirstAndPayloadIsSentDirectly) {
+    std::vector<char> payload(tbxSockets->pendingWriteDataCapacity + 1, 0x5a);
+    EXPECT_TRUE(tbxSockets->writeGTT(0x80, 0x1234));
+    EXPECT_TRUE(tbxSockets->writeMemory(0x1000, payload.data(), payload.size(), MemType::local));
+
+    ASSERT_EQ(2u, tbxSockets->sentData.size());
+    ASSERT_EQ(gttRequestSize + writeRequestSize, tbxSockets->sentData[0].size());
+    EXPECT_EQ(static_cast<uint32_t>(HAS_GTT_REQ_TYPE), getHeaderAt(tbxSockets->sentData[0], 0).msgType);
+    EXPECT_EQ(static_cast<uint32_t>(HAS_WRITE_DATA_REQ_TYPE), getHeaderAt(tbxSockets->sentData[0], gttRequestSize).msgType);
+    EXPECT_EQ(payload, tbxSockets->sentData[1]);
+    EXPECT_TRUE(tbxSockets->pendingWriteData.empty());
+}
+
+TEST_F(TbxSocketsImpWriteBufferTest, givenWriteBufferFullWhenQueueingNextWriteThenBufferedWritesAreSentAndNextWriteIsQueued) {
+    const size_t writesThatFit = tbxSockets->pendingWriteDataCapacity / gttRequestSize;
+    for (size_t i = 0; i < writesThatFit; i++) {
+        EXPECT_TRUE(tbxSockets->writeGTT(static_cast<uint32_t>(i * sizeof(uint64_t)), i));
+    }
+    EXPECT_EQ(0u, tbxSockets->sentData.size());
+
+    EXPECT_TRUE(tbxSockets->writeGTT(0, 0));
+
+    ASSERT_EQ(1u, tbxSockets->sentData.size());
+    EXPECT_EQ(writesThatFit * gttRequestSize, tbxSockets->sentData[0].size());
+    for (size_t i = 0; i < writesThatFit; i++) {
+        EXPECT_EQ(static_cast<uint32_t>(i), getHeaderAt(tbxSockets->sentData[0], i * gttRequestSize).transID);
+    }
+    EXPECT_EQ(gttRequestSize, tbxSockets->pendingWriteData.size());
+}
+
+TEST_F(TbxSocketsImpWriteBufferTest, givenQueuedWritesWhenClosingThenQueuedWritesAreSent) {
+    EXPECT_TRUE(tbxSockets->writeGTT(0x80, 0x1234));
+    EXPECT_EQ(0u, tbxSockets->sentData.size());
+
+    tbxSockets->socket = static_cast<SOCKET>(-1);
+    tbxSockets->close();
+
+    ASSERT_EQ(1u, tbxSockets->sentData.size());
+    EXPECT_EQ(gttRequestSize, tbxSockets->sentData[0].size());
+    EXPECT_TRUE(tbxSockets->pendingWriteData.empty());
+    EXPECT_EQ(0, static_cast<int>(tbxSockets->socket));
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/api_latency_histograms.h"
+
+#include "gtest/gtest.h"
+
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+struct MockApiLatencyHistograms : public ApiLatencyHistograms {
+    using ApiLatencyHistograms::ApiLatencyHistograms;
+    using ApiLatencyHistograms::registry;
+};
+
+TEST(ApiLatencyHistogramsTest, givenLatencyWhenGettingBucketIndexThenPowerOfTwoRangeIsSelected) {
+    EXPECT_EQ(0u, ApiLatencyHistograms::getBucketIndex(0u));
+    EXPECT_EQ(1u, ApiLatencyHistograms::getBucketIndex(1u));
+    EXPECT_EQ(2u, ApiLatencyHistograms::getBucketIndex(2u));
+    EXPECT_EQ(2u, ApiLatencyHistograms::getBucketIndex(3u));
+    EXPECT_EQ(11u, ApiLatencyHistograms::getBucketIndex(1024u));
+    EXPECT_EQ(ApiLatencyHistograms::bucketsCount - 1, ApiLatencyHistograms::getBucketIndex(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(ApiLatencyHistogramsTest, givenRecordedLatenciesWhenGettingPercentilesThenBucketUpperBoundsAreReturned) {
+    ApiLatencyHistograms histograms(1u, 0);
+    for (uint32_t i = 0; i < 98; i++) {
+        histograms.record(ApiLatencyEntryPoint::zeCommandListAppendLaunchKernel, 1000u);
+    }
+    histograms.record(ApiLatencyEntryPoint::zeCommandListAppendLaunchKernel, 100000u);
+    histograms.record(ApiLatencyEntryPoint::zeCommandListAppendLaunchKernel, 1000000u);
+
+    EXPECT_EQ(100u, histograms.getSamplesCount(ApiLatencyEntryPoint::zeCommandListAppendLaunchKernel));
+    EXPECT_EQ(0u, histograms.getSamplesCount(ApiLatencyEntryPoint::clEnqueueNDRangeKernel));
+    EXPECT_EQ(1023u, histograms.getPercentileNs(ApiLatencyEntryPoint::zeCommandListAppendLaunchKernel, 50.0));
+    EXPECT_EQ(1023u, histograms.getPercentileNs(ApiLatencyEntryPoint::zeCommandListAppendLaunchKernel, 98.0));
+    EXPECT_EQ(131071u, histograms.getPercentileNs(ApiLatencyEntryPoint::zeCommandListAppendLaunchKernel, 99.0));
+    EXPECT_EQ(1048575u, histograms.getPercentileNs(ApiLatencyEntryPoint::zeCommandListAppendLaunchKernel, 100.0));
+    EXPECT_EQ(0u, histograms.getPercentileNs(ApiLatencyEntryPoint::clEnqueueNDRangeKernel, 99.0));
+
+    std::stringstream dump;
+    histograms.dump(dump);
+    EXPECT_NE(std::string::npos, dump.str().find("zeCommandListAppendLaunchKernel: samples 100"));
+    EXPECT_EQ(std::string::npos, dump.str().find("clEnqueueNDRangeKernel"));
+}
+
+TEST(ApiLatencyHistogramsTest, givenSamplingRateWhenScopesAreCreatedThenEveryNthCallIsRecorded) {
+    ApiLatencyHistograms histograms(4u, 0);
+    for (uint32_t i = 0; i < 10; i++) {
+        ApiLatencyScope scope(histograms, ApiLatencyEntryPoint::zeEventHostSynchronize);
+    }
+    EXPECT_EQ(2u, histograms.getSamplesCount(ApiLatencyEntryPoint::zeEventHostSynchronize));
+
+    ApiLatencyHistograms disabledHistograms(0u, 0);
+    EXPECT_FALSE(disabledHistograms.isEnabled());
+    {
+        ApiLatencyScope scope(disabledHistograms, ApiLatencyEntryPoint::zeEventHostSynchronize);
+    }
+    EXPECT_EQ(0u, disabledHistograms.getSamplesCount(ApiLatencyEntryPoint::zeEventHostSynchronize));
+}
+
+TEST(ApiLatencyHistogramsTest, givenMultipleThreadsRecordingWhenGettingHistogramThenPerThreadHistogramsAreMerged) {
+    ApiLatencyHistograms histograms(1u, 0);
+    constexpr uint32_t numThreads = 4;
+    constexpr uint32_t recordsPerThread = 1000;
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < numThreads; i++) {
+        threads.emplace_back([&histograms]() {
+            for (uint32_t j = 0; j < recordsPerThread; j++) {
+                histograms.record(ApiLatencyEntryPoint::clFinish, 500u);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    auto histogram = histograms.getHistogram(ApiLatencyEntryPoint::clFinish);
+    EXPECT_EQ(numThreads * recordsPerThread, histogram[ApiLatencyHistograms::getBucketIndex(500u)]);
+    EXPECT_EQ(numThreads * recordsPerThread, histograms.getSamplesCount(ApiLatencyEntryPoint::clFinish));
+}
+
+TEST(ApiLatencyHistogramsTest, givenThreadsExitingWhenNewThreadsRecordThenHistogramsOfExitedThreadsAreReusedAndTheirCountsAreKept) {
+    MockApiLatencyHistograms histograms(1u, 0);
+    constexpr uint32_t numThreads = 8;
+    constexpr uint32_t recordsPerThread = 10;
+
+    for (uint32_t i = 0; i < numThreads; i++) {
+        std::thread thread([&histograms]() {
+            for (uint32_t j = 0; j < recordsPerThread; j++) {
+                histograms.record(ApiLatencyEntryPoint::clFinish, 500u);
+            }
+        });
+        thread.join();
+    }
+
+    EXPECT_EQ(1u, histograms.registry->threadHistograms.size());
+    EXPECT_EQ(numThreads * recordsPerThread, histograms.getSamplesCount(ApiLatencyEntryPoint::clFinish));
+}
+
+TEST(ApiLatencyHistogramsTest, givenThreadRecordingIntoOtherInstanceWhenRecordingThenHistogramsOfPreviousInstanceAreReleased) {
+    MockApiLatencyHistograms histograms(1u, 0);
+    MockApiLatencyHistograms otherHistograms(1u, 0);
+
+    histograms.record(ApiLatencyEntryPoint::clFinish, 500u);
+    otherHistograms.record(ApiLatencyEntryPoint::clFinish, 500u);
+    EXPECT_FALSE(histograms.registry->threadHistograms[0]->inUse);
+    EXPECT_TRUE(otherHistograms.registry->threadHistograms[0]->inUse);
+
+    histograms.record(ApiLatencyEntryPoint::clFinish, 500u);
+    EXPECT_EQ(1u, histograms.registry->threadHistograms.size());
+    EXPECT_EQ(2u, histograms.getSamplesCount(ApiLatencyEntryPoint::clFinish));
+}
+
+TEST(ApiLatencyHistogramsTest, givenInstanceDestroyedWhenThreadWhichRecordedIntoItExitsThenThreadExitsSafely) {
+    auto histograms = std::make_unique<ApiLatencyHistograms>(1u, 0);
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool recorded = false;
+    bool destroyed = false;
+
+    std::thread thread([&]() {
+        histograms->record(ApiLatencyEntryPoint::clFinish, 500u);
+        std::unique_lock<std::mutex> lock(mtx);
+        recorded = true;
+        cv.notify_all();
+        cv.wait(lock, [&]() { return destroyed; });
+    });
+
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [&]() { return recorded; });
+        histograms.reset();
+        destroyed = true;
+        cv.notify_all();
+    }
+    thread.join();
+    EXPECT_EQ(nullptr, histograms.get());
+}
+
+TEST(ApiLatencyHistogramsTest, givenNoHistogramsWhenScopeIsCreatedThenCallIsNotSampled) {
+    ApiLatencyHistograms *histograms = nullptr;
+    ApiLatencyScope scope(histograms, ApiLatencyEntryPoint::clFinish);
+    EXPECT_NE(nullptr, ApiLatencyHistograms::getGlobal());
+}
+
+TEST(ApiLatencyHistogramsTest, givenEntryPointNameWhenGettingEntryPointThenMatchingEntryPointIsReturnedOnlyForKnownNames) {
+    for (uint32_t i = 0; i < ApiLatencyHistograms::entryPointsCount; i++) {
+        auto expectedEntryPoint = static_cast<ApiLatencyEntryPoint>(i);
+        ApiLatencyEntryPoint entryPoint = ApiLatencyEntryPoint::count;
+        EXPECT_TRUE(ApiLatencyHistograms::getEntryPoint(ApiLatencyHistograms::getEntryPointName(expectedEntryPoint), entryPoint));
+        EXPECT_EQ(expectedEntryPoint, entryPoint);
+    }
+
+    ApiLatencyEntryPoint entryPoint = ApiLatencyEntryPoint::count;
+    EXPECT_FALSE(ApiLatencyHistograms::getEntryPoint("zeKernelSetArgumentValue", entryPoint));
+    EXPECT_FALSE(ApiLatencyHistograms::getEntryPoint("", entryPoint));
+    EXPECT_EQ(ApiLatencyEntryPoint::count, entryPoint);
+}
+
+TEST(ApiLatencyHistogramsTest, givenRecordedLatenciesWhenGettingSummaryThenCountsAndPercentilesComeFromOneMergedHistogram) {
+    ApiLatencyHistograms histograms(1u, 0);
+    for (uint32_t i = 0; i < 98; i++) {
+        histograms.record(ApiLatencyEntryPoint::zeEventHostSynchronize, 1000u);
+    }
+    histograms.record(ApiLatencyEntryPoint::zeEventHostSynchronize, 100000u);
+    histograms.record(ApiLatencyEntryPoint::zeEventHostSynchronize, 1000000u);
+
+    auto summary = histograms.getSummary(ApiLatencyEntryPoint::zeEventHostSynchronize);
+    EXPECT_EQ(100u, summary.samplesCount);
+    EXPECT_EQ(98u, summary.histogram[ApiLatencyHistograms::getBucketIndex(1000u)]);
+    EXPECT_EQ(1023u, summary.p50Ns);
+    EXPECT_EQ(1023u, summary.p90Ns);
+    EXPECT_EQ(131071u, summary.p99Ns);
+    EXPECT_EQ(1048575u, summary.maxNs);
+    EXPECT_EQ(1u, histograms.getSamplingRate());
+
+    auto emptySummary = histograms.getSummary(ApiLatencyEntryPoint::clFinish);
+    EXPECT_EQ(0u, emptySummary.samplesCount);
+    EXPECT_EQ(0u, emptySummary.p99Ns);
+}